@@ -51,6 +51,8 @@ const char END[] = "end";
 const char SIZE[] = "size";
 const char USE_NESTEROV[] = "use_nesterov";
 const char GROUP[] = "group";
+// Element-wise work smaller than this runs inline on the launching thread instead of the thread pool.
+const size_t kParallelGrainSize = 4096;
 enum OperateType { ADD = 0, SUB, MUL, DIV, SQUARE, SQRT };
 
 class CPUKernel : public kernel::KernelMod {
@@ -13,9 +13,10 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <thread>
+#include <algorithm>
 #include <string>
 #include "backend/kernel_compiler/cpu/embedding_look_up_cpu_kernel.h"
+#include "common/thread_pool.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 #include "ir/primitive.h"
 
@@ -71,28 +72,14 @@ void EmbeddingLookUpCPUKernel::LaunchKernel(const std::vector<kernel::AddressPtr
   auto input_addr = reinterpret_cast<float *>(inputs[0]->addr);
   auto indices_addr = reinterpret_cast<T *>(inputs[1]->addr);
   auto output_addr = reinterpret_cast<float *>(outputs[0]->addr);
-  const size_t thread_num = 16;
-  std::thread threads[16];
-  size_t task_proc_lens = (indices_lens_ + thread_num - 1) / thread_num;
-  size_t i;
-  size_t task_offset = 0;
-  MS_LOG(DEBUG) << "indices_lens_: " << indices_lens_ << " one task proc lens:" << task_proc_lens;
-  for (i = 0; i < thread_num; i++) {
-    if (task_offset >= indices_lens_) {
-      break;
-    }
-    MS_LOG(DEBUG) << "task_offset: " << task_offset << " task_proc_lenss:" << task_proc_lens;
-    threads[i] = std::thread(LookUpTableTask<T>, input_addr, indices_addr + task_offset, output_addr + outputs[0]->size,
-                             output_addr + task_offset * outer_dim_size_, task_proc_lens, outer_dim_size_, offset_,
-                             first_dim_size_);
-    task_offset += task_proc_lens;
-    if (task_offset + task_proc_lens > indices_lens_) {
-      task_proc_lens = indices_lens_ - task_offset;
-    }
-  }
-  for (size_t j = 0; j < i; j++) {
-    threads[j].join();
-  }
+  auto output_max_addr = output_addr + outputs[0]->size;
+  size_t row_size = std::max(outer_dim_size_, static_cast<size_t>(1));
+  size_t grain = std::max(kParallelGrainSize / row_size, static_cast<size_t>(1));
+  MS_LOG(DEBUG) << "indices_lens_: " << indices_lens_ << " grain: " << grain;
+  common::ThreadPool::GetInstance().ParallelFor(0, indices_lens_, grain, [&](size_t start, size_t end) {
+    LookUpTableTask<T>(input_addr, indices_addr + start, output_max_addr, output_addr + start * outer_dim_size_,
+                       end - start, outer_dim_size_, offset_, first_dim_size_);
+  });
 }
 
 bool EmbeddingLookUpCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
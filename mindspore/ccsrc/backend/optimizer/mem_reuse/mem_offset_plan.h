@@ -0,0 +1,92 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_OFFSET_PLAN_H_
+#define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_OFFSET_PLAN_H_
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace mindspore {
+namespace memreuse {
+constexpr size_t kMemOffsetAlignSize = 64;
+
+inline size_t AlignMemOffsetSize(size_t size) {
+  return (size + kMemOffsetAlignSize - 1) / kMemOffsetAlignSize * kMemOffsetAlignSize;
+}
+
+// Place every block at an offset so that blocks with overlapping lifetimes never overlap in memory, choosing the
+// smallest free gap for each block, and return the total size needed. The block type has the members size_,
+// first_use_ and last_use_, a lifetime of [first_use_, last_use_] in execution order, and offset_ which is set here.
+// This is header only so that the lite runtime shares it without linking the backend.
+template <typename Block>
+size_t AssignBestFitOffsets(std::vector<Block> *blocks) {
+  auto &mem_blocks = *blocks;
+  // Placing the big blocks first leaves the small ones to fill the gaps between them.
+  std::vector<size_t> order(mem_blocks.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&mem_blocks](size_t lhs, size_t rhs) {
+    if (mem_blocks[lhs].size_ != mem_blocks[rhs].size_) {
+      return mem_blocks[lhs].size_ > mem_blocks[rhs].size_;
+    }
+    return mem_blocks[lhs].first_use_ < mem_blocks[rhs].first_use_;
+  });
+
+  size_t total_size = 0;
+  std::vector<size_t> placed;
+  std::vector<const Block *> live_blocks;
+  for (auto index : order) {
+    auto &block = mem_blocks[index];
+    size_t block_size = AlignMemOffsetSize(block.size_);
+    live_blocks.clear();
+    for (auto placed_index : placed) {
+      const auto &other = mem_blocks[placed_index];
+      if (block.first_use_ <= other.last_use_ && other.first_use_ <= block.last_use_) {
+        live_blocks.push_back(&other);
+      }
+    }
+    std::sort(live_blocks.begin(), live_blocks.end(),
+              [](const Block *lhs, const Block *rhs) { return lhs->offset_ < rhs->offset_; });
+
+    // Best fit: the smallest gap between live blocks which can hold this block, else the end of the live blocks.
+    size_t best_offset = std::numeric_limits<size_t>::max();
+    size_t best_gap = std::numeric_limits<size_t>::max();
+    size_t current_offset = 0;
+    for (auto live_block : live_blocks) {
+      if (live_block->offset_ > current_offset) {
+        size_t gap = live_block->offset_ - current_offset;
+        if (gap >= block_size && gap < best_gap) {
+          best_gap = gap;
+          best_offset = current_offset;
+        }
+      }
+      current_offset = std::max(current_offset, live_block->offset_ + AlignMemOffsetSize(live_block->size_));
+    }
+    if (best_offset == std::numeric_limits<size_t>::max()) {
+      best_offset = current_offset;
+    }
+    block.offset_ = best_offset;
+    total_size = std::max(total_size, best_offset + block_size);
+    placed.push_back(index);
+  }
+  return total_size;
+}
+}  // namespace memreuse
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_OFFSET_PLAN_H_
@@ -0,0 +1,166 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/thread_pool.h"
+#include <algorithm>
+#include <exception>
+#include "utils/log_adapter.h"
+#include "utils/ms_context.h"
+
+namespace mindspore {
+namespace common {
+namespace {
+struct ParallelSync {
+  std::mutex mutex;
+  std::condition_variable cond_var;
+  size_t remaining{0};
+  std::exception_ptr exception{nullptr};
+};
+
+void RunRange(const ParallelTask &task, size_t start, size_t end, ParallelSync *sync) {
+  try {
+    task(start, end);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(sync->mutex);
+    if (sync->exception == nullptr) {
+      sync->exception = std::current_exception();
+    }
+  }
+}
+
+size_t GetConfiguredThreadNum() {
+  size_t thread_num = 0;
+  auto context = MsContext::GetInstance();
+  if (context != nullptr) {
+    thread_num = context->get_param<uint32_t>(MS_CTX_CPU_THREAD_NUM);
+  }
+  if (thread_num == 0) {
+    thread_num = std::thread::hardware_concurrency();
+  }
+  return std::max(thread_num, static_cast<size_t>(1));
+}
+}  // namespace
+
+ThreadPool::ThreadPool() {
+  thread_num_ = GetConfiguredThreadNum();
+  MS_LOG(INFO) << "Cpu kernel thread pool size: " << thread_num_;
+  // The calling thread always runs one of the ranges itself.
+  for (size_t i = 1; i < thread_num_; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(task_mutex_);
+    exit_run_ = true;
+  }
+  task_cond_var_.notify_all();
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+ThreadPool &ThreadPool::GetInstance() {
+  static ThreadPool instance;
+  return instance;
+}
+
+void ThreadPool::WorkerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(task_mutex_);
+      task_cond_var_.wait(lock, [this] { return exit_run_ || !tasks_.empty(); });
+      if (exit_run_ && tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+bool ThreadPool::RunOneTask() {
+  std::function<void()> task;
+  {
+    std::lock_guard<std::mutex> lock(task_mutex_);
+    if (tasks_.empty()) {
+      return false;
+    }
+    task = std::move(tasks_.front());
+    tasks_.pop();
+  }
+  task();
+  return true;
+}
+
+void ThreadPool::ParallelFor(size_t begin, size_t end, size_t grain, const ParallelTask &task) {
+  if (end <= begin) {
+    return;
+  }
+  size_t total = end - begin;
+  grain = std::max(grain, static_cast<size_t>(1));
+  size_t task_num = std::min(thread_num_, (total + grain - 1) / grain);
+  if (task_num <= 1) {
+    task(begin, end);
+    return;
+  }
+
+  size_t once_compute_size = (total + task_num - 1) / task_num;
+  auto sync = std::make_shared<ParallelSync>();
+  size_t start = begin + once_compute_size;
+  {
+    std::lock_guard<std::mutex> lock(task_mutex_);
+    while (start < end) {
+      size_t stop = std::min(start + once_compute_size, end);
+      sync->remaining++;
+      tasks_.emplace([&task, start, stop, sync]() {
+        RunRange(task, start, stop, sync.get());
+        std::lock_guard<std::mutex> sync_lock(sync->mutex);
+        if (--sync->remaining == 0) {
+          sync->cond_var.notify_one();
+        }
+      });
+      start = stop;
+    }
+  }
+  task_cond_var_.notify_all();
+
+  RunRange(task, begin, std::min(begin + once_compute_size, end), sync.get());
+  // Help with pending ranges rather than block, so nested ParallelFor calls from workers cannot starve the pool.
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(sync->mutex);
+      if (sync->remaining == 0) {
+        break;
+      }
+    }
+    if (!RunOneTask()) {
+      std::unique_lock<std::mutex> lock(sync->mutex);
+      sync->cond_var.wait(lock, [&sync] { return sync->remaining == 0; });
+      break;
+    }
+  }
+  if (sync->exception != nullptr) {
+    std::rethrow_exception(sync->exception);
+  }
+}
+}  // namespace common
+}  // namespace mindspore
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_COMMON_THREAD_POOL_H_
+#define MINDSPORE_CCSRC_COMMON_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace mindspore {
+namespace common {
+using ParallelTask = std::function<void(size_t start, size_t end)>;
+
+// Process-wide pool of worker threads shared by the cpu kernels. Workers are created once on first use, so the
+// thread creation cost is no longer paid by every kernel launch.
+class ThreadPool {
+ public:
+  ~ThreadPool();
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  static ThreadPool &GetInstance();
+
+  // Split [begin, end) into at most GetThreadNum() ranges of no less than `grain` elements and run `task` on each
+  // of them. The calling thread takes part in the computation and returns when all ranges are done. Ranges not
+  // larger than `grain` are run inline on the calling thread. Exceptions raised by `task` are rethrown here.
+  void ParallelFor(size_t begin, size_t end, size_t grain, const ParallelTask &task);
+
+  // Number of threads taking part in a ParallelFor, the calling thread included.
+  size_t GetThreadNum() const { return thread_num_; }
+
+ private:
+  ThreadPool();
+  void WorkerLoop();
+  bool RunOneTask();
+
+  size_t thread_num_{1};
+  bool exit_run_{false};
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex task_mutex_;
+  std::condition_variable task_cond_var_;
+};
+}  // namespace common
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_COMMON_THREAD_POOL_H_
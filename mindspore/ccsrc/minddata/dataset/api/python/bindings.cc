@@ -46,6 +46,13 @@ PYBIND_REGISTER(
            [](DEPipeline &de, const py::dict &args) { THROW_IF_ERROR(de.SetBatchParameters(args)); })
       .def("PrepareTree", [](DEPipeline &de, int32_t num_epochs) { THROW_IF_ERROR(de.PrepareTree(num_epochs)); })
       .def("LaunchTreeExec", [](DEPipeline &de) { THROW_IF_ERROR(de.LaunchTreeExec()); })
+      .def("SaveState",
+           [](DEPipeline &de) {
+             std::string state;
+             THROW_IF_ERROR(de.SaveState(&state));
+             return state;
+           })
+      .def("RestoreState", [](DEPipeline &de, const std::string &state) { THROW_IF_ERROR(de.RestoreState(state)); })
       .def("GetColumnNames",
            [](DEPipeline &de) {
              py::list out;
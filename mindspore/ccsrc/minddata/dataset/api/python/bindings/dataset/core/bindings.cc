@@ -47,6 +47,16 @@ PYBIND_REGISTER(ConfigManager, 0, ([](const py::module *m) {
                     .def("get_monitor_sampling_interval", &ConfigManager::monitor_sampling_interval)
                     .def("get_callback_timeout", &ConfigManager::callback_timeout)
                     .def("set_callback_timeout", &ConfigManager::set_callback_timeout)
+                    .def("get_enable_autotune", &ConfigManager::enable_autotune)
+                    .def("set_enable_autotune", &ConfigManager::set_enable_autotune)
+                    .def("get_autotune_cpu_budget", &ConfigManager::autotune_cpu_budget)
+                    .def("set_autotune_cpu_budget", &ConfigManager::set_autotune_cpu_budget)
+                    .def("get_deterministic_order", &ConfigManager::deterministic_order)
+                    .def("set_deterministic_order", &ConfigManager::set_deterministic_order)
+                    .def("get_tensor_pool_cache_size", &ConfigManager::tensor_pool_cache_size)
+                    .def("set_tensor_pool_cache_size", &ConfigManager::set_tensor_pool_cache_size)
+                    .def("get_zero_copy_output", &ConfigManager::zero_copy_output)
+                    .def("set_zero_copy_output", &ConfigManager::set_zero_copy_output)
                     .def("load", [](ConfigManager &c, std::string s) { THROW_IF_ERROR(c.LoadFile(s)); });
                 }));
 
@@ -183,6 +183,20 @@ Status DEPipeline::LaunchTreeExec() {
   return Status::OK();
 }
 
+Status DEPipeline::SaveState(std::string *state) {
+  if (iterator_ == nullptr) RETURN_STATUS_UNEXPECTED("Invalid operation, the tree is not launched yet.");
+  json tree_state;
+  RETURN_IF_NOT_OK(tree_->SaveState(iterator_->cur_epoch(), iterator_->cur_row(), &tree_state));
+  *state = tree_state.dump();
+  return Status::OK();
+}
+
+Status DEPipeline::RestoreState(const std::string &state) {
+  json tree_state = json::parse(state, nullptr, false);
+  if (tree_state.is_discarded()) RETURN_STATUS_UNEXPECTED("Invalid data, the saved state is not a valid json string.");
+  return tree_->RestoreState(tree_state);
+}
+
 void DEPipeline::PrintTree() {
   for (auto itr = tree_->begin(); itr != tree_->end(); ++itr) {
     std::stringstream ss;
@@ -101,6 +101,12 @@ class DEPipeline {
   // Function to launch the tree execution.
   Status LaunchTreeExec();
 
+  // Function to save the state needed to resume right after the last row fetched, as a json string.
+  Status SaveState(std::string *state);
+
+  // Function to restore a state saved by SaveState, between preparing and launching the tree.
+  Status RestoreState(const std::string &state);
+
   // Get a row of data as dictionary of column name to the value.
   Status GetNextAsMap(py::dict *output);
 
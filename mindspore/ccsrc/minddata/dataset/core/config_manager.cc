@@ -15,11 +15,15 @@
  */
 #include "minddata/dataset/core/config_manager.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include "mindspore/core/utils/log_adapter.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/util/size_class_pool.h"
 #include "minddata/dataset/util/system_pool.h"
 
 namespace mindspore {
@@ -32,6 +36,11 @@ ConfigManager::ConfigManager()
       seed_(kCfgDefaultSeed),
       monitor_sampling_interval_(kCfgMonitorSamplingInterval),
       callback_timout_(kCfgCallbackTimeout),
+      enable_autotune_(false),
+      autotune_cpu_budget_(0),
+      deterministic_order_(true),
+      tensor_pool_cache_size_(kCfgTensorPoolCacheSize),
+      zero_copy_output_(false),
       cache_host_(kCfgDefaultCacheHost),
       cache_port_(kCfgDefaultCachePort) {
   auto env_cache_host = std::getenv("MS_CACHE_HOST");
@@ -71,6 +80,11 @@ Status ConfigManager::FromJson(const nlohmann::json &j) {
   set_monitor_sampling_interval(j.value("monitorSamplingInterval", monitor_sampling_interval_));
   set_cache_host(j.value("cacheHost", cache_host_));
   set_cache_port(j.value("cachePort", cache_port_));
+  set_enable_autotune(j.value("enableAutotune", enable_autotune_));
+  set_autotune_cpu_budget(j.value("autotuneCpuBudget", autotune_cpu_budget_));
+  set_deterministic_order(j.value("deterministicOrder", deterministic_order_));
+  set_tensor_pool_cache_size(j.value("tensorPoolCacheSize", tensor_pool_cache_size_));
+  set_zero_copy_output(j.value("zeroCopyOutput", zero_copy_output_));
   return Status::OK();
 }
 
@@ -120,6 +134,26 @@ void ConfigManager::set_monitor_sampling_interval(uint32_t interval) { monitor_s
 
 void ConfigManager::set_callback_timeout(uint32_t timeout) { callback_timout_ = timeout; }
 
+void ConfigManager::set_enable_autotune(bool enable) { enable_autotune_ = enable; }
+
+void ConfigManager::set_autotune_cpu_budget(int32_t budget) { autotune_cpu_budget_ = budget; }
+
+int32_t ConfigManager::autotune_cpu_budget() const {
+  if (autotune_cpu_budget_ > 0) {
+    return autotune_cpu_budget_;
+  }
+  return std::max(static_cast<int32_t>(std::thread::hardware_concurrency()), 1);
+}
+
+void ConfigManager::set_deterministic_order(bool deterministic) { deterministic_order_ = deterministic; }
+
+void ConfigManager::set_tensor_pool_cache_size(int64_t cache_size) {
+  tensor_pool_cache_size_ = cache_size;
+  GlobalContext::Instance()->tensor_pool()->set_max_cache_size(cache_size);
+}
+
+void ConfigManager::set_zero_copy_output(bool zero_copy) { zero_copy_output_ = zero_copy; }
+
 void ConfigManager::set_cache_host(std::string cache_host) { cache_host_ = cache_host; }
 
 void ConfigManager::set_cache_port(int32_t cache_port) { cache_port_ = cache_port; }
@@ -143,6 +143,46 @@ class ConfigManager {
   // @return The timeout DSWaitedCallback would wait for before raising an error
   int32_t callback_timeout() const { return callback_timout_; }
 
+  // setter function
+  // @param enable - Whether the execution tree tunes worker counts and connector sizes while running
+  void set_enable_autotune(bool enable);
+
+  // getter function
+  // @return Whether autotune is enabled
+  bool enable_autotune() const { return enable_autotune_; }
+
+  // setter function
+  // @param budget - The number of worker threads autotune may use in total, 0 means the number of cpu cores
+  void set_autotune_cpu_budget(int32_t budget);
+
+  // getter function
+  // @return The number of worker threads autotune may use in total
+  int32_t autotune_cpu_budget() const;
+
+  // setter function
+  // @param deterministic - Whether map operators must keep the order of the rows
+  void set_deterministic_order(bool deterministic);
+
+  // getter function
+  // @return Whether map operators keep the order of the rows
+  bool deterministic_order() const { return deterministic_order_; }
+
+  // setter function
+  // @param cache_size - The number of bytes of freed tensor memory the global tensor pool keeps for reuse
+  void set_tensor_pool_cache_size(int64_t cache_size);
+
+  // getter function
+  // @return The number of bytes of freed tensor memory the global tensor pool keeps for reuse
+  int64_t tensor_pool_cache_size() const { return tensor_pool_cache_size_; }
+
+  // setter function
+  // @param zero_copy - Whether the iterators hand out the memory of dataset tensors instead of a copy of it
+  void set_zero_copy_output(bool zero_copy);
+
+  // getter function
+  // @return Whether the iterators hand out the memory of dataset tensors instead of a copy of it
+  bool zero_copy_output() const { return zero_copy_output_; }
+
  private:
   int32_t rows_per_buffer_;
   int32_t num_parallel_workers_;
@@ -151,6 +191,11 @@ class ConfigManager {
   uint32_t seed_;
   uint32_t monitor_sampling_interval_;
   uint32_t callback_timout_;
+  bool enable_autotune_;
+  int32_t autotune_cpu_budget_;
+  bool deterministic_order_;
+  int64_t tensor_pool_cache_size_;
+  bool zero_copy_output_;
   std::string cache_host_;
   int32_t cache_port_;
 
@@ -23,6 +23,7 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/util/allocator.h"
 #include "minddata/dataset/util/circular_pool.h"
+#include "minddata/dataset/util/size_class_pool.h"
 #include "minddata/dataset/util/system_pool.h"
 
 namespace mindspore {
@@ -51,7 +52,9 @@ GlobalContext *GlobalContext::Instance() {
 
 Status GlobalContext::Init() {
   config_manager_ = std::make_shared<ConfigManager>();
-  mem_pool_ = std::make_shared<SystemPool>();
+  // Tensors of a pipeline come and go with the same few sizes, so freed blocks are kept for reuse.
+  tensor_pool_ = std::make_shared<SizeClassPool>(config_manager_->tensor_pool_cache_size());
+  mem_pool_ = tensor_pool_;
   // For testing we can use Dummy pool instead
 
   // Create some tensor allocators for the different types and hook them into the pool.
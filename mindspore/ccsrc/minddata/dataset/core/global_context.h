@@ -28,6 +28,7 @@ namespace dataset {
 // forward declare
 class MemoryPool;
 class ConfigManager;
+class SizeClassPool;
 class Tensor;
 class CVTensor;
 
@@ -74,6 +75,10 @@ class GlobalContext {
   // @return the mem pool
   std::shared_ptr<MemoryPool> mem_pool() const { return mem_pool_; }
 
+  // Getter method
+  // @return the pool which tensor memory comes from, it is the same pool as mem_pool()
+  std::shared_ptr<SizeClassPool> tensor_pool() const { return tensor_pool_; }
+
   // Getter method
   // @return the tensor allocator as raw pointer
   const TensorAlloc *tensor_allocator() const { return tensor_allocator_.get(); }
@@ -97,6 +102,7 @@ class GlobalContext {
   static std::once_flag init_instance_flag_;
   static std::unique_ptr<GlobalContext> global_context_;  // The instance of the singleton (global)
   std::shared_ptr<MemoryPool> mem_pool_;                  // A global memory pool
+  std::shared_ptr<SizeClassPool> tensor_pool_;            // The global memory pool, which caches freed blocks
   std::shared_ptr<ConfigManager> config_manager_;         // The configs
   std::unique_ptr<TensorAlloc> tensor_allocator_;         // An allocator for Tensors
   std::unique_ptr<CVTensorAlloc> cv_tensor_allocator_;    // An allocator for CV Tensors
@@ -110,6 +110,62 @@ Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type,
   return Status::OK();
 }
 
+Status Tensor::CreateFromTensors(const std::vector<TensorPtr> &tensors, TensorPtr *out) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!tensors.empty(), "No tensor to stack.");
+  const TensorShape &shape = tensors[0]->shape();
+  const DataType &type = tensors[0]->type();
+  for (const auto &tensor : tensors) {
+    CHECK_FAIL_RETURN_UNEXPECTED(tensor->shape() == shape, "Tensors to stack have different shapes.");
+    CHECK_FAIL_RETURN_UNEXPECTED(tensor->type().IsNumeric() == type.IsNumeric() &&
+                                   tensor->type().SizeInBytes() == type.SizeInBytes(),
+                                 "Tensors to stack have different types.");
+  }
+  TensorShape new_shape = shape.PrependDim(static_cast<int64_t>(tensors.size()));
+  if (type.IsNumeric()) {
+    RETURN_IF_NOT_OK(CreateEmpty(new_shape, type, out));
+    dsize_t total_bytes = (*out)->SizeInBytes();
+    dsize_t row_bytes = tensors[0]->SizeInBytes();
+    uchar *dst = (*out)->data_;
+    for (dsize_t offset = 0, i = 0; offset < total_bytes; offset += row_bytes, i++) {
+      int ret_code = memcpy_s(dst + offset, total_bytes - offset, tensors[i]->GetBuffer(), row_bytes);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy data into tensor.");
+    }
+    return Status::OK();
+  }
+
+  // String tensors keep their strings contiguous after the offset array, so each input's strings are copied at once
+  // and only its offsets are shifted.
+  const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
+  *out = std::allocate_shared<Tensor>(*alloc, new_shape, type);
+  dsize_t num_elements = new_shape.NumOfElements();
+  if (num_elements == 0) {
+    return Status::OK();
+  }
+  dsize_t num_elements_per_tensor = shape.NumOfElements();
+  dsize_t strings_length = 0;
+  for (const auto &tensor : tensors) {
+    auto offsets = reinterpret_cast<const offset_t *>(tensor->GetBuffer());
+    strings_length += offsets[num_elements_per_tensor] - offsets[0];
+  }
+  dsize_t num_bytes = kOffsetSize * (num_elements + 1) + strings_length;
+  RETURN_IF_NOT_OK((*out)->AllocateBuffer(num_bytes));
+  auto offset_arr = reinterpret_cast<offset_t *>((*out)->data_);
+  offset_t offset = (*out)->GetStringsBuffer() - (*out)->data_;
+  for (const auto &tensor : tensors) {
+    auto offsets = reinterpret_cast<const offset_t *>(tensor->GetBuffer());
+    for (dsize_t i = 0; i < num_elements_per_tensor; i++) {
+      *offset_arr++ = offset + offsets[i] - offsets[0];
+    }
+    offset_t length = offsets[num_elements_per_tensor] - offsets[0];
+    int ret_code = memcpy_s((*out)->data_ + offset, num_bytes - offset, tensor->GetBuffer() + offsets[0], length);
+    CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy data into tensor.");
+    offset += length;
+  }
+  *offset_arr = offset;
+  (*out)->data_end_ = (*out)->data_ + offset;
+  return Status::OK();
+}
+
 Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type, const unsigned char *src,
                                 const dsize_t &length, TensorPtr *out) {
   CHECK_FAIL_RETURN_UNEXPECTED(src != nullptr, "Pointer to source data is null.");
@@ -118,6 +118,14 @@ class Tensor {
     return CreateFromMemory(in->shape(), in->type(), in->GetBuffer(), in->SizeInBytes(), out);
   }
 
+  /// Stack tensors of the same shape into a new tensor with an extra first dimension, e.g. to build a batch.
+  /// The destination offset of every input is computed once and each input is copied with a single memcpy,
+  /// for string tensors too.
+  /// \param[in] tensors input tensors, all with the shape of the first one and a type of the same size
+  /// \param[out] out output tensor of shape <tensors.size(), first shape...>
+  /// \return Status
+  static Status CreateFromTensors(const std::vector<TensorPtr> &tensors, TensorPtr *out);
+
 #ifdef ENABLE_PYTHON
   /// Create a Tensor from a given py::array
   /// \param[in] arr py::array
@@ -19,6 +19,7 @@
 #include <sys/wait.h>
 #include <unistd.h>
 #include <cerrno>
+#include <iomanip>
 #include <iostream>
 #include <string>
 #include <cstdlib>
@@ -62,6 +63,7 @@ CacheAdminArgHandler::CacheAdminArgHandler()
   arg_map_["--shared_memory_size"] = ArgValue::kArgSharedMemorySize;
   arg_map_["-l"] = ArgValue::kArgLogLevel;
   arg_map_["--minloglevel"] = ArgValue::kArgLogLevel;
+  arg_map_["--list_sessions"] = ArgValue::kArgListSessions;
   // Initialize argument tracker with false values
   for (int16_t i = 0; i < static_cast<int16_t>(ArgValue::kArgNumArgs); ++i) {
     ArgValue currAV = static_cast<ArgValue>(i);
@@ -175,6 +177,10 @@ Status CacheAdminArgHandler::ParseArgStream(std::stringstream *arg_stream) {
           AssignArg(tok, static_cast<std::string *>(nullptr), arg_stream, CommandId::kCmdGenerateSession));
         break;
       }
+      case ArgValue::kArgListSessions: {
+        RETURN_IF_NOT_OK(AssignArg(tok, static_cast<std::string *>(nullptr), arg_stream, CommandId::kCmdListSessions));
+        break;
+      }
       case ArgValue::kArgHelp: {
         command_id_ = CommandId::kCmdHelp;
         break;
@@ -273,6 +279,10 @@ Status CacheAdminArgHandler::RunCommand() {
       std::cout << "Drop session successful" << std::endl;
       break;
     }
+    case CommandId::kCmdListSessions: {
+      RETURN_IF_NOT_OK(ListSessions());
+      break;
+    }
     default: {
       RETURN_STATUS_UNEXPECTED("Invalid cache admin command id.");
       break;
@@ -381,6 +391,31 @@ Status CacheAdminArgHandler::StopServer() {
   return Status::OK();
 }
 
+Status CacheAdminArgHandler::ListSessions() {
+  CacheClientGreeter comm(hostname_, port_, 1);
+  RETURN_IF_NOT_OK(comm.ServiceStart());
+  auto rq = std::make_shared<ListSessionsRequest>();
+  RETURN_IF_NOT_OK(comm.HandleRequest(rq));
+  RETURN_IF_NOT_OK(rq->Wait());
+  // Hit rates of each tier are the percentage of the reads served from memory and from disk.
+  auto hit_rate = [](int64_t hit, int64_t total) -> std::string {
+    return total > 0 ? std::to_string(hit * 100 / total) + "%" : "n/a";
+  };
+  const int32_t w = 14;
+  std::cout << std::setw(12) << "Session" << std::setw(22) << "Cache id" << std::setw(w) << "Mem cached"
+            << std::setw(w) << "Disk cached" << std::setw(w) << "Mem hit" << std::setw(w) << "Disk hit"
+            << std::setw(w) << "Promoted" << std::setw(w) << "Evicted" << std::endl;
+  for (auto &session : rq->GetSessionStats()) {
+    auto &stat = session.stats;
+    auto num_read = stat.num_mem_hit + stat.num_disk_hit;
+    std::cout << std::setw(12) << session.session_id << std::setw(22) << session.connection_id << std::setw(w)
+              << stat.num_mem_cached << std::setw(w) << stat.num_disk_cached << std::setw(w)
+              << hit_rate(stat.num_mem_hit, num_read) << std::setw(w) << hit_rate(stat.num_disk_hit, num_read)
+              << std::setw(w) << stat.num_promoted << std::setw(w) << stat.num_evicted << std::endl;
+  }
+  return Status::OK();
+}
+
 void CacheAdminArgHandler::Help() {
   std::cerr << "Syntax:\n";
   std::cerr << "   cache_admin [--start | --stop]\n";
@@ -388,6 +423,7 @@ void CacheAdminArgHandler::Help() {
   std::cerr << "               [ [-p | --port] <port number> ]\n";
   std::cerr << "               [ [-g | --generate_session] ]\n";
   std::cerr << "               [ [-d | --destroy_session] <session id> ]\n";
+  std::cerr << "               [--list_sessions]\n";
   std::cerr << "               [ [-w | --workers] <number of workers> ]\n";
   std::cerr << "               [ [-s | --spilldir] <spilling directory> ]\n";
   std::cerr << "               [ [-m | --shared_memory_size] <shared memory size> ]\n";
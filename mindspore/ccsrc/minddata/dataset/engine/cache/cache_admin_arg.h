@@ -42,6 +42,7 @@ class CacheAdminArgHandler {
     kCmdStop = 2,
     kCmdGenerateSession = 3,
     kCmdDestroySession = 4,
+    kCmdListSessions = 5,
     kCmdUnknown = 32767
   };
 
@@ -70,13 +71,16 @@ class CacheAdminArgHandler {
     kArgNumWorkers = 9,
     kArgSharedMemorySize = 10,
     kArgLogLevel = 11,
-    kArgNumArgs = 12  // Must be the last position to provide a count
+    kArgListSessions = 12,
+    kArgNumArgs = 13  // Must be the last position to provide a count
   };
 
   Status StartServer();
 
   Status StopServer();
 
+  Status ListSessions();
+
   Status AssignArg(std::string option, int32_t *out_arg, std::stringstream *arg_stream,
                    CommandId command_id = CommandId::kCmdUnknown);
 
@@ -129,6 +129,12 @@ Status CacheClient::GetRows(const std::vector<row_id_type> &row_id, TensorTable
   return rc;
 }
 
+Status CacheClient::PrefetchRows(const std::vector<row_id_type> &row_id) const {
+  auto rq = std::make_shared<PrefetchRowsRequest>(server_connection_id_, row_id);
+  // It is only a hint. We won't wait for the result for the sake of performance.
+  return PushRequest(rq);
+}
+
 Status CacheClient::CreateCache(uint32_t tree_crc, bool generate_id) {
   UniqueLock lck(&mux_);
   // To create a cache, we identify ourself at the client by:
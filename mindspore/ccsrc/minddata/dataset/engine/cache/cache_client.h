@@ -155,6 +155,12 @@ class CacheClient {
   /// \return return code
   Status GetRows(const std::vector<row_id_type> &row_id, TensorTable *out) const;
 
+  /// \brief Tell the cache server which rows will be fetched next, so that it can read ahead the rows spilled
+  /// to disk. We don't wait for the server to finish.
+  /// \param row_id A vector of row id's
+  /// \return return code
+  Status PrefetchRows(const std::vector<row_id_type> &row_id) const;
+
   /// \brief Create a cache.
   /// \param tree_crc  A crc that was generated during tree prepare phase
   /// \param generate_id Let the cache service generate row id
@@ -133,6 +133,19 @@ BatchFetchRequest::BatchFetchRequest(connection_id_type connection_id, const std
   rq_.add_buf_data(fbb.GetBufferPointer(), fbb.GetSize());
 }
 
+PrefetchRowsRequest::PrefetchRowsRequest(connection_id_type connection_id, const std::vector<row_id_type> &row_id)
+    : BaseRequest(RequestType::kPrefetchRows) {
+  rq_.set_connection_id(connection_id);
+  // Same format as BatchFetchRequest
+  flatbuffers::FlatBufferBuilder fbb;
+  auto off_t = fbb.CreateVector(row_id);
+  TensorRowIdsBuilder bld(fbb);
+  bld.add_row_id(off_t);
+  auto off = bld.Finish();
+  fbb.Finish(off);
+  rq_.add_buf_data(fbb.GetBufferPointer(), fbb.GetSize());
+}
+
 Status BatchFetchRequest::RestoreRows(TensorTable *out, const void *baseAddr, int64_t *out_addr) {
   RETURN_UNEXPECTED_IF_NULL(out);
   auto num_elements = row_id_.size();
@@ -240,14 +253,44 @@ Status FetchSchemaRequest::PostReply() {
 
 std::unordered_map<std::string, int32_t> FetchSchemaRequest::GetColumnMap() { return column_name_id_map_; }
 
+namespace {
+void ServiceStatMsgToStat(const ServiceStatMsg *msg, CacheServiceStat *stat) {
+  stat->num_disk_cached = msg->num_disk_cached();
+  stat->num_mem_cached = msg->num_mem_cached();
+  stat->avg_cache_sz = msg->avg_cache_sz();
+  stat->max_row_id = msg->max_row_id();
+  stat->min_row_id = msg->min_row_id();
+  stat->cache_service_state = msg->state();
+  stat->num_mem_hit = msg->num_mem_hit();
+  stat->num_disk_hit = msg->num_disk_hit();
+  stat->num_promoted = msg->num_promoted();
+  stat->num_evicted = msg->num_evicted();
+}
+}  // namespace
+
 Status GetStatRequest::PostReply() {
   auto *msg = flatbuffers::GetRoot<ServiceStatMsg>(reply_.result().data());
-  stat_.num_disk_cached = msg->num_disk_cached();
-  stat_.num_mem_cached = msg->num_mem_cached();
-  stat_.avg_cache_sz = msg->avg_cache_sz();
-  stat_.max_row_id = msg->max_row_id();
-  stat_.min_row_id = msg->min_row_id();
-  stat_.cache_service_state = msg->state();
+  ServiceStatMsgToStat(msg, &stat_);
+  return Status::OK();
+}
+
+Status ListSessionsRequest::PostReply() {
+  auto *msg = flatbuffers::GetRoot<ListSessionsMsg>(reply_.result().data());
+  session_stats_.clear();
+  if (msg->sessions() == nullptr) {
+    return Status::OK();
+  }
+  session_stats_.reserve(msg->sessions()->size());
+  for (uint32_t i = 0; i < msg->sessions()->size(); ++i) {
+    auto *session = msg->sessions()->Get(i);
+    CacheSessionStat session_stat{};
+    session_stat.session_id = session->session_id();
+    session_stat.connection_id = session->connection_id();
+    if (session->stats() != nullptr) {
+      ServiceStatMsgToStat(session->stats(), &session_stat.stats);
+    }
+    session_stats_.push_back(session_stat);
+  }
   return Status::OK();
 }
 }  // namespace dataset
@@ -44,6 +44,17 @@ struct CacheServiceStat {
   row_id_type min_row_id;
   row_id_type max_row_id;
   int8_t cache_service_state;
+  int64_t num_mem_hit;
+  int64_t num_disk_hit;
+  int64_t num_promoted;
+  int64_t num_evicted;
+};
+
+/// \brief Statistic structure of a cache for ListSessionsRequest
+struct CacheSessionStat {
+  session_id_type session_id;
+  connection_id_type connection_id;
+  CacheServiceStat stats;
 };
 
 /// \brief CacheClient communicates with CacheServer using Requests.
@@ -65,6 +76,8 @@ class BaseRequest {
     kAllocateSharedBlock = 11,
     kFreeSharedBlock = 12,
     kStopService = 13,
+    kPrefetchRows = 14,
+    kListSessions = 15,
     // Add new request before it.
     kRequestUnknown = 32767
   };
@@ -191,6 +204,14 @@ class BatchFetchRequest : public BaseRequest {
   std::vector<row_id_type> row_id_;
 };
 
+/// \brief Request to read ahead rows which will be fetched soon. The client doesn't wait for the reply.
+class PrefetchRowsRequest : public BaseRequest {
+ public:
+  friend class CacheServer;
+  PrefetchRowsRequest(connection_id_type connection_id, const std::vector<row_id_type> &row_id);
+  ~PrefetchRowsRequest() = default;
+};
+
 /// \brief Request to create a cache for the current connection
 class CreateCacheRequest : public BaseRequest {
  public:
@@ -349,6 +370,25 @@ class AllocateSharedBlockRequest : public BaseRequest {
   }
 };
 
+/// \brief Obtain the statistics of all the caches in the server
+class ListSessionsRequest : public BaseRequest {
+ public:
+  friend class CacheServer;
+  ListSessionsRequest() : BaseRequest(RequestType::kListSessions) {
+    // No connection id is needed. We will manually set it to 0.
+    rq_.set_connection_id(0);
+  }
+  ~ListSessionsRequest() = default;
+
+  /// \brief Override base function to process the result.
+  Status PostReply() override;
+
+  const std::vector<CacheSessionStat> &GetSessionStats() const { return session_stats_; }
+
+ private:
+  std::vector<CacheSessionStat> session_stats_;
+};
+
 class ShutdownRequest : public BaseRequest {
  public:
   friend class CacheServer;
@@ -325,6 +325,22 @@ Status CacheServer::BatchFetchRows(CacheService *cs, CacheRequest *rq, CacheRepl
   return Status::OK();
 }
 
+inline flatbuffers::Offset<ServiceStatMsg> BuildServiceStatMsg(const CacheService::ServiceStat &svc_stat,
+                                                                flatbuffers::FlatBufferBuilder *fbb) {
+  ServiceStatMsgBuilder bld(*fbb);
+  bld.add_num_disk_cached(svc_stat.stat_.num_disk_cached);
+  bld.add_num_mem_cached(svc_stat.stat_.num_mem_cached);
+  bld.add_avg_cache_sz(svc_stat.stat_.average_cache_sz);
+  bld.add_max_row_id(svc_stat.max_);
+  bld.add_min_row_id(svc_stat.min_);
+  bld.add_state(svc_stat.state_);
+  bld.add_num_mem_hit(svc_stat.stat_.num_mem_hit);
+  bld.add_num_disk_hit(svc_stat.stat_.num_disk_hit);
+  bld.add_num_promoted(svc_stat.stat_.num_promoted);
+  bld.add_num_evicted(svc_stat.stat_.num_evicted);
+  return bld.Finish();
+}
+
 inline Status GetStat(CacheService *cs, CacheRequest *rq, CacheReply *reply) {
   auto connection_id = rq->connection_id();
   if (cs == nullptr) {
@@ -334,20 +350,50 @@ inline Status GetStat(CacheService *cs, CacheRequest *rq, CacheReply *reply) {
     CacheService::ServiceStat svc_stat;
     RETURN_IF_NOT_OK(cs->GetStat(&svc_stat));
     flatbuffers::FlatBufferBuilder fbb;
-    ServiceStatMsgBuilder bld(fbb);
-    bld.add_num_disk_cached(svc_stat.stat_.num_disk_cached);
-    bld.add_num_mem_cached(svc_stat.stat_.num_mem_cached);
-    bld.add_avg_cache_sz(svc_stat.stat_.average_cache_sz);
-    bld.add_max_row_id(svc_stat.max_);
-    bld.add_min_row_id(svc_stat.min_);
-    bld.add_state(svc_stat.state_);
-    auto offset = bld.Finish();
+    auto offset = BuildServiceStatMsg(svc_stat, &fbb);
     fbb.Finish(offset);
     reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
   }
   return Status::OK();
 }
 
+Status CacheServer::ListSessions(CacheReply *reply) {
+  SharedLock lck(&rwLock_);
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<ListSessionMsg>> session_msgs;
+  for (auto &cs : all_caches_) {
+    CacheService::ServiceStat svc_stat;
+    RETURN_IF_NOT_OK(cs.second->GetStat(&svc_stat));
+    auto stat_off = BuildServiceStatMsg(svc_stat, &fbb);
+    ListSessionMsgBuilder bld(fbb);
+    bld.add_session_id(GetSessionID(cs.first));
+    bld.add_connection_id(cs.first);
+    bld.add_stats(stat_off);
+    session_msgs.push_back(bld.Finish());
+  }
+  auto sessions_off = fbb.CreateVector(session_msgs);
+  ListSessionsMsgBuilder bld(fbb);
+  bld.add_sessions(sessions_off);
+  fbb.Finish(bld.Finish());
+  reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
+  return Status::OK();
+}
+
+inline Status PrefetchRows(CacheService *cs, CacheRequest *rq) {
+  auto connection_id = rq->connection_id();
+  if (cs == nullptr) {
+    std::string errMsg = "Cache id " + std::to_string(connection_id) + " not found";
+    return Status(StatusCode::kUnexpectedError, __LINE__, __FILE__, errMsg);
+  } else {
+    CHECK_FAIL_RETURN_UNEXPECTED(!rq->buf_data().empty(), "Missing row id");
+    auto &row_id_buf = rq->buf_data(0);
+    auto p = flatbuffers::GetRoot<TensorRowIds>(row_id_buf.data());
+    std::vector<row_id_type> row_id(p->row_id()->begin(), p->row_id()->end());
+    RETURN_IF_NOT_OK(cs->PrefetchRows(row_id));
+  }
+  return Status::OK();
+}
+
 inline Status CacheSchema(CacheService *cs, CacheRequest *rq) {
   auto connection_id = rq->connection_id();
   if (cs == nullptr) {
@@ -493,6 +539,14 @@ Status CacheServer::ServerRequest(int32_t worker_id) {
         cache_req->rc_ = FreeSharedMemory(&rq);
         break;
       }
+      case BaseRequest::RequestType::kPrefetchRows: {
+        cache_req->rc_ = PrefetchRows(cs, &rq);
+        break;
+      }
+      case BaseRequest::RequestType::kListSessions: {
+        cache_req->rc_ = ListSessions(&reply);
+        break;
+      }
       case BaseRequest::RequestType::kStopService: {
         // This command shutdowns everything.
         cache_req->rc_ = GlobalShutdown();
@@ -231,6 +231,11 @@ class CacheServer : public Service {
   /// \return
   Status BatchFetchRows(CacheService *cs, CacheRequest *rq, CacheReply *reply);
 
+  /// \brief Handle kListSessions request
+  /// \param reply CacheReply
+  /// \return Status object
+  Status ListSessions(CacheReply *reply);
+
   /// \brief A proper shutdown of the server
   /// \return Status object
   Status GlobalShutdown();
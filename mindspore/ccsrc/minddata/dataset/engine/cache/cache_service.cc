@@ -252,6 +252,26 @@ Status CacheService::BatchFetch(const std::vector<row_id_type> &v, const std::ve
   }
   return Status::OK();
 }
+Status CacheService::PrefetchRows(const std::vector<row_id_type> &v) {
+  SharedLock rw(&rw_lock_);
+  // Nothing is on disk without a spill path, and rows can't be fetched yet in the build phase.
+  if (root_.empty() || st_ == State::kBuildPhase) {
+    return Status::OK();
+  }
+  for (auto row_id : v) {
+    auto r = map_->Search(row_id);
+    if (r.second) {
+      Status rc = cp_->Promote(r.first.value());
+      if (rc.IsOutofMemory()) {
+        // The row can't fit in memory and will be read from disk. It is only a hint, so this is not an error.
+        MS_LOG(DEBUG) << "Not enough memory to prefetch row id " << row_id;
+        break;
+      }
+      RETURN_IF_NOT_OK(rc);
+    }
+  }
+  return Status::OK();
+}
 Status CacheService::CacheSchema(const void *buf, int64_t len) {
   SharedLock rw(&rw_lock_);
   if (st_ == State::kFetchPhase) {
@@ -90,6 +90,12 @@ class CacheService : public Service {
   /// \return Status object
   Status BatchFetch(const std::vector<row_id_type> &v, const std::vector<key_size_pair> &, WritableSlice *out) const;
 
+  /// \brief Read ahead the rows which will be fetched soon. Rows spilled to disk are brought back to memory, and
+  /// the least recently used rows in memory are evicted to disk to make room.
+  /// \param[in] v A vector of row id.
+  /// \return Status object
+  Status PrefetchRows(const std::vector<row_id_type> &v);
+
   /// \brief Getter function
   /// \return Spilling path
   Path GetSpillPath() const;
@@ -174,6 +174,16 @@ class Connector {
     return capacity;
   }
 
+  // Change the capacity of every internal queue while the pipeline is running.
+  // @param queue_capacity The new number of elements for each queue.
+  // @return Status The error code return
+  Status SetQueueCapacity(int32_t queue_capacity) {
+    for (int32_t i = 0; i < queues_.size(); ++i) {
+      RETURN_IF_NOT_OK(queues_[i]->Resize(queue_capacity));
+    }
+    return Status::OK();
+  }
+
   // Register the internal resources with Task group for interruption service.
   // @param vg
   // @return
@@ -122,7 +122,9 @@ DatasetIterator::DatasetIterator(std::shared_ptr<ExecutionTree> exe_tree)
       tracing_(nullptr),
       cur_batch_num_(0),
       cur_connector_size_(0),
-      cur_connector_capacity_(0) {
+      cur_connector_capacity_(0),
+      cur_epoch_(exe_tree->resume_epoch()),
+      cur_row_(exe_tree->resume_row()) {
   std::shared_ptr<Tracing> node;
   Status s = exe_tree->GetProfilingManager()->GetTracingNode(kDatasetIteratorTracingName, &node);
   if (s.IsOk()) {
@@ -163,6 +165,8 @@ Status DatasetIterator::FetchNextTensorRow(TensorRow *out_row) {
     if (curr_buffer_->eoe()) {
       MS_LOG(INFO) << "End of data iteration.";
       curr_buffer_.reset();  // explicitly free the eoe buffer
+      cur_epoch_++;
+      cur_row_ = 0;
       if (isProfilingEnable) {
         root_->Tree()->SetEpochEnd();
       }
@@ -183,6 +187,7 @@ Status DatasetIterator::FetchNextTensorRow(TensorRow *out_row) {
 
   // If we got this far, now it's time to pop that next row for return to caller
   RETURN_IF_NOT_OK(curr_buffer_->PopRow(out_row));
+  cur_row_++;
   if (tracing_ != nullptr) {
     cur_batch_num_++;
     tracing_->Record(CONNECTOR_DEPTH, cur_connector_capacity_, cur_batch_num_, cur_connector_size_);
@@ -114,6 +114,10 @@ class DatasetIterator : public IteratorBase {
   // @return The string to column id mapping.
   std::unordered_map<std::string, int32_t> GetColumnNameMap() const override;
 
+  // Getter functions for the position of the consumer: the current epoch and the rows fetched from it
+  int64_t cur_epoch() const { return cur_epoch_; }
+  int64_t cur_row() const { return cur_row_; }
+
  private:
   std::shared_ptr<DatasetOp> root_;  // saves the root of the executionTree
   TensorRow device_queue_row_;
@@ -121,6 +125,8 @@ class DatasetIterator : public IteratorBase {
   int32_t cur_batch_num_;                            // current batch number,used for profiling
   int32_t cur_connector_size_;                       // current connector size of root op,used for profiling
   int32_t cur_connector_capacity_;                   // current connector capacity of root op, used for profiling
+  int64_t cur_epoch_;                                // current epoch, used for saving the pipeline state
+  int64_t cur_row_;                                  // rows fetched from the current epoch
 };
 
 // The ChildIterator derived class is for fetching rows from intermediate nodes of execution tree.
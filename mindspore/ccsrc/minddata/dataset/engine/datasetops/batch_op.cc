@@ -172,39 +172,21 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, const std::u
 
   TensorRow batched_row;
   auto num_columns = (*src)->front().size();
+  std::vector<std::shared_ptr<Tensor>> column(batch_size);
   for (size_t i = 0; i < num_columns; i++) {
-    std::shared_ptr<Tensor> first_tensor = (*src)->at(0).at(i);  // first row, column i
-    TensorShape first_shape = first_tensor->shape();
-    DataType first_type = first_tensor->type();
-    TensorShape new_shape = first_shape.PrependDim(static_cast<int64_t>(batch_size));
-
-    std::shared_ptr<Tensor> new_tensor;
-    if (first_type.IsNumeric()) {  // numeric tensor
-      RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
-      dsize_t j = 0;
-      for (auto row : **src) {
-        std::shared_ptr<Tensor> old_tensor = row.at(i);  // row j, column i
-        if (old_tensor->shape() == first_shape) {        // check the newly popped rows have the same dim as the first
-          if (new_shape.NumOfElements() != 0) {
-            RETURN_IF_NOT_OK(new_tensor->InsertTensor({j++}, old_tensor));
-          }
-          // Don't do anything if the tensor has no data
-        } else {
-          RETURN_STATUS_UNEXPECTED(
-            "Invalid data, expect same shape for each data row, but got inconsistent data shapes in column " +
-            std::to_string(i));
-        }
+    const TensorShape &first_shape = (*src)->at(0).at(i)->shape();  // first row, column i
+    for (dsize_t j = 0; j < batch_size; j++) {
+      column[j] = (*src)->at(j).at(i);  // row j, column i
+      // check the newly popped rows have the same dim as the first
+      if (column[j]->shape() != first_shape) {
+        RETURN_STATUS_UNEXPECTED(
+          "Invalid data, expect same shape for each data row, but got inconsistent data shapes in column " +
+          std::to_string(i));
       }
-    } else {  // handle string column differently
-      std::vector<std::string> strings;
-      for (dsize_t j = 0; j < batch_size; j++) {
-        std::shared_ptr<Tensor> old_tensor = (*src)->at(j).at(i);
-        for (auto itr = old_tensor->begin<std::string_view>(); itr != old_tensor->end<std::string_view>(); itr++) {
-          strings.emplace_back(*itr);
-        }
-      }
-      RETURN_IF_NOT_OK(Tensor::CreateFromVector(strings, new_shape, &new_tensor));
     }
+    // The rows are copied into the batch with one memcpy each, at offsets computed once for the column.
+    std::shared_ptr<Tensor> new_tensor;
+    RETURN_IF_NOT_OK(Tensor::CreateFromTensors(column, &new_tensor));
     batched_row.emplace_back(new_tensor);
   }
 
@@ -468,5 +450,20 @@ Status BatchOp::Accept(NodePass *p, bool *modified) {
   return p->RunOnNode(shared_from_base<BatchOp>(), modified);
 }
 
+// The child resumes at the first row of the batch to resume at
+Status BatchOp::SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) {
+#ifdef ENABLE_PYTHON
+  CHECK_FAIL_RETURN_UNEXPECTED(!batch_size_func_,
+                               "Invalid operation, BatchOp with a batch size function can not save its state.");
+#endif
+  CHECK_FAIL_RETURN_UNEXPECTED(point.pending.empty(), "Invalid operation, BatchOp can not resume at pending rows.");
+  child_point->epoch = point.epoch;
+  child_point->pending.clear();
+  child_point->next = point.next * start_batch_size_;
+  return Status::OK();
+}
+
+Status BatchOp::RestoreState(const nlohmann::json &state) { return Status::OK(); }
+
 }  // namespace dataset
 }  // namespace mindspore
@@ -232,6 +232,7 @@ Status CacheBase::Dispatcher() {
       keys.push_back(*itr);
       ++num_row;
       if (num_row % prefetch_size_ == 0) {
+        RETURN_IF_NOT_OK(ReadAhead(keys));
         auto blk = std::make_unique<IOBlock>(IOBlock(keys, IOBlock::kDeIoBlockNone));
         RETURN_IF_NOT_OK(prefetch_queues_[buf_cnt++ % num_workers_]->Add(std::move(blk)));
         keys.clear();
@@ -239,6 +240,7 @@ Status CacheBase::Dispatcher() {
     }
     // Send the remaining sample id
     if (!keys.empty()) {
+      RETURN_IF_NOT_OK(ReadAhead(keys));
       auto blk = std::make_unique<IOBlock>(IOBlock(keys, IOBlock::kDeIoBlockNone));
       RETURN_IF_NOT_OK(prefetch_queues_[buf_cnt++ % num_workers_]->Add(std::move(blk)));
     }
@@ -246,6 +248,15 @@ Status CacheBase::Dispatcher() {
   return Status::OK();
 }
 
+Status CacheBase::ReadAhead(const std::vector<row_id_type> &keys) {
+  // Only a cache which spills to disk has rows to bring back to memory. The prefetch queues are
+  // in front of these rows, so the server has some time to read them before we fetch them.
+  if (cache_client_->isSpill()) {
+    RETURN_IF_NOT_OK(cache_client_->PrefetchRows(keys));
+  }
+  return Status::OK();
+}
+
 Status CacheBase::Prefetcher(int32_t worker_id) {
   TaskManager::FindMe()->Post();
   std::vector<row_id_type> prefetch_keys;
@@ -118,6 +118,9 @@ class CacheBase : public ParallelOp {
   /// \brief Prefetcher. It prefetch the rows from cache server
   /// \return Status object.
   Status Prefetcher(int32_t worker_id);
+  /// \brief Ask the cache server to read ahead the rows of a block before it is fetched
+  /// \return Status object.
+  Status ReadAhead(const std::vector<row_id_type> &keys);
 };
 }  // namespace dataset
 }  // namespace mindspore
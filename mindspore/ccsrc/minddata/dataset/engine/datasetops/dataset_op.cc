@@ -219,6 +219,17 @@ void DatasetOp::CreateConnector(int32_t num_producers, int32_t num_consumers) {
   }
 }
 
+// Change the capacity of each queue in the output connector while the tree is running
+Status DatasetOp::SetConnectorQueueSize(int32_t queue_size) {
+  if (out_connector_ == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Operator " + std::to_string(operator_id_) + " has no output connector to resize.");
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(queue_size > 0, "Connector queue size must be positive.");
+  RETURN_IF_NOT_OK(out_connector_->SetQueueCapacity(queue_size));
+  oc_queue_size_ = queue_size;
+  return Status::OK();
+}
+
 // A print method typically used for debugging.  showAll of true will recursively descend to child prints
 void DatasetOp::Print(std::ostream &out, bool show_all) const {
   // When show_all is false, we display a 1 liner piece of text for the op.
@@ -337,6 +348,23 @@ Status DatasetOp::Reset() {
   return Status::OK();
 }
 
+// Saves the state to restore the operator with. Only a leaf with a sampler can resume by default, its
+// sampler skips the rows before the resume point so that they are never read.
+Status DatasetOp::SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) {
+  if (!IsLeaf() || sampler_ == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Invalid operation, " + Name() + " does not support saving its state.");
+  }
+  return sampler_->SaveState(point, state);
+}
+
+// Restores a state saved by SaveState().
+Status DatasetOp::RestoreState(const nlohmann::json &state) {
+  if (!IsLeaf() || sampler_ == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Invalid operation, " + Name() + " does not support restoring its state.");
+  }
+  return sampler_->RestoreState(state);
+}
+
 // gives a string output for the column map for handy debug printing
 std::string DatasetOp::ColumnNameMapAsString() const {
   std::string outStr = "Column name id map: ";
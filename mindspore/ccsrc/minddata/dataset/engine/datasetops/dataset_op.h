@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <nlohmann/json.hpp>
 #include "minddata/dataset/callback/callback_manager.h"
 #include "minddata/dataset/core/constants.h"
 #include "minddata/dataset/engine/db_connector.h"
@@ -58,6 +59,15 @@ constexpr char kZipOp[] = "ZipOp";
 // Forward declare
 class ExecutionTree;
 
+/// \brief The position within an epoch at which an operator resumes producing rows after a restore.
+/// The operator first produces the rows at the positions in pending, in that order, then every row from
+/// position next to the end of the epoch. Positions count the rows of the epoch from 0.
+struct ResumePoint {
+  int64_t epoch = 0;
+  std::vector<int64_t> pending;
+  int64_t next = 0;
+};
+
 class DataBuffer;
 
 class NodePass;
@@ -198,6 +208,20 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   /// \return Status - The error code return
   virtual Status Reset();
 
+  /// \brief Saves the state the operator must be restored with so that it resumes at a given position.
+  /// The base class implementation hands the position to the sampler of a leaf operator, and fails for
+  /// any other operator. Derived classes which can resume override it.
+  /// \param[in] point - The position at which the parent of this operator resumes
+  /// \param[out] state - The state of this operator
+  /// \param[out] child_point - The position at which the child of this operator has to resume
+  /// \return Status - The error code return
+  virtual Status SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point);
+
+  /// \brief Restores a state saved by SaveState(). Called after the tree is prepared and before it is launched.
+  /// \param[in] state - The state of this operator
+  /// \return Status - The error code return
+  virtual Status RestoreState(const nlohmann::json &state);
+
   /// \brief During tree prepare phase, operators may have specific pre-operations to perform depending on
   /// their role.
   /// \notes Derived versions of this function should always call it's superclass version first
@@ -293,6 +317,15 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
     return ChildOpConnectorCapacity();
   }
 
+  /// \brief Getter function
+  /// \return The capacity of each queue in the output connector, 0 for an inlined op
+  int32_t connector_queue_size() const { return oc_queue_size_; }
+
+  /// \brief Change the capacity of each queue in the output connector while the tree is running
+  /// \param[in] queue_size The new capacity of each queue
+  /// \return Status
+  Status SetConnectorQueueSize(int32_t queue_size);
+
   /// \brief Getter function
   /// \return connector size of child op
   int32_t ChildOpConnectorSize(int32_t child_index = 0) const { return child_[child_index]->ConnectorSize(); }
@@ -360,6 +393,13 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   /// \return boolean returns true if it's last iteration
   bool IsLastIteration() { return op_total_repeats_ == op_current_repeats_ + 1; }
 
+  /// Sets the repeat and epoch counters as if the operator had already handled the given number of epochs
+  /// \param[in] epoch - The number of epochs handled
+  void SetCurrentEpoch(int32_t epoch) {
+    op_current_epochs_ = epoch;
+    op_current_repeats_ = epoch * op_num_repeats_per_epoch_;
+  }
+
   /// This function is only intended to be called by CallbackManager within the master thread of ParallelOp
   /// The expected behavior is this, when this function is invoked, this function will block until all the workers
   /// have finished their remaining work and go to sleep. Since all ParallelOps use a QueueList to sync with master.
@@ -104,6 +104,19 @@ Status EpochCtrlOp::EoeReceived(int32_t worker_id) {
   return Status::OK();
 }
 
+// Saves the number of epochs done so that the op still stops after the same total
+Status EpochCtrlOp::SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) {
+  (*state)["epoch"] = point.epoch;
+  *child_point = point;
+  return Status::OK();
+}
+
+Status EpochCtrlOp::RestoreState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(state.count("epoch") != 0, "Invalid data, the state of EpochCtrlOp has no epoch.");
+  repeat_count_ = state["epoch"].get<int32_t>();
+  return Status::OK();
+}
+
 // Pre-Visitor accept method for NodePass
 Status EpochCtrlOp::PreAccept(NodePass *p, bool *modified) {
   // Downcast shared pointer then call the pre-visitation
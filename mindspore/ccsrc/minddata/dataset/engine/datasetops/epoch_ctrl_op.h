@@ -65,6 +65,14 @@ class EpochCtrlOp : public RepeatOp {
   // @param worker_id - The worker id
   Status EoeReceived(int32_t worker_id) override;
 
+  // Base-class override, saves the number of epochs done so that the op still stops after the same total
+  // @return Status - The error code return
+  Status SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) override;
+
+  // Base-class override, restores the number of epochs done
+  // @return Status - The error code return
+  Status RestoreState(const nlohmann::json &state) override;
+
   /// \brief Base-class override for NodePass pre-visit acceptor
   /// \param[in] p The node to visit
   /// \param[out] modified Indicator if the node was modified
@@ -66,11 +66,64 @@ MapOp::MapOp(const std::vector<std::string> &in_col_names, const std::vector<std
     : ParallelOp(num_workers, op_connector_size),
       tfuncs_(std::move(tensor_funcs)),
       in_columns_(in_col_names),
-      out_columns_(out_col_names) {
+      out_columns_(out_col_names),
+      keep_order_(true) {
   // If caller didn't specify the out_col_names, assume they are same as the in_columns.
   if (out_columns_.empty() || out_columns_[0].empty()) {
     out_columns_ = in_columns_;
   }
+  num_active_workers_ = num_workers_;
+  requested_workers_ = num_workers_;
+  // Autotune may give this op more workers later, so launch as many threads as the budget allows.
+  std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+  if (cfg->enable_autotune()) {
+    num_workers_ = std::max(num_workers_, cfg->autotune_cpu_budget());
+    num_producers_ = num_workers_;
+  }
+}
+
+// Ask the master thread to hand work to a different number of workers
+void MapOp::RequestActiveWorkers(int32_t num_workers) {
+  requested_workers_ = std::min(std::max(num_workers, 1), num_workers_);
+}
+
+// The output connector only pops from the active workers.
+Status MapOp::PrepareNodePostAction() {
+  RETURN_IF_NOT_OK(ParallelOp::PrepareNodePostAction());
+  if (out_connector_) {
+    out_connector_->SetActiveProducers(num_active_workers_);
+    // The unordered connector only supports a single consumer.
+    std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+    if (!cfg->deterministic_order() && (parent_.empty() || parent_[0]->num_consumers() == 1)) {
+      keep_order_ = false;
+      out_connector_->SetUnordered();
+    }
+  }
+  return Status::OK();
+}
+
+int32_t MapOp::NextWorkerId(int64_t *num_buf) {
+  int32_t num_active = num_active_workers_;
+  int32_t worker_id = static_cast<int32_t>((*num_buf)++ % num_active);
+  if (!keep_order_) {
+    for (int32_t i = 0; i < num_active; i++) {
+      if (local_queues_[i]->size() < local_queues_[worker_id]->size()) {
+        worker_id = i;
+      }
+    }
+  }
+  return worker_id;
+}
+
+Status MapOp::SendControlBuffer(std::unique_ptr<DataBuffer> buff, int64_t *num_buf) {
+  if (keep_order_) {
+    return local_queues_[NextWorkerId(num_buf)]->Add(std::make_unique<MapWorkerJob>(std::move(buff)));
+  }
+  for (int32_t wkr_id = 0; wkr_id < num_active_workers_; wkr_id++) {
+    auto worker_job = std::make_unique<MapWorkerJob>(std::make_unique<DataBuffer>(0, buff->buffer_flags()));
+    RETURN_IF_NOT_OK(local_queues_[wkr_id]->Add(std::move(worker_job)));
+  }
+  return Status::OK();
 }
 
 // The number of threads consuming data from previous op's output Connector.
@@ -176,7 +229,7 @@ Status MapOp::operator()() {
   TaskManager::FindMe()->Post();
   RETURN_IF_NOT_OK(rc);
   // num_buffers received, including eoe, num_epoch, num_step of current epoch
-  int64_t num_buf = 0, ep_step = 0, total_step = 0;
+  int64_t num_buf = 0, ep_step = 0, total_step = 0, num_eoe = 0;
 
   RETURN_IF_NOT_OK(callback_manager_.Begin(CallbackParam(0, ep_step, total_step)));
 
@@ -200,7 +253,7 @@ Status MapOp::operator()() {
       RETURN_IF_NOT_OK(GenerateWorkerJob(&worker_job));
 
       // Push map worker job to the corresponding worker's queue
-      RETURN_IF_NOT_OK(local_queues_[num_buf++ % num_workers_]->Add(std::move(worker_job)));
+      RETURN_IF_NOT_OK(local_queues_[NextWorkerId(&num_buf)]->Add(std::move(worker_job)));
 
       RETURN_IF_NOT_OK(callback_manager_.StepEnd(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
 
@@ -213,16 +266,28 @@ Status MapOp::operator()() {
 
       ep_step = 0;
     }
+    // A new number of active workers is applied at the eoe. The switch is scheduled in the output connector
+    // before the eoe is sent, so the consumer cannot pop the eoe before it knows about the switch.
+    int32_t num_requested = requested_workers_;
+    bool switch_workers = (num_requested != num_active_workers_);
+    if (switch_workers) {
+      RETURN_IF_NOT_OK(out_connector_->SwitchActiveProducers(num_eoe + 1, num_requested));
+    }
     // Propagate the eoe buffer to worker
-    std::unique_ptr<MapWorkerJob> worker_job = std::make_unique<MapWorkerJob>(std::move(buff));
-    RETURN_IF_NOT_OK(local_queues_[num_buf++ % num_workers_]->Add(std::move(worker_job)));
+    RETURN_IF_NOT_OK(SendControlBuffer(std::move(buff), &num_buf));
+    num_eoe++;
+    if (switch_workers) {
+      MS_LOG(INFO) << "MapOp " << operator_id_ << " switches from " << num_active_workers_ << " to " << num_requested
+                   << " active workers.";
+      num_active_workers_ = num_requested;
+      num_buf = 0;
+    }
     UpdateRepeatAndEpochCounter();
     RETURN_IF_NOT_OK(child_[0]->GetNextBuffer(&buff, 0));
   }
   // End() is commented out because it might never be called due to the lack of EOF when EpochCtrl is -1
   // Handle eof logic, this code might never be reached if epoch_ctrl = -1.
-  std::unique_ptr<MapWorkerJob> worker_job = std::make_unique<MapWorkerJob>(std::move(buff));
-  RETURN_IF_NOT_OK(local_queues_[num_buf++ % num_workers_]->Add(std::move(worker_job)));
+  RETURN_IF_NOT_OK(SendControlBuffer(std::move(buff), &num_buf));
 
   // Quit all workers, this code might never be reached if EpochCtrl is -1.
   for (int32_t wkr_id = 0; wkr_id < num_workers_; wkr_id++) {
@@ -458,6 +523,17 @@ Status MapOp::Accept(NodePass *p, bool *modified) {
   return p->RunOnNode(shared_from_base<MapOp>(), modified);
 }
 
+// The op keeps one row per row of its child, in the same order unless it runs unordered
+Status MapOp::SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) {
+  CHECK_FAIL_RETURN_UNEXPECTED(keep_order_,
+                               "Invalid operation, MapOp does not keep the order of its rows and can not save its "
+                               "state, set_deterministic_order(True) is needed.");
+  *child_point = point;
+  return Status::OK();
+}
+
+Status MapOp::RestoreState(const nlohmann::json &state) { return Status::OK(); }
+
 Status MapOp::WaitForWorkers() {
   // reset num_paused workers to 0
   num_workers_paused_ = 0;
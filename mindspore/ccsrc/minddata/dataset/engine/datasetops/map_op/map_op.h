@@ -177,12 +177,25 @@ class MapOp : public ParallelOp {
   // @return the number of threads consuming data from previous op's output Connector.
   int32_t num_consumers() const override;
 
+  // Base-class override to tell the output connector how many workers are active.
+  // @return Status The error code return
+  Status PrepareNodePostAction() override;
+
   // Base-class override for NodePass visitor acceptor.
   // @param p - Pointer to the NodePass to be accepted.
   // @param modified - Whether this node visit modified the pipeline.
   // @return - Status of the node visit.
   Status Accept(NodePass *p, bool *modified) override;
 
+  // Base-class override, the op keeps one row per row of its child, in the same order unless the op runs
+  // unordered, which can not be resumed
+  // @return Status - The error code return
+  Status SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) override;
+
+  // Base-class override, the op has no state of its own
+  // @return Status - The error code return
+  Status RestoreState(const nlohmann::json &state) override;
+
   // Op name getter
   // @return Name of the current Op
   std::string Name() const override { return kMapOp; }
@@ -194,6 +207,19 @@ class MapOp : public ParallelOp {
 
   const auto &TFuncs() const { return tfuncs_; }
 
+  // Getter
+  // @return The number of workers the master thread hands work to, at most num_workers().
+  int32_t num_active_workers() const { return num_active_workers_; }
+
+  // Getter
+  // @return The number of active workers asked for by RequestActiveWorkers().
+  int32_t requested_workers() const { return requested_workers_; }
+
+  // Ask the master thread to hand work to a different number of workers. The change takes effect at the
+  // next eoe, where the output connector switches its round robin at the same buffer.
+  // @param num_workers - The number of active workers, clamped to [1, num_workers()].
+  void RequestActiveWorkers(int32_t num_workers);
+
  private:
   // A unit of job for map worker thread.
   // MapWorkerJob holds a list of MapJob where each MapJob can be a CpuMapJob, GpuMapJob or DvppMapJob.
@@ -206,6 +232,19 @@ class MapOp : public ParallelOp {
   // A helper function to create jobs for workers.
   Status GenerateWorkerJob(const std::unique_ptr<MapWorkerJob> *worker_job);
 
+  // A helper function that picks the local queue of the next job. In order, the active workers take turns.
+  // Otherwise the active worker with the fewest jobs waiting gets it.
+  // @param num_buf - The number of jobs sent so far, incremented by one
+  // @return The id of the worker
+  int32_t NextWorkerId(int64_t *num_buf);
+
+  // A helper function that sends an eoe or eof to the workers. In order, the next worker forwards it.
+  // Otherwise every active worker forwards a copy and the output connector merges them into one.
+  // @param buff - The eoe or eof buffer
+  // @param num_buf - The number of jobs sent so far
+  // @return Status The error code return
+  Status SendControlBuffer(std::unique_ptr<DataBuffer> buff, int64_t *num_buf);
+
   // A helper function that fetch worker map job from local queues and extract the data and map job list
   Status FetchNextWork(uint32_t worker_id, std::unique_ptr<DataBuffer> *db,
                        std::vector<std::shared_ptr<MapJob>> *job_list);
@@ -234,6 +273,15 @@ class MapOp : public ParallelOp {
   // Count number of workers that have signaled master
   std::atomic_int num_workers_paused_;
 
+  // With autotune, num_workers_ threads are launched up front and only the first num_active_workers_ of them
+  // get work. The master thread moves num_active_workers_ to requested_workers_ at an eoe.
+  std::atomic_int num_active_workers_;
+  std::atomic_int requested_workers_;
+
+  // False when the rows do not need to keep their order, see ConfigManager::deterministic_order().
+  // The output connector then takes rows from whichever worker has one ready.
+  bool keep_order_;
+
   // Private function for worker/thread to loop continuously. It comprises the main
   // logic of MapOp: getting the data from previous Op, validating user specified column names,
   // applying a list of TensorOps to each of the data, process the results and then
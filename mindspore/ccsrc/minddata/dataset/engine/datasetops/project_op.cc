@@ -135,6 +135,14 @@ Status ProjectOp::Accept(NodePass *p, bool *modified) {
   return p->RunOnNode(shared_from_base<ProjectOp>(), modified);
 }
 
+// The op keeps one row per row of its child in the same order
+Status ProjectOp::SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) {
+  *child_point = point;
+  return Status::OK();
+}
+
+Status ProjectOp::RestoreState(const nlohmann::json &state) { return Status::OK(); }
+
 // Compute the column map and save it into our own column name map
 // We cannot use the super class ComputeColMap here because we're making a modification of the
 // map from the child map.
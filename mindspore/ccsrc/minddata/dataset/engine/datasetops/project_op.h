@@ -107,6 +107,14 @@ class ProjectOp : public PipelineOp {
   // @return - Status of the node visit.
   Status Accept(NodePass *p, bool *modified) override;
 
+  // Base-class override, the op keeps one row per row of its child in the same order
+  // @return Status - The error code return
+  Status SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) override;
+
+  // Base-class override, the op has no state of its own
+  // @return Status - The error code return
+  Status RestoreState(const nlohmann::json &state) override;
+
   // Op name getter
   // @return Name of the current Op
   std::string Name() const override { return kProjectOp; }
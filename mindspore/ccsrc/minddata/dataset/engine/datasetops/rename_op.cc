@@ -176,5 +176,13 @@ Status RenameOp::Accept(NodePass *p, bool *modified) {
   // Downcast shared pointer then call visitor
   return p->RunOnNode(shared_from_base<RenameOp>(), modified);
 }
+
+// The op keeps one row per row of its child in the same order
+Status RenameOp::SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) {
+  *child_point = point;
+  return Status::OK();
+}
+
+Status RenameOp::RestoreState(const nlohmann::json &state) { return Status::OK(); }
 }  // namespace dataset
 }  // namespace mindspore
@@ -23,6 +23,7 @@
 #include <iostream>
 #include <limits>
 #include <random>
+#include <sstream>
 #include <utility>
 
 #include "minddata/dataset/core/config_manager.h"
@@ -41,6 +42,7 @@ namespace dataset {
 constexpr int32_t ShuffleOp::kShuffleStateInit;
 constexpr int32_t ShuffleOp::kShuffleStateActive;
 constexpr int32_t ShuffleOp::kShuffleStateDrain;
+constexpr int64_t ShuffleOp::kNumKeptEpochs;
 
 // Builder constructor. Creates the builder object.
 ShuffleOp::Builder::Builder() : build_shuffle_size_(0), build_reshuffle_each_epoch_(true) {
@@ -77,7 +79,10 @@ ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_con
       rows_per_buffer_(rows_per_buffer),
       shuffle_buffer_(std::make_unique<TensorTable>()),
       shuffle_last_row_idx_(0),
-      shuffle_buffer_state_(kShuffleStateInit) {}
+      shuffle_buffer_state_(kShuffleStateInit),
+      epoch_(0),
+      epoch_rows_(0),
+      resumed_(false) {}
 
 // Private function to re-init the shuffle op for another epoch.  Shuffle op calls this by
 // itself rather than waiting for the reset driven from operators above it in the pipeline.
@@ -95,9 +100,29 @@ Status ShuffleOp::SelfReset() {
   buffer_counter_ = 0;
   shuffle_last_row_idx_ = 0;
   shuffle_buffer_state_ = kShuffleStateInit;
+  epoch_++;
+  epoch_rows_ = 0;
   return Status::OK();
 }
 
+// Private function to keep the random state at the start of the current epoch.
+void ShuffleOp::KeepEpochStart() {
+  std::ostringstream rng_state;
+  rng_state << rng_;
+  std::lock_guard<std::mutex> lock(epoch_states_mux_);
+  epoch_states_[epoch_].rng = rng_state.str();
+  // The consumer is at most a few epochs behind, older states are not needed anymore
+  while (epoch_states_.begin()->first + kNumKeptEpochs <= epoch_) {
+    (void)epoch_states_.erase(epoch_states_.begin());
+  }
+}
+
+// Private function to keep the number of rows the child produced in the current epoch, once it ended.
+void ShuffleOp::KeepEpochRows() {
+  std::lock_guard<std::mutex> lock(epoch_states_mux_);
+  epoch_states_[epoch_].num_rows = epoch_rows_;
+}
+
 // A print method typically used for debugging
 void ShuffleOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
@@ -125,12 +150,14 @@ Status ShuffleOp::AddRowToShuffleBuffer(TensorRow new_shuffle_row) {
   if (shuffle_last_row_idx_ < (shuffle_size_ - 1)) {
     shuffle_buffer_->push_back(std::move(new_shuffle_row));
     shuffle_last_row_idx_ = (shuffle_buffer_->size()) - 1;
+    epoch_rows_++;
   } else {
     if (!(*shuffle_buffer_)[shuffle_last_row_idx_].empty()) {
       return Status(StatusCode::kUnexpectedError, __LINE__, __FILE__,
                     "Last row of shuffle buffer should not be occupied!");
     }
     (*shuffle_buffer_)[shuffle_last_row_idx_] = std::move(new_shuffle_row);
+    epoch_rows_++;
   }
   return Status::OK();
 }
@@ -152,6 +179,11 @@ Status ShuffleOp::operator()() {
 
   // Main operator loop
   while (true) {
+    // The random state of the epoch a restore resumes in was restored along with the op
+    if (!resumed_) {
+      KeepEpochStart();
+    }
+
     // Do an initial populate of the shuffle buffer
     RETURN_IF_NOT_OK(InitShuffleBuffer());
 
@@ -210,6 +242,7 @@ Status ShuffleOp::operator()() {
           RETURN_IF_NOT_OK(AddRowToShuffleBuffer(std::move(new_row)));
         } else {
           shuffle_buffer_state_ = kShuffleStateDrain;
+          KeepEpochRows();
         }
       }
 
@@ -261,8 +294,17 @@ Status ShuffleOp::InitShuffleBuffer() {
   }
 
   if (new_row.empty()) {
+    // A restore at the end of an epoch resumes with no row left in it
+    if (resumed_) {
+      resumed_ = false;
+      shuffle_last_row_idx_ = -1;
+      shuffle_buffer_state_ = kShuffleStateDrain;
+      KeepEpochRows();
+      return Status::OK();
+    }
     RETURN_STATUS_UNEXPECTED("Unable to fetch a single row for shuffle buffer.");
   }
+  resumed_ = false;
 
   // Now fill the rest of the shuffle buffer until we are unable to get the next row or we reached
   // the desired shuffle buffer size.
@@ -282,6 +324,7 @@ Status ShuffleOp::InitShuffleBuffer() {
     // If init phase doesn't have more rows, then skip the active state and jump straight to the
     // shuffle buffer draining state
     shuffle_buffer_state_ = kShuffleStateDrain;
+    KeepEpochRows();
   }
 
   MS_LOG(DEBUG) << "Shuffle operator finished intializing the shuffle buffer.";
@@ -298,5 +341,74 @@ Status ShuffleOp::Accept(NodePass *p, bool *modified) {
   // Downcast shared pointer then call visitor
   return p->RunOnNode(shared_from_base<ShuffleOp>(), modified);
 }
+
+// The rows of an epoch are only identified by their position here, so the shuffle of the epoch can be replayed
+// cheaply from the random state it started with. The replay stops right after the row to resume at left the
+// buffer and before the buffer is refilled: the child resumes with the rows left in the buffer, in the order of
+// their slots, so that refilling the buffer at the start of the resumed epoch rebuilds the exact same buffer.
+Status ShuffleOp::SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) {
+  CHECK_FAIL_RETURN_UNEXPECTED(point.pending.empty(), "Invalid operation, ShuffleOp can not resume at pending rows.");
+  EpochState epoch_state;
+  {
+    std::lock_guard<std::mutex> lock(epoch_states_mux_);
+    auto itr = epoch_states_.find(point.epoch);
+    CHECK_FAIL_RETURN_UNEXPECTED(itr != epoch_states_.end(), "Invalid operation, ShuffleOp no longer keeps the state "
+                                                             "of epoch " + std::to_string(point.epoch) + ".");
+    epoch_state = itr->second;
+  }
+  std::mt19937_64 rng;
+  std::istringstream rng_state(epoch_state.rng);
+  rng_state >> rng;
+
+  const int64_t num_rows = epoch_state.num_rows < 0 ? std::numeric_limits<int64_t>::max() : epoch_state.num_rows;
+  std::vector<int64_t> buffer;
+  int64_t fetched = std::min(static_cast<int64_t>(shuffle_size_), num_rows);
+  for (int64_t pos = 0; pos < fetched; ++pos) {
+    buffer.push_back(pos);
+  }
+  for (int64_t row = 0; row < point.next; ++row) {
+    CHECK_FAIL_RETURN_UNEXPECTED(!buffer.empty(), "Invalid data, the row to resume at is beyond the epoch.");
+    // Same as the main loop: pick a slot, then move the last row into it
+    int64_t last = static_cast<int64_t>(buffer.size()) - 1;
+    int64_t random_slot = rng() % (last + 1);
+    buffer[random_slot] = buffer[last];
+    buffer.pop_back();
+    if (row + 1 < point.next && fetched < num_rows && buffer.size() + 1 == static_cast<size_t>(shuffle_size_)) {
+      buffer.push_back(fetched++);
+    }
+  }
+
+  std::ostringstream resumed_rng;
+  resumed_rng << rng;
+  (*state)["seed"] = shuffle_seed_;
+  (*state)["epoch"] = point.epoch;
+  (*state)["epoch_rng"] = epoch_state.rng;
+  (*state)["num_rows"] = epoch_state.num_rows;
+  (*state)["rng"] = resumed_rng.str();
+  // The rows left in the buffer were already counted as fetched, they are fetched again after the restore
+  (*state)["epoch_rows"] = fetched - static_cast<int64_t>(buffer.size());
+
+  child_point->epoch = point.epoch;
+  child_point->pending = std::move(buffer);
+  child_point->next = fetched;
+  return Status::OK();
+}
+
+Status ShuffleOp::RestoreState(const nlohmann::json &state) {
+  try {
+    shuffle_seed_ = state.at("seed").get<uint32_t>();
+    epoch_ = state.at("epoch").get<int64_t>();
+    epoch_rows_ = state.at("epoch_rows").get<int64_t>();
+    std::istringstream rng_state(state.at("rng").get<std::string>());
+    rng_state >> rng_;
+    std::lock_guard<std::mutex> lock(epoch_states_mux_);
+    epoch_states_[epoch_].rng = state.at("epoch_rng").get<std::string>();
+    epoch_states_[epoch_].num_rows = state.at("num_rows").get<int64_t>();
+  } catch (const std::exception &err) {
+    RETURN_STATUS_UNEXPECTED("Invalid data, failed to restore the state of ShuffleOp: " + std::string(err.what()));
+  }
+  resumed_ = true;
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
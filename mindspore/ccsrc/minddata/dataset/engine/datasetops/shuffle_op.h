@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <random>
 #include <string>
@@ -51,6 +52,9 @@ class ShuffleOp : public PipelineOp {
   // Shuffle buffer is in a state of being drained
   static constexpr int32_t kShuffleStateDrain = 2;
 
+  // The number of epochs whose random state is kept for saving the state of the op
+  static constexpr int64_t kNumKeptEpochs = 8;
+
  public:
   // The nested builder class inside of the ShuffleOp is used to help manage all of the arguments
   // for constructing it.  The shuffle op is fairly simple though, but the builder provides a
@@ -161,11 +165,27 @@ class ShuffleOp : public PipelineOp {
   // @return - Status of the node visit.
   Status Accept(NodePass *p, bool *modified) override;
 
+  // Base-class override. Replays the shuffle of the epoch on row positions to find the random state and
+  // the rows left in the shuffle buffer after the resumed row. The child resumes with those rows first.
+  // @return Status - The error code return
+  Status SaveState(const ResumePoint &point, nlohmann::json *state, ResumePoint *child_point) override;
+
+  // Base-class override, restores the random state
+  // @return Status - The error code return
+  Status RestoreState(const nlohmann::json &state) override;
+
   // Op name getter
   // @return Name of the current Op
   std::string Name() const override { return kShuffleOp; }
 
  private:
+  // The random state at the start of an epoch and the number of rows the child produced in it, -1 until the
+  // child reached the end of the epoch
+  struct EpochState {
+    std::string rng;
+    int64_t num_rows = -1;
+  };
+
   // Private function to add a new row to the shuffle buffer.
   // @return Status - The error code return
   Status AddRowToShuffleBuffer(TensorRow new_shuffle_row);
@@ -180,6 +200,12 @@ class ShuffleOp : public PipelineOp {
   // @return Status - The error code return
   Status SelfReset();
 
+  // Private function to keep the random state at the start of the current epoch.
+  void KeepEpochStart();
+
+  // Private function to keep the number of rows the child produced in the current epoch, once it ended.
+  void KeepEpochRows();
+
   int32_t shuffle_size_;  // User config for the size of the shuffle buffer (number of rows)
   uint32_t shuffle_seed_;
   bool reshuffle_each_epoch_;
@@ -197,6 +223,12 @@ class ShuffleOp : public PipelineOp {
   int32_t shuffle_buffer_state_;  // State tracking for the shuffle buffer phases of work
 
   std::unique_ptr<ChildIterator> child_iterator_;  // An iterator for fetching.
+
+  int64_t epoch_;                               // The number of epochs started
+  int64_t epoch_rows_;                          // The number of rows fetched from the child in the current epoch
+  bool resumed_;                                // T/F if the op was restored and did not start its first epoch yet
+  std::map<int64_t, EpochState> epoch_states_;  // The state of the last epochs, by epoch
+  std::mutex epoch_states_mux_;                 // Guards epoch_states_, which the consumer reads to save the state
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -126,6 +126,7 @@ MindRecordOp::MindRecordOp(int32_t num_mind_record_workers, int32_t rows_per_buf
       buffers_needed_(0),
       buf_cnt_(0),
       ended_worker_(0),
+      typed_labels_(false),
       num_padded_(num_padded),
       sample_json_(sample_json),
       sample_bytes_(sample_bytes) {
@@ -189,6 +190,15 @@ Status MindRecordOp::Init() {
     data_schema_ = std::move(tmp_schema);
   }
 
+  // Without blob columns the labels are read from the label pages straight into tensors
+  auto blob_fields = shard_reader_->GetBlobFields().second;
+  typed_labels_ = !load_all_cols && std::none_of(columns_to_load_.begin(), columns_to_load_.end(),
+                                                 [&blob_fields](const std::string &colname) {
+                                                   return std::find(blob_fields.begin(), blob_fields.end(), colname) !=
+                                                          blob_fields.end();
+                                                 });
+  shard_reader_->SetTypedLabels(typed_labels_);
+
   return Status::OK();
 }
 
@@ -264,11 +274,18 @@ Status MindRecordOp::GetBufferFromReader(std::unique_ptr<DataBuffer> *fetched_bu
                                          int32_t worker_id) {
   *fetched_buffer = std::make_unique<DataBuffer>(buffer_id, DataBuffer::kDeBFlagNone);
   std::unique_ptr<TensorQTable> tensor_table = std::make_unique<TensorQTable>();
+  std::vector<std::pair<const uint8_t *, uint64_t>> label_values;
   for (int32_t i = 0; i < rows_per_buffer_; ++i) {
     int32_t row_id = buffer_id * rows_per_buffer_ + i;
+    if (typed_labels_ && shard_reader_->GetLabelsById(row_id, columns_to_load_, &label_values) == MSRStatus::SUCCESS) {
+      TensorRow tensor_row;
+      RETURN_IF_NOT_OK(LoadLabelRow(&tensor_row, label_values));
+      tensor_table->push_back(std::move(tensor_row));
+      continue;
+    }
     auto rc = shard_reader_->GetNextById(row_id, worker_id);
     auto task_type = rc.first;
-    auto tupled_buffer = rc.second;
+    const auto &tupled_buffer = rc.second;
     if (task_type == mindrecord::TaskType::kPaddedTask) {
       TensorRow tensor_row;
       RETURN_IF_NOT_OK(LoadTensorRow(&tensor_row, {}, mindrecord::json(), task_type));
@@ -277,8 +294,8 @@ Status MindRecordOp::GetBufferFromReader(std::unique_ptr<DataBuffer> *fetched_bu
     if (tupled_buffer.empty()) break;
     if (task_type == mindrecord::TaskType::kCommonTask) {
       for (const auto &tupled_row : tupled_buffer) {
-        std::vector<uint8_t> columns_blob = std::get<0>(tupled_row);
-        mindrecord::json columns_json = std::get<1>(tupled_row);
+        const std::vector<uint8_t> &columns_blob = std::get<0>(tupled_row);
+        const mindrecord::json &columns_json = std::get<1>(tupled_row);
         TensorRow tensor_row;
         RETURN_IF_NOT_OK(LoadTensorRow(&tensor_row, columns_blob, columns_json, task_type));
         tensor_table->push_back(std::move(tensor_row));
@@ -364,6 +381,29 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
   return Status::OK();
 }
 
+Status MindRecordOp::LoadLabelRow(TensorRow *tensor_row,
+                                  const std::vector<std::pair<const uint8_t *, uint64_t>> &values) {
+  CHECK_FAIL_RETURN_UNEXPECTED(values.size() == columns_to_load_.size(),
+                               "Invalid data, failed to retrieve labels from mindrecord reader.");
+  for (uint32_t i_col = 0; i_col < columns_to_load_.size(); i_col++) {
+    std::shared_ptr<Tensor> tensor;
+    const ColDescriptor &column = data_schema_->column(i_col);
+    CHECK_FAIL_RETURN_UNEXPECTED(column.type().SizeInBytes() == values[i_col].second,
+                                 "Invalid data, label size of column: " + columns_to_load_[i_col] +
+                                   " does not match its type.");
+
+    // A label is one element, as a value decoded from json in LoadTensorRow
+    auto new_shape = TensorShape(std::vector<dsize_t>{1});
+    if (column.hasShape()) {
+      new_shape = TensorShape(column.shape());
+      RETURN_IF_NOT_OK(column.MaterializeTensorShape(1, &new_shape));
+    }
+    RETURN_IF_NOT_OK(Tensor::CreateFromMemory(new_shape, column.type(), values[i_col].first, &tensor));
+    tensor_row->push_back(std::move(tensor));
+  }
+  return Status::OK();
+}
+
 // Class functor operator () override.
 // All dataset ops operate by launching a thread (see ExecutionTree). This class functor will
 // provide the master loop that drives the logic for performing the work
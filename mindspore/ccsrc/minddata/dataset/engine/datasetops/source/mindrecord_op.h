@@ -223,6 +223,11 @@ class MindRecordOp : public ParallelOp {
   Status LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
                        const mindrecord::json &columns_json, const mindrecord::TaskType task_type);
 
+  // Puts the label values of a row, read from the label pages by the reader, into tensors
+  // @param tensor_row - the tensor row to put the values in
+  // @param values - the address and size of the value of each column to load
+  Status LoadLabelRow(TensorRow *tensor_row, const std::vector<std::pair<const uint8_t *, uint64_t>> &values);
+
   // Private function for computing the assignment of the column name map.
   // @return - Status
   Status ComputeColMap() override;
@@ -237,6 +242,7 @@ class MindRecordOp : public ParallelOp {
   int64_t buf_cnt_;                                        // Buffer counter
   int32_t num_rows_;                                       // One more than the last row id in the range for this cache
   std::atomic<int32_t> ended_worker_;
+  bool typed_labels_;  // only label columns are loaded, their values are read without json
 
   int64_t num_padded_;
   mindrecord::json sample_json_;
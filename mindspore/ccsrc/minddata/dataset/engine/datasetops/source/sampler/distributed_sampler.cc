@@ -27,7 +27,8 @@ DistributedSampler::DistributedSampler(int64_t num_samples, int64_t num_dev, int
                                        uint32_t seed, int64_t offset, bool even_dist)
     : Sampler(num_samples, std::numeric_limits<int64_t>::max()),
       cnt_(0),
-      seed_(seed == std::numeric_limits<uint32_t>::max() ? GetSeed() : seed),
+      start_seed_(seed == std::numeric_limits<uint32_t>::max() ? GetSeed() : seed),
+      seed_(start_seed_),
       device_id_(dev_id),
       num_devices_(num_dev),
       shuffle_(shuffle),
@@ -75,6 +76,11 @@ Status DistributedSampler::InitSampler() {
 }
 
 Status DistributedSampler::GetNextSample(std::unique_ptr<DataBuffer> *out_buffer) {
+  if (resume_buffer_ != nullptr) {
+    // The first buffer after a restore holds the ids of the rest of the resumed epoch
+    *out_buffer = std::move(resume_buffer_);
+    return Status::OK();
+  }
   if (cnt_ > samples_per_buffer_) {
     RETURN_STATUS_UNEXPECTED("Distributed Sampler Error");
   } else if (cnt_ == samples_per_buffer_ && (non_empty_ || !even_dist_)) {
@@ -157,6 +163,18 @@ Status DistributedSampler::ResetSampler() {
   return Status::OK();
 }
 
+Status DistributedSampler::SaveRandomState(nlohmann::json *state) const {
+  (*state)["seed"] = start_seed_;
+  return Status::OK();
+}
+
+Status DistributedSampler::RestoreRandomState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(state.count("seed") != 0, "Invalid data, the state of DistributedSampler has no seed.");
+  start_seed_ = state["seed"].get<uint32_t>();
+  seed_ = start_seed_;
+  return Status::OK();
+}
+
 void DistributedSampler::Print(std::ostream &out, bool show_all) const {
   out << "\nSampler: DistributedSampler";
   if (show_all) {
@@ -63,8 +63,15 @@ class DistributedSampler : public Sampler {
 
   void Print(std::ostream &out, bool show_all) const override;
 
+ protected:
+  /// \brief Saves the seed of the first epoch, the ids of every epoch are derived from it
+  Status SaveRandomState(nlohmann::json *state) const override;
+
+  Status RestoreRandomState(const nlohmann::json &state) override;
+
  private:
-  int64_t cnt_;  // number of samples that have already been filled in to buffer
+  int64_t cnt_;          // number of samples that have already been filled in to buffer
+  uint32_t start_seed_;  // the seed of the first epoch
   uint32_t seed_;
   int64_t device_id_;
   int64_t num_devices_;
@@ -25,13 +25,19 @@ namespace dataset {
 RandomSampler::RandomSampler(int64_t num_samples, bool replacement, bool reshuffle_each_epoch,
                              int64_t samples_per_buffer)
     : Sampler(num_samples, samples_per_buffer),
-      seed_(GetSeed()),
+      start_seed_(GetSeed()),
+      seed_(start_seed_),
       replacement_(replacement),
       next_id_(0),
       reshuffle_each_epoch_(reshuffle_each_epoch),
       dist(nullptr) {}
 
 Status RandomSampler::GetNextSample(std::unique_ptr<DataBuffer> *out_buffer) {
+  if (resume_buffer_ != nullptr) {
+    // The first buffer after a restore holds the ids of the rest of the resumed epoch
+    *out_buffer = std::move(resume_buffer_);
+    return Status::OK();
+  }
   if (next_id_ > num_samples_) {
     RETURN_STATUS_UNEXPECTED("RandomSampler Internal Error");
   } else if (next_id_ == num_samples_) {
@@ -115,6 +121,18 @@ Status RandomSampler::ResetSampler() {
   return Status::OK();
 }
 
+Status RandomSampler::SaveRandomState(nlohmann::json *state) const {
+  (*state)["seed"] = start_seed_;
+  return Status::OK();
+}
+
+Status RandomSampler::RestoreRandomState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(state.count("seed") != 0, "Invalid data, the state of RandomSampler has no seed.");
+  start_seed_ = state["seed"].get<uint32_t>();
+  seed_ = start_seed_;
+  return Status::OK();
+}
+
 void RandomSampler::Print(std::ostream &out, bool show_all) const {
   out << "\nSampler: RandomSampler";
   if (show_all) {
@@ -52,7 +52,14 @@ class RandomSampler : public Sampler {
 
   virtual void Print(std::ostream &out, bool show_all) const;
 
+ protected:
+  // Saves the seed of the first epoch, the ids of every epoch are derived from it
+  Status SaveRandomState(nlohmann::json *state) const override;
+
+  Status RestoreRandomState(const nlohmann::json &state) override;
+
  private:
+  uint32_t start_seed_;  // The seed of the first epoch
   uint32_t seed_;
   bool replacement_;
   std::vector<int64_t> shuffled_ids_;  // only used for NO REPLACEMENT
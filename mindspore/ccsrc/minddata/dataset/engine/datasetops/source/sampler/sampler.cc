@@ -16,6 +16,7 @@
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 
 #include <string>
+#include <vector>
 
 namespace mindspore {
 namespace dataset {
@@ -61,6 +62,10 @@ Status Sampler::HandshakeRandomAccessOp(const RandomAccessOp *op) {
   // Because some sampler only needs one of the arg (weighted_random_sampler)
   RETURN_IF_NOT_OK(InitSampler());  // init sampler after callback
 
+  if (resume_point_ != nullptr) {
+    RETURN_IF_NOT_OK(PrepareResume());
+  }
+
   return Status::OK();
 }
 
@@ -123,6 +128,88 @@ Status Sampler::GetAllIdsThenReset(py::array *data) {
 }
 #endif
 
+Status Sampler::SaveState(const ResumePoint &point, nlohmann::json *state) {
+  RETURN_UNEXPECTED_IF_NULL(state);
+  RETURN_IF_NOT_OK(SaveRandomState(state));
+  (*state)["epoch"] = point.epoch;
+  (*state)["pending"] = point.pending;
+  (*state)["next"] = point.next;
+  return Status::OK();
+}
+
+Status Sampler::RestoreState(const nlohmann::json &state) {
+  RETURN_IF_NOT_OK(RestoreRandomState(state));
+  try {
+    resume_point_ = std::make_unique<ResumePoint>();
+    resume_point_->epoch = state.at("epoch").get<int64_t>();
+    resume_point_->pending = state.at("pending").get<std::vector<int64_t>>();
+    resume_point_->next = state.at("next").get<int64_t>();
+  } catch (const std::exception &err) {
+    RETURN_STATUS_UNEXPECTED("Invalid data, failed to restore the state of the sampler: " + std::string(err.what()));
+  }
+  return Status::OK();
+}
+
+Status Sampler::SaveRandomState(nlohmann::json *state) const {
+  RETURN_STATUS_UNEXPECTED("Invalid operation, the sampler does not support saving its state.");
+}
+
+Status Sampler::RestoreRandomState(const nlohmann::json &state) {
+  RETURN_STATUS_UNEXPECTED("Invalid operation, the sampler does not support restoring its state.");
+}
+
+Status Sampler::PrepareResume() {
+  std::unique_ptr<ResumePoint> point = std::move(resume_point_);
+  std::unique_ptr<DataBuffer> db;
+  TensorRow sample_row;
+
+  // The ids of an epoch depend on the epochs before it, so generate those too. No row is read for them.
+  for (int64_t epoch = 0; epoch < point->epoch; ++epoch) {
+    do {
+      RETURN_IF_NOT_OK(GetNextSample(&db));
+    } while (!db->eoe());
+    RETURN_IF_NOT_OK(ResetSampler());
+  }
+
+  // Collect the ids of the resumed epoch, this leaves the sampler at the end of it
+  std::vector<int64_t> epoch_ids;
+  RETURN_IF_NOT_OK(GetNextSample(&db));
+  while (!db->eoe()) {
+    RETURN_IF_NOT_OK(db->PopRow(&sample_row));
+    for (auto itr = sample_row[0]->begin<int64_t>(); itr != sample_row[0]->end<int64_t>(); ++itr) {
+      epoch_ids.push_back(*itr);
+    }
+    RETURN_IF_NOT_OK(GetNextSample(&db));
+  }
+
+  const int64_t num_ids = static_cast<int64_t>(epoch_ids.size());
+  std::vector<int64_t> resumed_ids;
+  for (int64_t pos : point->pending) {
+    CHECK_FAIL_RETURN_UNEXPECTED(pos >= 0 && pos < num_ids,
+                                 "Invalid data, the restored state does not fit the sampler.");
+    resumed_ids.push_back(epoch_ids[pos]);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(point->next >= 0 && point->next <= num_ids,
+                               "Invalid data, the restored state does not fit the sampler.");
+  resumed_ids.insert(resumed_ids.end(), epoch_ids.begin() + point->next, epoch_ids.end());
+
+  if (resumed_ids.empty()) {
+    resume_buffer_ = std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOE);
+    return Status::OK();
+  }
+  std::shared_ptr<Tensor> sample_ids;
+  RETURN_IF_NOT_OK(CreateSamplerTensor(&sample_ids, static_cast<int64_t>(resumed_ids.size())));
+  auto id_ptr = sample_ids->begin<int64_t>();
+  for (int64_t id : resumed_ids) {
+    *id_ptr = id;
+    ++id_ptr;
+  }
+  resume_buffer_ = std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagNone);
+  TensorRow row(1, sample_ids);
+  resume_buffer_->set_tensor_table(std::make_unique<TensorQTable>(1, row));
+  return Status::OK();
+}
+
 Status Sampler::SetNumSamples(int64_t num_samples) {
   CHECK_FAIL_RETURN_UNEXPECTED(num_samples >= 0, "Invalid parameter, num_samples must be greater than or equal to 0.");
   num_samples_ = num_samples;
@@ -93,6 +93,18 @@ class Sampler {
   // initialize sampler and perform checks on certain vars
   virtual Status InitSampler() { return Status::OK(); }
 
+  // Saves the state to restore the sampler with, so that it resumes at a position of an epoch
+  // @param point - the position of the epoch to resume at
+  // @param state - the state of the sampler
+  // @return - The error code return
+  Status SaveState(const ResumePoint &point, nlohmann::json *state);
+
+  // Restores a state saved by SaveState(). Must be called before the handshake, which then skips the epochs
+  // before the resume point and prepares the ids of the resumed epoch.
+  // @param state - the state of the sampler
+  // @return - The error code return
+  Status RestoreState(const nlohmann::json &state);
+
   // setter for num samples
   // @param num_samples - the number of samples to assign.
   // @return status error code
@@ -141,6 +153,22 @@ class Sampler {
   Status GetAssociatedChildId(int64_t *out_associated_id, int64_t id);
 
  protected:
+  // Saves what the ids of the sampler are derived from, such as its seed. Samplers which cannot reproduce
+  // their ids do not override it and fail.
+  // @param state - the state of the sampler
+  // @return - The error code return
+  virtual Status SaveRandomState(nlohmann::json *state) const;
+
+  // Restores what SaveRandomState() saved
+  // @param state - the state of the sampler
+  // @return - The error code return
+  virtual Status RestoreRandomState(const nlohmann::json &state);
+
+  // Runs through the epochs before the restored resume point, generating their ids only, and packs the ids
+  // of the resumed epoch into resume_buffer_.
+  // @return - The error code return
+  Status PrepareResume();
+
   // Number of rows of data from the place this sampler is sampling from. If this sampler
   // has a child sampler, num_rows_ is the number of ids the child sampler will
   // output. Otherwise, num_rows_ is the number of rows in the dataset.
@@ -155,6 +183,8 @@ class Sampler {
   std::unique_ptr<ColDescriptor> col_desc_;
   std::vector<std::shared_ptr<Sampler>> child_;  // Child nodes
   std::unique_ptr<DataBuffer> child_ids_;
+  std::unique_ptr<ResumePoint> resume_point_;  // Set by RestoreState() until the handshake
+  std::unique_ptr<DataBuffer> resume_buffer_;  // The ids of the resumed epoch, the first buffer after a restore
 };
 }  // namespace dataset
 }  // namespace mindspore
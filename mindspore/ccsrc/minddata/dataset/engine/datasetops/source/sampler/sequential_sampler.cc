@@ -24,6 +24,11 @@ SequentialSampler::SequentialSampler(int64_t num_samples, int64_t start_index, i
     : Sampler(num_samples, samples_per_buffer), start_index_(start_index), current_id_(start_index), id_count_(0) {}
 
 Status SequentialSampler::GetNextSample(std::unique_ptr<DataBuffer> *out_buffer) {
+  if (resume_buffer_ != nullptr) {
+    // The first buffer after a restore holds the ids of the rest of the resumed epoch
+    *out_buffer = std::move(resume_buffer_);
+    return Status::OK();
+  }
   if (id_count_ > num_samples_) {
     RETURN_STATUS_UNEXPECTED("SequentialSampler Internal Error");
   } else if (id_count_ == num_samples_) {
@@ -54,6 +54,12 @@ class SequentialSampler : public Sampler {
   // @param show_all - bool to show detailed vs summary
   void Print(std::ostream &out, bool show_all) const override;
 
+ protected:
+  // The ids only depend on the dataset, there is nothing to save
+  Status SaveRandomState(nlohmann::json *state) const override { return Status::OK(); }
+
+  Status RestoreRandomState(const nlohmann::json &state) override { return Status::OK(); }
+
  private:
   int64_t current_id_;   // The id sequencer.  Each new id increments from this
   int64_t start_index_;  // The starting id.  current_id_ begins from here.
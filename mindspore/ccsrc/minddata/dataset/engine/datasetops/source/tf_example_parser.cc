@@ -0,0 +1,220 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/tf_example_parser.h"
+
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+bool WireReader::SkipField(uint32_t wire_type) {
+  switch (wire_type) {
+    case kVarint: {
+      uint64_t value = 0;
+      return ReadVarint(&value);
+    }
+    case kFixed64: {
+      if (end_ - pos_ < 8) {
+        return false;
+      }
+      pos_ += 8;
+      return true;
+    }
+    case kLengthDelimited: {
+      WireSpan span;
+      return ReadLengthDelimited(&span);
+    }
+    case kFixed32: {
+      uint32_t value = 0;
+      return ReadFixed32(&value);
+    }
+    default:
+      // Groups are not used by the messages of an Example.
+      return false;
+  }
+}
+
+TFExampleParser::TFExampleParser(const std::vector<std::string> &columns) {
+  for (int32_t i = 0; i < static_cast<int32_t>(columns.size()); ++i) {
+    column_ids_[columns[i]] = i;
+  }
+}
+
+// message Example { Features features = 1; }
+Status TFExampleParser::Parse(const std::string &serialized, std::vector<Feature> *features) const {
+  RETURN_UNEXPECTED_IF_NULL(features);
+  features->assign(column_ids_.size(), Feature());
+  WireSpan example;
+  example.data = reinterpret_cast<const uint8_t *>(serialized.data());
+  example.size = serialized.size();
+  WireReader reader(example);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!reader.Done()) {
+    CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadTag(&field, &wire_type), "Invalid data, failed to parse example.");
+    if (field == 1 && wire_type == WireReader::kLengthDelimited) {
+      WireSpan span;
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadLengthDelimited(&span), "Invalid data, failed to parse example.");
+      // A message which occurs twice is merged, so later features win over earlier ones of the same name.
+      RETURN_IF_NOT_OK(ParseFeatures(span, features));
+    } else {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.SkipField(wire_type), "Invalid data, failed to parse example.");
+    }
+  }
+  return Status::OK();
+}
+
+// message Features { map<string, Feature> feature = 1; }, each map entry being { string key = 1; Feature value = 2; }
+Status TFExampleParser::ParseFeatures(const WireSpan &features, std::vector<Feature> *out) const {
+  WireReader reader(features);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  std::string key;
+  while (!reader.Done()) {
+    CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadTag(&field, &wire_type), "Invalid data, failed to parse features.");
+    if (field != 1 || wire_type != WireReader::kLengthDelimited) {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.SkipField(wire_type), "Invalid data, failed to parse features.");
+      continue;
+    }
+    WireSpan entry;
+    CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadLengthDelimited(&entry), "Invalid data, failed to parse features.");
+    // The key and the value may come in any order, so only remember where the value is until the key is known.
+    WireReader entry_reader(entry);
+    WireSpan key_span;
+    WireSpan value_span;
+    while (!entry_reader.Done()) {
+      CHECK_FAIL_RETURN_UNEXPECTED(entry_reader.ReadTag(&field, &wire_type), "Invalid data, failed to parse feature.");
+      if (field == 1 && wire_type == WireReader::kLengthDelimited) {
+        CHECK_FAIL_RETURN_UNEXPECTED(entry_reader.ReadLengthDelimited(&key_span),
+                                     "Invalid data, failed to parse feature.");
+      } else if (field == 2 && wire_type == WireReader::kLengthDelimited) {
+        CHECK_FAIL_RETURN_UNEXPECTED(entry_reader.ReadLengthDelimited(&value_span),
+                                     "Invalid data, failed to parse feature.");
+      } else {
+        CHECK_FAIL_RETURN_UNEXPECTED(entry_reader.SkipField(wire_type), "Invalid data, failed to parse feature.");
+      }
+    }
+    key.assign(reinterpret_cast<const char *>(key_span.data), key_span.size);
+    auto iter = column_ids_.find(key);
+    if (iter == column_ids_.end()) {
+      continue;
+    }
+    Feature &feature = (*out)[iter->second];
+    feature = Feature();
+    feature.found = true;
+    RETURN_IF_NOT_OK(ParseFeature(value_span, &feature));
+  }
+  return Status::OK();
+}
+
+// message Feature { oneof kind { BytesList bytes_list = 1; FloatList float_list = 2; Int64List int64_list = 3; } }
+Status TFExampleParser::ParseFeature(const WireSpan &feature, Feature *out) {
+  WireReader reader(feature);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!reader.Done()) {
+    CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadTag(&field, &wire_type), "Invalid data, failed to parse feature.");
+    if (field >= kBytesList && field <= kInt64List && wire_type == WireReader::kLengthDelimited) {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadLengthDelimited(&out->list), "Invalid data, failed to parse feature.");
+      out->kind = static_cast<FeatureKind>(field);
+    } else {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.SkipField(wire_type), "Invalid data, failed to parse feature.");
+    }
+  }
+  return Status::OK();
+}
+
+Status TFExampleParser::CountValues(const Feature &feature, int64_t *count) {
+  RETURN_UNEXPECTED_IF_NULL(count);
+  *count = 0;
+  WireReader reader(feature.list);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!reader.Done()) {
+    CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadTag(&field, &wire_type), "Invalid data, failed to parse value list.");
+    if (field == 1 && wire_type == WireReader::kLengthDelimited) {
+      WireSpan packed;
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadLengthDelimited(&packed), "Invalid data, failed to parse value list.");
+      if (feature.kind == kFloatList) {
+        CHECK_FAIL_RETURN_UNEXPECTED(packed.size % sizeof(float) == 0, "Invalid data, failed to parse float list.");
+        *count += static_cast<int64_t>(packed.size / sizeof(float));
+      } else {
+        // Every varint ends with the one byte which has the high bit clear.
+        for (size_t i = 0; i < packed.size; ++i) {
+          *count += (packed.data[i] & 0x80) == 0 ? 1 : 0;
+        }
+      }
+    } else {
+      // A value which is not packed
+      uint32_t value_type = feature.kind == kFloatList ? WireReader::kFixed32 : WireReader::kVarint;
+      bool unpacked = field == 1 && wire_type == value_type;
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.SkipField(wire_type), "Invalid data, failed to parse value list.");
+      *count += unpacked ? 1 : 0;
+    }
+  }
+  return Status::OK();
+}
+
+Status TFExampleParser::ReadFloatList(const Feature &feature, float *out, int64_t capacity) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  size_t remaining = static_cast<size_t>(capacity) * sizeof(float);
+  WireReader reader(feature.list);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  uint32_t bits = 0;
+  while (!reader.Done()) {
+    CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadTag(&field, &wire_type), "Invalid data, failed to parse float list.");
+    if (field == 1 && wire_type == WireReader::kLengthDelimited) {
+      // Packed values, the usual encoding, are little endian floats which can be copied as they are.
+      WireSpan packed;
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadLengthDelimited(&packed), "Invalid data, failed to parse float list.");
+      if (packed.size > 0) {
+        int ret_code = memcpy_s(out, remaining, packed.data, packed.size);
+        CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy float list into tensor.");
+      }
+      out += packed.size / sizeof(float);
+      remaining -= packed.size / sizeof(float) * sizeof(float);
+    } else if (field == 1 && wire_type == WireReader::kFixed32) {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadFixed32(&bits), "Invalid data, failed to parse float list.");
+      int ret_code = memcpy_s(out++, remaining, &bits, sizeof(float));
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy float list into tensor.");
+      remaining -= sizeof(float);
+    } else {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.SkipField(wire_type), "Invalid data, failed to parse float list.");
+    }
+  }
+  return Status::OK();
+}
+
+Status TFExampleParser::ReadBytesList(const Feature &feature, std::vector<WireSpan> *values) {
+  RETURN_UNEXPECTED_IF_NULL(values);
+  values->clear();
+  WireReader reader(feature.list);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!reader.Done()) {
+    CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadTag(&field, &wire_type), "Invalid data, failed to parse bytes list.");
+    if (field == 1 && wire_type == WireReader::kLengthDelimited) {
+      WireSpan value;
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadLengthDelimited(&value), "Invalid data, failed to parse bytes list.");
+      values->push_back(value);
+    } else {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.SkipField(wire_type), "Invalid data, failed to parse bytes list.");
+    }
+  }
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,174 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_PARSER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_PARSER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// A piece of a serialized message
+struct WireSpan {
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+};
+
+// Reads the protobuf wire format. Only the parts needed to walk a dataengine::Example are supported.
+class WireReader {
+ public:
+  enum WireType : uint32_t { kVarint = 0, kFixed64 = 1, kLengthDelimited = 2, kFixed32 = 5 };
+
+  explicit WireReader(const WireSpan &span) : pos_(span.data), end_(span.data + span.size) {}
+
+  bool Done() const { return pos_ >= end_; }
+
+  bool ReadVarint(uint64_t *value) {
+    uint64_t result = 0;
+    for (uint32_t shift = 0; shift < 64 && pos_ < end_; shift += 7) {
+      uint8_t byte = *pos_++;
+      result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        *value = result;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ReadTag(uint32_t *field, uint32_t *wire_type) {
+    uint64_t tag = 0;
+    if (!ReadVarint(&tag)) {
+      return false;
+    }
+    *field = static_cast<uint32_t>(tag >> 3);
+    *wire_type = static_cast<uint32_t>(tag & 0x7);
+    return true;
+  }
+
+  bool ReadFixed32(uint32_t *value) {
+    if (end_ - pos_ < 4) {
+      return false;
+    }
+    // The wire format is little endian, as are the platforms we run on.
+    *value = static_cast<uint32_t>(pos_[0]) | (static_cast<uint32_t>(pos_[1]) << 8) |
+             (static_cast<uint32_t>(pos_[2]) << 16) | (static_cast<uint32_t>(pos_[3]) << 24);
+    pos_ += 4;
+    return true;
+  }
+
+  bool ReadLengthDelimited(WireSpan *span) {
+    uint64_t size = 0;
+    if (!ReadVarint(&size) || size > static_cast<uint64_t>(end_ - pos_)) {
+      return false;
+    }
+    span->data = pos_;
+    span->size = static_cast<size_t>(size);
+    pos_ += size;
+    return true;
+  }
+
+  bool SkipField(uint32_t wire_type);
+
+ private:
+  const uint8_t *pos_;
+  const uint8_t *end_;
+};
+
+// Parses serialized dataengine::Example messages straight from the wire format. Only the features of the selected
+// columns are located, the others are skipped over without being decoded, and the values of a feature can be decoded
+// straight into the buffer of a tensor. No protobuf objects are built.
+class TFExampleParser {
+ public:
+  // The kind of a dataengine::Feature, numbered as the fields of its oneof
+  enum FeatureKind : uint32_t { kNotSet = 0, kBytesList = 1, kFloatList = 2, kInt64List = 3 };
+
+  // A feature of the example: its kind and the serialized list of values
+  struct Feature {
+    bool found = false;
+    FeatureKind kind = kNotSet;
+    WireSpan list;
+  };
+
+  // @param columns - The names of the selected columns, their index is the column id
+  explicit TFExampleParser(const std::vector<std::string> &columns);
+
+  ~TFExampleParser() = default;
+
+  // Locate the features of the selected columns in a serialized Example
+  // @param serialized - The serialized Example
+  // @param features - [out] The feature of each selected column, found is false if the example does not have it
+  // @return Status - The error code return
+  Status Parse(const std::string &serialized, std::vector<Feature> *features) const;
+
+  // Count the values of an Int64List or FloatList feature
+  static Status CountValues(const Feature &feature, int64_t *count);
+
+  // Decode the values of an Int64List feature, casting each to T
+  // @param out - The buffer to decode into, it must have room for CountValues() values
+  template <typename T>
+  static Status ReadInt64List(const Feature &feature, T *out);
+
+  // Decode the values of a FloatList feature
+  // @param out - The buffer to decode into, it must have room for CountValues() values
+  // @param capacity - The number of floats out has room for
+  static Status ReadFloatList(const Feature &feature, float *out, int64_t capacity);
+
+  // Locate the values of a BytesList feature
+  static Status ReadBytesList(const Feature &feature, std::vector<WireSpan> *values);
+
+ private:
+  Status ParseFeatures(const WireSpan &features, std::vector<Feature> *out) const;
+
+  static Status ParseFeature(const WireSpan &feature, Feature *out);
+
+  std::unordered_map<std::string, int32_t> column_ids_;
+};
+
+template <typename T>
+Status TFExampleParser::ReadInt64List(const Feature &feature, T *out) {
+  WireReader reader(feature.list);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  uint64_t value = 0;
+  while (!reader.Done()) {
+    CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadTag(&field, &wire_type), "Invalid data, failed to parse int64 list.");
+    if (field == 1 && wire_type == WireReader::kLengthDelimited) {
+      // Packed values, the usual encoding
+      WireSpan packed;
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadLengthDelimited(&packed), "Invalid data, failed to parse int64 list.");
+      WireReader values(packed);
+      while (!values.Done()) {
+        CHECK_FAIL_RETURN_UNEXPECTED(values.ReadVarint(&value), "Invalid data, failed to parse int64 list.");
+        *out++ = static_cast<T>(static_cast<int64_t>(value));
+      }
+    } else if (field == 1 && wire_type == WireReader::kVarint) {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.ReadVarint(&value), "Invalid data, failed to parse int64 list.");
+      *out++ = static_cast<T>(static_cast<int64_t>(value));
+    } else {
+      CHECK_FAIL_RETURN_UNEXPECTED(reader.SkipField(wire_type), "Invalid data, failed to parse int64 list.");
+    }
+  }
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_PARSER_H_
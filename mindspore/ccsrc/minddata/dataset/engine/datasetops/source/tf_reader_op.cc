@@ -198,6 +198,12 @@ Status TFReaderOp::Init() {
     RETURN_STATUS_UNEXPECTED("Invalid parameter, num_sample or num_row for TFRecordDataset must be greater than 0.");
   }
 
+  std::vector<std::string> columns;
+  for (int32_t i = 0; i < data_schema_->NumColumns(); ++i) {
+    columns.push_back(data_schema_->column(i).name());
+  }
+  example_parser_ = std::make_unique<TFExampleParser>(columns);
+
   // Build the index with our files such that each file corresponds to a key id.
   RETURN_IF_NOT_OK(filename_index_->insert(dataset_files_list_));
 
@@ -577,6 +583,9 @@ Status TFReaderOp::LoadFile(const std::string &filename, const int64_t start_off
   int64_t rows_total = 0;
   std::unique_ptr<DataBuffer> current_buffer = std::make_unique<DataBuffer>(0, DataBuffer::BufferFlags::kDeBFlagNone);
   std::unique_ptr<TensorQTable> new_tensor_table = std::make_unique<TensorQTable>();
+  // Reused by every row of the file
+  std::string serialized_example;
+  std::vector<TFExampleParser::Feature> features;
 
   while (reader.peek() != EOF) {
     if (!load_jagged_connector_) {
@@ -584,29 +593,29 @@ Status TFReaderOp::LoadFile(const std::string &filename, const int64_t start_off
     }
     RETURN_IF_INTERRUPTED();
 
-    // read length
+    // read length and check its crc
     int64_t record_length = 0;
     (void)reader.read(reinterpret_cast<char *>(&record_length), static_cast<std::streamsize>(sizeof(int64_t)));
+    uint32_t masked_crc = 0;
+    (void)reader.read(reinterpret_cast<char *>(&masked_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+    CHECK_FAIL_RETURN_UNEXPECTED(
+      masked_crc == system::Crc32c::GetMaskCrc32cValue(reinterpret_cast<char *>(&record_length), sizeof(int64_t)),
+      "Invalid file, failed to verify the crc of a record length in tfrecord file: " + filename);
 
-    // ignore crc header
-    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
-
-    // read serialized Example
-    std::string serialized_example;
-    serialized_example.resize(record_length);
-    (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
     if (start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset)) {
-      dataengine::Example tf_file;
-      if (!tf_file.ParseFromString(serialized_example)) {
-        std::string errMsg = "Invalid file, failed to parse tfrecord file : " + serialized_example;
-        RETURN_STATUS_UNEXPECTED(errMsg);
-      }
-      RETURN_IF_NOT_OK(LoadExample(&tf_file, &new_tensor_table, rows_read));
+      // read serialized Example and check its crc
+      serialized_example.resize(record_length);
+      (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
+      (void)reader.read(reinterpret_cast<char *>(&masked_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+      CHECK_FAIL_RETURN_UNEXPECTED(
+        masked_crc == system::Crc32c::GetMaskCrc32cValue(serialized_example.data(), serialized_example.size()),
+        "Invalid file, failed to verify the crc of a record in tfrecord file: " + filename);
+      RETURN_IF_NOT_OK(LoadExample(serialized_example, &features, &new_tensor_table, rows_read));
       rows_read++;
+    } else {
+      // skip the Example and its crc footer
+      (void)reader.ignore(static_cast<std::streamsize>(record_length + sizeof(int32_t)));
     }
-
-    // ignore crc footer
-    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
     rows_total++;
 
     if (rows_read == rows_per_buffer_) {
@@ -628,22 +637,20 @@ Status TFReaderOp::LoadFile(const std::string &filename, const int64_t start_off
 }
 
 // Parses a single row and puts the data into a tensor table.
-Status TFReaderOp::LoadExample(const dataengine::Example *tf_file, std::unique_ptr<TensorQTable> *tensor_table,
-                               int64_t row) {
+Status TFReaderOp::LoadExample(const std::string &serialized_example, std::vector<TFExampleParser::Feature> *features,
+                               std::unique_ptr<TensorQTable> *tensor_table, int64_t row) {
+  RETURN_IF_NOT_OK(example_parser_->Parse(serialized_example, features));
   int32_t num_columns = data_schema_->NumColumns();
   TensorRow newRow(num_columns, nullptr);
   (*tensor_table)->push_back(std::move(newRow));
 
   for (int32_t col = 0; col < num_columns; ++col) {
-    const ColDescriptor current_col = data_schema_->column(col);
-    const dataengine::Features &example_features = tf_file->features();
-    const google::protobuf::Map<std::string, dataengine::Feature> &feature_map = example_features.feature();
-    auto iter_column = feature_map.find(current_col.name());
-    if (iter_column == feature_map.end()) {
+    const ColDescriptor &current_col = data_schema_->column(col);
+    const TFExampleParser::Feature &feature = (*features)[col];
+    if (!feature.found) {
       RETURN_STATUS_UNEXPECTED("Invalid parameter, column name: " + current_col.name() + "does not exist.");
     }
-    const dataengine::Feature &column_values_list = iter_column->second;
-    RETURN_IF_NOT_OK(LoadFeature(tensor_table, column_values_list, current_col, row, col));
+    RETURN_IF_NOT_OK(LoadFeature(tensor_table, feature, current_col, row, col));
   }
 
   return Status::OK();
@@ -651,46 +658,28 @@ Status TFReaderOp::LoadExample(const dataengine::Example *tf_file, std::unique_p
 
 // Parses a single cell and puts the data into a tensor table.
 Status TFReaderOp::LoadFeature(const std::unique_ptr<TensorQTable> *tensor_table,
-                               const dataengine::Feature &column_values_list, const ColDescriptor &current_col,
-                               int64_t row, int32_t col) {
-  const dataengine::Feature::KindCase column_list_type = column_values_list.kind_case();
-  std::unique_ptr<float[]> float_array;     // For staging data from protobuf deserialization
-  const unsigned char *data_ptr = nullptr;  // Generic pointer used for populating the Tensor
-
-  // This variable will point into the above staging variables.
-  // Also used for creating shape attributes.
+                               const TFExampleParser::Feature &feature, const ColDescriptor &current_col, int64_t row,
+                               int32_t col) {
+  // Used for creating shape attributes.
   int32_t num_elements = 0;
 
-  // we build a tensor first a read directly into it if we need to cast
+  // the tensor is created with the shape of the feature and the values are decoded straight into it
   std::shared_ptr<Tensor> ts;
 
-  // Depending on the type of data from the tf_file, we want to extract 2 things:
-  // 1) A pointer to the data as a const unsigned char *
-  // 2) The number of elements of the data
-  // After those are determined, we can then build the tensor to represent this data.
-  switch (column_list_type) {
-    case dataengine::Feature::KindCase::kBytesList: {
-      RETURN_IF_NOT_OK(LoadBytesList(current_col, column_values_list, &num_elements, &ts));
-
+  switch (feature.kind) {
+    case TFExampleParser::kBytesList: {
+      RETURN_IF_NOT_OK(LoadBytesList(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::kFloatList: {
-      RETURN_IF_NOT_OK(LoadFloatList(current_col, column_values_list, &num_elements, &float_array));
-
-      data_ptr = reinterpret_cast<const unsigned char *>(float_array.get());
-
-      // only floatList needs to create the tensor here, other two lists read directly
-      // into the tensor
-      TensorShape current_shape = TensorShape::CreateUnknownRankShape();
-      RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &current_shape));
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(current_shape, current_col.type(), data_ptr, &ts));
+    case TFExampleParser::kFloatList: {
+      RETURN_IF_NOT_OK(LoadFloatList(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::kInt64List: {
-      RETURN_IF_NOT_OK(LoadIntListSwitch(current_col, column_values_list, &num_elements, &ts));
+    case TFExampleParser::kInt64List: {
+      RETURN_IF_NOT_OK(LoadIntListSwitch(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::KIND_NOT_SET: {
+    case TFExampleParser::kNotSet: {
       std::string err_msg = "Invalid data, tf_file column type must be uint8, int64 or float32.";
       RETURN_STATUS_UNEXPECTED(err_msg);
     }
@@ -722,7 +711,7 @@ Status TFReaderOp::Reset() {
   return Status::OK();
 }
 
-Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const TFExampleParser::Feature &feature,
                                  int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   // kBytesList can map to the following DE types ONLY!
   // DE_UINT8, DE_INT8
@@ -734,19 +723,25 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::BytesList &bytes_list = column_values_list.bytes_list();
+  std::vector<WireSpan> values;
+  RETURN_IF_NOT_OK(TFExampleParser::ReadBytesList(feature, &values));
 
-  *num_elements = bytes_list.value_size();
+  *num_elements = values.size();
 
   if (current_col.type() == DataType::DE_STRING) {
+    std::vector<std::string> strings;
+    strings.reserve(values.size());
+    for (const auto &value : values) {
+      strings.emplace_back(reinterpret_cast<const char *>(value.data), value.size);
+    }
     TensorShape shape = TensorShape::CreateScalar();
     RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &shape));
-    RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, shape, tensor));
+    RETURN_IF_NOT_OK(Tensor::CreateFromVector(strings, shape, tensor));
     return Status::OK();
   }
 
   uint64_t max_size = 0;
-  for (uint32_t i = 0; i < bytes_list.value_size(); ++i) max_size = std::max(max_size, bytes_list.value(i).size());
+  for (const auto &value : values) max_size = std::max<uint64_t>(max_size, value.size);
 
   int64_t pad_size = max_size;
 
@@ -770,13 +765,41 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
   // know how many elements there are and the total bytes, create tensor here:
   TensorShape current_shape = TensorShape::CreateScalar();
   RETURN_IF_NOT_OK(current_col.MaterializeTensorShape((*num_elements) * pad_size, &current_shape));
-  RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, current_shape, current_col.type(), pad_size, tensor));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.type(), tensor));
+  if ((*tensor)->Size() == 0) {
+    return Status::OK();
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED((*tensor)->Size() == (*num_elements) * pad_size,
+                               "Invalid data, the shape of column: " + current_col.name() + " does not fit its data.");
+
+  // copy every value into the tensor, padded to pad_size with spaces
+  unsigned char *current_tensor_addr = nullptr;
+  TensorShape remaining = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK((*tensor)->StartAddrOfIndex({}, &current_tensor_addr, &remaining));
+  size_t remaining_bytes = static_cast<size_t>((*num_elements) * pad_size);
+  for (const auto &value : values) {
+    CHECK_FAIL_RETURN_UNEXPECTED(static_cast<int64_t>(value.size) <= pad_size,
+                                 "Invalid data, a bytes value is longer than the shape of column: " +
+                                   current_col.name());
+    int ret_code = 0;
+    if (value.size > 0) {
+      ret_code = memcpy_s(current_tensor_addr, remaining_bytes, value.data, value.size);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy bytes into tensor.");
+    }
+    if (static_cast<int64_t>(value.size) < pad_size) {
+      ret_code = memset_s(current_tensor_addr + value.size, remaining_bytes - value.size, static_cast<int>(' '),
+                          pad_size - value.size);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to pad bytes in tensor.");
+    }
+    current_tensor_addr += pad_size;
+    remaining_bytes -= pad_size;
+  }
 
   return Status::OK();
 }
 
-Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                                 int32_t *num_elements, std::unique_ptr<float[]> *float_array) {
+Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const TFExampleParser::Feature &feature,
+                                 int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   // KFloatList can only map to DE types:
   // DE_FLOAT32
   if (current_col.type() != DataType::DE_FLOAT32) {
@@ -785,38 +808,47 @@ Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const dataeng
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::FloatList &float_list = column_values_list.float_list();
+  // Identify how many values we have and then create the tensor to deserialize into
+  int64_t count = 0;
+  RETURN_IF_NOT_OK(TFExampleParser::CountValues(feature, &count));
+  *num_elements = count;
 
-  // Identify how many values we have and then create a local array of these
-  // to deserialize into
-  *num_elements = float_list.value_size();
-  *float_array = std::make_unique<float[]>(*num_elements);
-  for (int i = 0; i < float_list.value_size(); ++i) {
-    (*float_array)[i] = float_list.value(i);
+  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.type(), tensor));
+  if (count == 0) {
+    return Status::OK();
   }
+  CHECK_FAIL_RETURN_UNEXPECTED((*tensor)->Size() == count,
+                               "Invalid data, the shape of column: " + current_col.name() + " does not fit its data.");
+
+  unsigned char *buffer = nullptr;
+  TensorShape remaining = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK((*tensor)->StartAddrOfIndex({}, &buffer, &remaining));
+  RETURN_IF_NOT_OK(TFExampleParser::ReadFloatList(feature, reinterpret_cast<float *>(buffer), count));
 
   return Status::OK();
 }
 
 // Determines which template type to use and calls LoadIntList
-Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const TFExampleParser::Feature &feature,
                                      int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   if (current_col.type() == DataType::DE_UINT64) {
-    RETURN_IF_NOT_OK(LoadIntList<uint64_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint64_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.type() == DataType::DE_INT64) {
-    RETURN_IF_NOT_OK(LoadIntList<int64_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int64_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.type() == DataType::DE_UINT32) {
-    RETURN_IF_NOT_OK(LoadIntList<uint32_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint32_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.type() == DataType::DE_INT32) {
-    RETURN_IF_NOT_OK(LoadIntList<int32_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int32_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.type() == DataType::DE_UINT16) {
-    RETURN_IF_NOT_OK(LoadIntList<uint16_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint16_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.type() == DataType::DE_INT16) {
-    RETURN_IF_NOT_OK(LoadIntList<int16_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int16_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.type() == DataType::DE_UINT8) {
-    RETURN_IF_NOT_OK(LoadIntList<uint8_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint8_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.type() == DataType::DE_INT8) {
-    RETURN_IF_NOT_OK(LoadIntList<int8_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int8_t>(current_col, feature, num_elements, tensor));
   } else {
     std::string err_msg = "Invalid data, invalid datatype for Tensor at column: " + current_col.name() +
                           ", data type should be uint64, int64, uint32, int32, uint16, int16, uint8 or int8" +
@@ -827,10 +859,10 @@ Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const dat
   return Status::OK();
 }
 
-// Reads values from a bytes list and casts the value to type T, must be an integral type
+// Reads values from an int64 list and casts the value to type T, must be an integral type
 // compatible with int64_t
 template <typename T>
-Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const TFExampleParser::Feature &feature,
                                int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   if (!(current_col.type().IsInt())) {
     std::string err_msg = "Invalid data, invalid data type for Tensor at column: " + current_col.name() +
@@ -838,23 +870,25 @@ Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const dataengin
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::Int64List &int64_list = column_values_list.int64_list();
-
-  // Identify how many values we have and then create a local array of these
-  // to deserialize into
-  *num_elements = int64_list.value_size();
+  // Identify how many values we have and then create the tensor to deserialize into
+  int64_t count = 0;
+  RETURN_IF_NOT_OK(TFExampleParser::CountValues(feature, &count));
+  *num_elements = count;
 
   // know how many elements there are, create tensor here:
   TensorShape current_shape = TensorShape::CreateUnknownRankShape();
   RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &current_shape));
   RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.type(), tensor));
-
-  int64_t i = 0;
-  auto it = (*tensor)->begin<T>();
-  for (; it != (*tensor)->end<T>(); i++, ++it) {
-    T element = static_cast<T>(int64_list.value(i));
-    *it = element;
+  if (count == 0) {
+    return Status::OK();
   }
+  CHECK_FAIL_RETURN_UNEXPECTED((*tensor)->Size() == count,
+                               "Invalid data, the shape of column: " + current_col.name() + " does not fit its data.");
+
+  unsigned char *buffer = nullptr;
+  TensorShape remaining = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK((*tensor)->StartAddrOfIndex({}, &buffer, &remaining));
+  RETURN_IF_NOT_OK(TFExampleParser::ReadInt64List<T>(feature, reinterpret_cast<T *>(buffer)));
 
   return Status::OK();
 }
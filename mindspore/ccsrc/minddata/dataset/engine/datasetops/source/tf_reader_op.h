@@ -31,12 +31,7 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
-
-namespace dataengine {
-class Example;
-class Feature;
-class BytesList;
-}  // namespace dataengine
+#include "minddata/dataset/engine/datasetops/source/tf_example_parser.h"
 
 namespace mindspore {
 namespace dataset {
@@ -301,56 +296,60 @@ class TFReaderOp : public ParallelOp {
   Status LoadFile(const std::string &filename, const int64_t start_offset, const int64_t end_offset,
                   const int32_t &worker_id);
 
-  // Parses a single row and puts the data into a tensor table.
-  // @param tf_file - the row to be parsed.
+  // Parses a single row and puts the data into a tensor table. Only the features of the columns in the schema are
+  // decoded, the others are skipped.
+  // @param serialized_example - the serialized example of the row.
+  // @param features - scratch space for the features of the row.
   // @param tensor_table - the tensor table to put the parsed data in.
   // @param row - the id of the row filled in the tensor table.
   // @return Status - the error code returned.
-  Status LoadExample(const dataengine::Example *tf_file, std::unique_ptr<TensorQTable> *tensor_table, int64_t row);
+  Status LoadExample(const std::string &serialized_example, std::vector<TFExampleParser::Feature> *features,
+                     std::unique_ptr<TensorQTable> *tensor_table, int64_t row);
 
   // Parses a single cell and puts the data into a tensor table.
   // @param tensor_table - the tensor table to put the parsed data in.
-  // @param column_values_list - the cell to parse.
+  // @param feature - the cell to parse.
   // @param current_col - the column descriptor containing the expected shape and type of the data.
   // @return Status - the error code returned.
-  Status LoadFeature(const std::unique_ptr<TensorQTable> *tensor_table, const dataengine::Feature &column_values_list,
+  Status LoadFeature(const std::unique_ptr<TensorQTable> *tensor_table, const TFExampleParser::Feature &feature,
                      const ColDescriptor &current_col, int64_t row, int32_t col);
 
   // Reads values from a bytes list
   // @param current_col - the column descriptor containing the expected shape and type of the data.
-  // @param column_values_list - the cell that contains the bytes list to read from.
-  // @param elementStr - the string we read the value into.
+  // @param feature - the cell that contains the bytes list to read from.
+  // @param num_elements - number of values in the bytes list.
+  // @param tensor - the tensor we read the values into.
   // @return Status - the error code returned.
-  static Status LoadBytesList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+  static Status LoadBytesList(const ColDescriptor &current_col, const TFExampleParser::Feature &feature,
                               int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
   // Reads values from a float list
   // @param current_col - the column descriptor containing the expected shape and type of the data.
-  // @param column_values_list - the cell that contains the float list to read from.
-  // @Param numElements - number of values in the float list.
-  // @param float_array - the array we read the values into.
+  // @param feature - the cell that contains the float list to read from.
+  // @param num_elements - number of values in the float list.
+  // @param tensor - the tensor we read the values into.
   // @return Status - the error code returned.
-  Status LoadFloatList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                       int32_t *num_elements, std::unique_ptr<float[]> *float_array);
+  Status LoadFloatList(const ColDescriptor &current_col, const TFExampleParser::Feature &feature,
+                       int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
-  // Reads values from a bytes list and casts the value to type T, must be an integral
+  // Reads values from an int64 list and casts the value to type T, must be an integral
   // type compatible with int64_t
   // @param current_col - the column descriptor containing the expected shape and type of the data.
-  // @param column_values_list - the cell that contains the int list to read from.
-  // @Param num_elements - number of values in the int list.
+  // @param feature - the cell that contains the int list to read from.
+  // @param num_elements - number of values in the int list.
   // @param tensor - the tensor we read the values into.
   // @return Status - the error code returned.
   template <typename T>
-  Status LoadIntList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+  Status LoadIntList(const ColDescriptor &current_col, const TFExampleParser::Feature &feature,
                      int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
   // Determines which template type to use and calls LoadIntList
   // @param current_col - the column descriptor containing the expected shape and type of the data.
-  // @param column_values_list - the cell that contains the int list to read from.
-  // @Param numElements - number of values in the int list.
+  // @param feature - the cell that contains the int list to read from.
+  // @param num_elements - number of values in the int list.
   // @param tensor - the tensor we read the values into.
   // @return Status - the error code returned.
-  Status LoadIntListSwitch(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+  Status LoadIntListSwitch(const ColDescriptor &current_col, const TFExampleParser::Feature &feature,
                            int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
   // Reads one row of data from a tf file and creates a schema based on that row
@@ -402,6 +401,7 @@ class TFReaderOp : public ParallelOp {
   bool finished_reading_dataset_;
   bool shuffle_files_;
   std::unique_ptr<DataSchema> data_schema_;
+  std::unique_ptr<TFExampleParser> example_parser_;  // Decodes the columns of the schema from the examples
   std::unique_ptr<StringIndex> filename_index_;
   bool load_io_block_queue_;
   bool load_jagged_connector_;
@@ -16,8 +16,11 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DB_CONNECTOR_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DB_CONNECTOR_H_
 
+#include <deque>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 #include "minddata/dataset/engine/connector.h"
 #include "minddata/dataset/engine/data_buffer.h"
 #include "minddata/dataset/core/constants.h"
@@ -35,7 +38,12 @@ class DbConnector : public Connector<std::unique_ptr<DataBuffer>> {
   // @param n_consumers The number of thread consuming data from this DbConnector.
   // @param queue_capacity The number of element (DataBuffer) for each internal queue.
   DbConnector(int32_t n_producers, int32_t n_consumers, int32_t queue_capacity)
-      : Connector<std::unique_ptr<DataBuffer>>(n_producers, n_consumers, queue_capacity), end_of_file_(false) {}
+      : Connector<std::unique_ptr<DataBuffer>>(n_producers, n_consumers, queue_capacity),
+        end_of_file_(false),
+        num_active_producers_(n_producers),
+        num_eoe_popped_(0),
+        ordered_(true),
+        num_parked_(0) {}
 
   // Destructor of DbConnector
   ~DbConnector() = default;
@@ -45,9 +53,22 @@ class DbConnector : public Connector<std::unique_ptr<DataBuffer>> {
   // @param worker_id The id of a worker thread calling this method.
   // @param el A rvalue reference to an element to be passed/added/pushed.
   Status Add(int32_t worker_id, std::unique_ptr<DataBuffer> &&el) noexcept {
-    return (Connector<std::unique_ptr<DataBuffer>>::Push(worker_id, std::move(el)));
+    RETURN_IF_NOT_OK(Connector<std::unique_ptr<DataBuffer>>::Push(worker_id, std::move(el)));
+    if (!ordered_) {
+      // The consumer waits on cv_ for any queue to get data. Taking m_ makes sure it is either
+      // before its check or already waiting.
+      { std::unique_lock<std::mutex> lk(m_); }
+      cv_.NotifyAll();
+    }
+    return Status::OK();
   }
 
+  // Let the consumer take buffers from whichever producer queue has data, so one slow producer does not
+  // stall the others. Rows lose their deterministic order, but epochs stay separated: every active producer
+  // must push each eoe and eof, and the consumer gets a single eoe or eof once all of them have pushed it.
+  // Only a single consumer is supported. Only call it before any producer starts.
+  void SetUnordered() { ordered_ = false; }
+
   // Get a unique_ptr<DataBuffer> from the DbConnector.
   // @note After the first EOF Buffer is encountered, subsequent pop()s will return EOF Buffer.
   // This will provide/propagate the EOF to all consumer threads of this Connector.
@@ -60,6 +81,8 @@ class DbConnector : public Connector<std::unique_ptr<DataBuffer>> {
     if (result == nullptr) {
       return Status(StatusCode::kUnexpectedError, __LINE__, __FILE__,
                     "[ERROR] nullptr detected when getting data from db connector");
+    } else if (!ordered_) {
+      RETURN_IF_NOT_OK(PopUnordered(result));
     } else {
       std::unique_lock<std::mutex> lk(m_);
       RETURN_IF_NOT_OK(cv_.Wait(&lk, [this, worker_id]() { return (expect_consumer_ == worker_id) || end_of_file_; }));
@@ -76,7 +99,10 @@ class DbConnector : public Connector<std::unique_ptr<DataBuffer>> {
         if ((*result)->eof()) {
           end_of_file_ = true;
         }
-        pop_from_ = (pop_from_ + 1) % num_producers_;
+        pop_from_ = (pop_from_ + 1) % num_active_producers_;
+        if ((*result)->eoe()) {
+          ApplyProducerSwitch();
+        }
       }
       // Do not increment expect_consumer_ when result is eoe and retry_if_eoe is set.
       if (!((*result)->eoe() && retry_if_eoe)) {
@@ -88,9 +114,112 @@ class DbConnector : public Connector<std::unique_ptr<DataBuffer>> {
     return Status::OK();
   }
 
+  // Set the number of producers taking part in the round robin. Only call it before any producer starts.
+  // @param num_active The number of active producers, producers with ids at or above it must not produce anything.
+  void SetActiveProducers(int32_t num_active) { num_active_producers_ = num_active; }
+
+  // Change the number of producers taking part in the round robin, starting right after the given eoe.
+  // The producers must switch at the same eoe: the buffer after it comes from producer 0, and
+  // producers with ids at or above num_active must not produce anything until the next switch.
+  // The switch has to be scheduled before its eoe is pushed.
+  // @param num_eoe The number of eoe buffers popped before the switch takes effect.
+  // @param num_active The number of producers taking part in the round robin after the switch.
+  // @return Status The error code return
+  Status SwitchActiveProducers(int64_t num_eoe, int32_t num_active) {
+    if (num_active <= 0 || num_active > num_producers_) {
+      RETURN_STATUS_UNEXPECTED("Invalid number of active producers: " + std::to_string(num_active));
+    }
+    // The consumer holds m_ while it waits for a buffer, so the switches are guarded by their own mutex.
+    std::unique_lock<std::mutex> lk(switch_mux_);
+    if (num_eoe <= num_eoe_popped_) {
+      RETURN_STATUS_UNEXPECTED("Producer switch is scheduled after its eoe has been popped.");
+    }
+    pending_switches_.emplace_back(num_eoe, num_active);
+    return Status::OK();
+  }
+
  private:
+  // Pop from the first active producer queue with data, starting after the last one popped.
+  // An eoe or eof is held back until every active producer has pushed it.
+  Status PopUnordered(std::unique_ptr<DataBuffer> *result) {
+    std::unique_lock<std::mutex> lk(m_);
+    if (parked_.empty()) {
+      parked_.resize(num_producers_);
+    }
+    while (!end_of_file_) {
+      for (int32_t i = 0; i < num_active_producers_; i++) {
+        int32_t q = (pop_from_ + i) % num_active_producers_;
+        if (parked_[q] != nullptr || queues_[q]->empty()) {
+          continue;
+        }
+        std::unique_ptr<DataBuffer> buf;
+        RETURN_IF_NOT_OK(queues_[q]->PopFront(&buf));
+        if (buf == nullptr) {
+          RETURN_STATUS_UNEXPECTED("[ERROR] nullptr detected when getting data from db connector");
+        }
+        if (buf->eoe() || buf->eof()) {
+          parked_[q] = std::move(buf);
+          num_parked_++;
+          continue;
+        }
+        pop_from_ = (q + 1) % num_active_producers_;
+        *result = std::move(buf);
+        return Status::OK();
+      }
+      if (num_parked_ == num_active_producers_) {
+        *result = std::move(parked_[0]);
+        for (auto &buf : parked_) {
+          buf.reset();
+        }
+        num_parked_ = 0;
+        pop_from_ = 0;
+        if ((*result)->eof()) {
+          end_of_file_ = true;
+        } else {
+          ApplyProducerSwitch();
+        }
+        return Status::OK();
+      }
+      RETURN_IF_NOT_OK(cv_.Wait(&lk, [this]() {
+        for (int32_t q = 0; q < num_active_producers_; q++) {
+          if (parked_[q] == nullptr && !queues_[q]->empty()) {
+            return true;
+          }
+        }
+        return false;
+      }));
+    }
+    *result = std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOF);
+    return Status::OK();
+  }
+
+  // Count a popped eoe and apply the producer switch scheduled at it. Must be called with m_ held.
+  void ApplyProducerSwitch() {
+    std::unique_lock<std::mutex> lk(switch_mux_);
+    num_eoe_popped_++;
+    while (!pending_switches_.empty() && pending_switches_.front().first == num_eoe_popped_) {
+      num_active_producers_ = pending_switches_.front().second;
+      pop_from_ = 0;
+      pending_switches_.pop_front();
+      MS_LOG(DEBUG) << "Connector " << my_name_ << " switches to " << num_active_producers_ << " producers.";
+    }
+  }
+
   // A flag to indicate the end of stream has been encountered.
   bool end_of_file_;
+
+  // The number of producers taking part in the round robin pop.
+  int32_t num_active_producers_;
+
+  // The number of eoe buffers popped so far and the producer switches waiting for an eoe.
+  int64_t num_eoe_popped_;
+  std::deque<std::pair<int64_t, int32_t>> pending_switches_;
+  std::mutex switch_mux_;
+
+  // Unordered mode, see SetUnordered(). parked_ holds the eoe or eof each active producer has pushed so far.
+  bool ordered_;
+  std::vector<std::unique_ptr<DataBuffer>> parked_;
+  int32_t num_parked_;
 };
 }  // namespace dataset
 }  // namespace mindspore
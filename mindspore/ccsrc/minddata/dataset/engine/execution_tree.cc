@@ -16,6 +16,9 @@
 #include "minddata/dataset/engine/execution_tree.h"
 #include <iostream>
 #include <string>
+#include <utility>
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
 #include "minddata/dataset/engine/datasetops/shuffle_op.h"
 #include "minddata/dataset/engine/datasetops/device_queue_op.h"
@@ -30,11 +33,12 @@
 #include "mindspore/ccsrc/minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/perf/profiling.h"
 #include "minddata/dataset/engine/perf/monitor.h"
+#include "minddata/dataset/engine/perf/auto_tune.h"
 
 namespace mindspore {
 namespace dataset {
 // Constructor
-ExecutionTree::ExecutionTree() : id_count_(0) {
+ExecutionTree::ExecutionTree() : id_count_(0), resume_epoch_(0), resume_row_(0) {
   tg_ = std::make_unique<TaskGroup>();
   tree_state_ = kDeTStateInit;
   prepare_flags_ = kDePrepNone;
@@ -150,6 +154,11 @@ Status ExecutionTree::Launch() {
     RETURN_IF_NOT_OK(profiling_manager_->LaunchMonitor());
   }
 
+  if (GlobalContext::config_manager()->enable_autotune()) {
+    auto_tune_ = std::make_unique<AutoTune>(this);
+    RETURN_IF_NOT_OK(tg_->CreateAsyncTask("AutoTune Thread launched", std::ref(*auto_tune_)));
+  }
+
   MS_LOG(DEBUG) << "Printing the tree before launch tasks:\n" << ss.str();
   for (auto itr = this->begin(); itr != this->end(); ++itr) {
     // An inlined operator is one that has an output connector size of 0, and it does not
@@ -331,5 +340,56 @@ Status ExecutionTree::PrepareNode(const std::shared_ptr<DatasetOp> &dataset_op)
 
   return Status::OK();
 }
+// Saves the state of the chain of ops from the root down to the leaf. Each op translates the point to resume at
+// into the point its child has to resume at, so that the leaf knows which of its rows are still to be produced.
+Status ExecutionTree::SaveState(int64_t epoch, int64_t row, nlohmann::json *state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(state != nullptr, "Invalid parameter, state is null.");
+  ResumePoint point;
+  point.epoch = epoch;
+  point.next = row;
+  nlohmann::json ops;
+  std::shared_ptr<DatasetOp> op = root_;
+  while (op != nullptr) {
+    if (op->Children().size() > 1) {
+      RETURN_STATUS_UNEXPECTED("Invalid operation, saving the state of " + op->Name() + " with " +
+                               std::to_string(op->Children().size()) + " children is not supported.");
+    }
+    nlohmann::json op_state;
+    ResumePoint child_point;
+    RETURN_IF_NOT_OK(op->SaveState(point, &op_state, &child_point));
+    op_state["name"] = op->Name();
+    ops[std::to_string(op->id())] = op_state;
+    point = std::move(child_point);
+    op = op->IsLeaf() ? nullptr : op->child(0);
+  }
+  (*state)["epoch"] = epoch;
+  (*state)["row"] = row;
+  (*state)["ops"] = ops;
+  return Status::OK();
+}
+
+Status ExecutionTree::RestoreState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(tree_state_ == kDeTStateReady,
+                               "Invalid operation, the state can only be restored after preparing the tree.");
+  nlohmann::json ops;
+  try {
+    resume_epoch_ = state.at("epoch").get<int64_t>();
+    resume_row_ = state.at("row").get<int64_t>();
+    ops = state.at("ops");
+  } catch (const std::exception &err) {
+    RETURN_STATUS_UNEXPECTED("Invalid data, failed to parse the saved state: " + std::string(err.what()));
+  }
+  std::shared_ptr<DatasetOp> op = root_;
+  while (op != nullptr) {
+    auto op_state = ops.find(std::to_string(op->id()));
+    if (op_state == ops.end() || op_state->value("name", "") != op->Name()) {
+      RETURN_STATUS_UNEXPECTED("Invalid data, the saved state does not match the pipeline at " + op->Name() + ".");
+    }
+    RETURN_IF_NOT_OK(op->RestoreState(*op_state));
+    op->SetCurrentEpoch(static_cast<int32_t>(resume_epoch_));
+    op = op->IsLeaf() ? nullptr : op->child(0);
+  }
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -21,6 +21,7 @@
 #include <stack>
 #include <string>
 #include <vector>
+#include <nlohmann/json.hpp>
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
 #include "minddata/dataset/util/status.h"
 #include "mindspore/ccsrc/minddata/dataset/engine/perf/profiling.h"
@@ -29,6 +30,7 @@ namespace mindspore {
 namespace dataset {
 // Forward declares
 class TaskGroup;
+class AutoTune;
 class DatasetOp;
 
 class ExecutionTree {
@@ -253,6 +255,22 @@ class ExecutionTree {
   // @return total number of epochs
   int32_t num_epochs() { return num_epochs_; }
 
+  // Saves the state every op of a chain of ops needs to resume the pipeline right after the given row.
+  // @param epoch - The epoch the row belongs to
+  // @param row - The number of rows the consumer already got from the epoch
+  // @param state - The saved state
+  // @return Status - The error code return
+  Status SaveState(int64_t epoch, int64_t row, nlohmann::json *state);
+
+  // Restores a state saved by SaveState. The tree must be prepared but not launched yet.
+  // @param state - The saved state
+  // @return Status - The error code return
+  Status RestoreState(const nlohmann::json &state);
+
+  // Getter functions for the position the tree resumes at, 0 if it was not restored
+  int64_t resume_epoch() const { return resume_epoch_; }
+  int64_t resume_row() const { return resume_row_; }
+
  private:
   // A helper functions for doing the recursive printing
   // @param dataset_op - The dataset op to print
@@ -269,7 +287,10 @@ class ExecutionTree {
   TreeState tree_state_;                                 // Tracking the current tree state
   int32_t num_epochs_;                                   // Total number of epochs to run for this tree
   std::unique_ptr<ProfilingManager> profiling_manager_;  // Profiling manager
+  std::unique_ptr<AutoTune> auto_tune_;                  // Tunes workers and connectors while running
   bool optimize_;                                        // Flag to enable optional optimizations
+  int64_t resume_epoch_;                                 // The epoch a restored tree resumes in
+  int64_t resume_row_;                                   // The row a restored tree resumes at
 };
 }  // namespace dataset
 }  // namespace mindspore
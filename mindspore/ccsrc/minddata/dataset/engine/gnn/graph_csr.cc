@@ -0,0 +1,194 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/gnn/graph_csr.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+namespace {
+// Above this ratio of neighbors to samples, the shuffle only records the swapped positions instead of copying
+// all the neighbors of a node
+constexpr int64_t kSparseShuffleRatio = 4;
+}  // namespace
+
+Status GraphCsr::Build(std::vector<std::pair<NodeIdType, NodeType>> nodes,
+                       const std::vector<std::pair<NodeIdType, NodeIdType>> &edges) {
+  // A node loaded twice keeps its first type, as in the node id map
+  std::stable_sort(nodes.begin(), nodes.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+  nodes.erase(std::unique(nodes.begin(), nodes.end(), [](const auto &a, const auto &b) { return a.first == b.first; }),
+              nodes.end());
+  node_ids_.resize(nodes.size());
+  std::vector<NodeType> node_types(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    node_ids_[i] = nodes[i].first;
+    node_types[i] = nodes[i].second;
+  }
+  dense_ids_ = !node_ids_.empty() && static_cast<int64_t>(node_ids_.back()) - node_ids_.front() + 1 == NumNodes();
+  adjacency_.clear();
+  node_features_.clear();
+
+  // Count the neighbors of each node, then place them after the offsets
+  std::vector<std::pair<int64_t, int64_t>> edge_indices(edges.size());
+  for (size_t i = 0; i < edges.size(); ++i) {
+    int64_t src = GetIndex(edges[i].first), dst = GetIndex(edges[i].second);
+    CHECK_FAIL_RETURN_UNEXPECTED(src >= 0, "invalid src_id:" + std::to_string(edges[i].first));
+    CHECK_FAIL_RETURN_UNEXPECTED(dst >= 0, "invalid dst_id:" + std::to_string(edges[i].second));
+    edge_indices[i] = {src, dst};
+    Adjacency &adjacency = adjacency_[node_types[dst]];
+    if (adjacency.offsets.empty()) {
+      adjacency.offsets.assign(node_ids_.size() + 1, 0);
+    }
+    ++adjacency.offsets[src + 1];
+  }
+  std::unordered_map<NodeType, std::vector<int64_t>> positions;
+  for (auto &itr : adjacency_) {
+    std::vector<int64_t> &offsets = itr.second.offsets;
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    itr.second.neighbors.resize(offsets.back());
+    positions[itr.first].assign(offsets.begin(), offsets.end() - 1);
+  }
+  for (const auto &edge : edge_indices) {
+    NodeType type = node_types[edge.second];
+    adjacency_[type].neighbors[positions[type][edge.first]++] = node_ids_[edge.second];
+  }
+  for (auto &itr : adjacency_) {
+    auto neighbors = itr.second.neighbors.begin();
+    const std::vector<int64_t> &offsets = itr.second.offsets;
+    for (int64_t i = 0; i < NumNodes(); ++i) {
+      std::sort(neighbors + offsets[i], neighbors + offsets[i + 1]);
+    }
+  }
+  return Status::OK();
+}
+
+int64_t GraphCsr::GetIndex(NodeIdType id) const {
+  if (dense_ids_) {
+    int64_t index = static_cast<int64_t>(id) - node_ids_.front();
+    return index >= 0 && index < NumNodes() ? index : -1;
+  }
+  auto itr = std::lower_bound(node_ids_.begin(), node_ids_.end(), id);
+  return itr != node_ids_.end() && *itr == id ? itr - node_ids_.begin() : -1;
+}
+
+GraphCsr::NeighborRange GraphCsr::GetNeighbors(int64_t index, NodeType neighbor_type) const {
+  auto itr = adjacency_.find(neighbor_type);
+  if (itr == adjacency_.end() || index < 0 || index >= NumNodes()) {
+    return {nullptr, nullptr};
+  }
+  const NodeIdType *neighbors = itr->second.neighbors.data();
+  return {neighbors + itr->second.offsets[index], neighbors + itr->second.offsets[index + 1]};
+}
+
+Status GraphCsr::SampleNeighbors(const std::vector<NodeIdType> &node_list, NodeType neighbor_type,
+                                 int32_t samples_num, std::mt19937 *rnd, std::vector<NodeIdType> *out) const {
+  out->resize(node_list.size() * samples_num);
+  auto out_itr = out->begin();
+  std::vector<NodeIdType> pool;                     // neighbors of a node, partially shuffled
+  std::unordered_map<int64_t, NodeIdType> swapped;  // neighbors moved by the sparse shuffle, by position
+  for (const auto &node_id : node_list) {
+    NeighborRange neighbors = {nullptr, nullptr};
+    if (node_id != kDefaultNodeId) {
+      int64_t index = GetIndex(node_id);
+      CHECK_FAIL_RETURN_UNEXPECTED(index >= 0, "Invalid node id:" + std::to_string(node_id));
+      neighbors = GetNeighbors(index, neighbor_type);
+    }
+    int64_t degree = neighbors.second - neighbors.first;
+    if (degree == 0) {
+      out_itr = std::fill_n(out_itr, samples_num, kDefaultNodeId);
+      continue;
+    }
+    // Partial Fisher-Yates shuffles, each one draws distinct neighbors
+    for (int64_t remaining = samples_num; remaining > 0;) {
+      int64_t num = std::min(remaining, degree);
+      if (num * kSparseShuffleRatio >= degree) {
+        pool.assign(neighbors.first, neighbors.second);
+        for (int64_t i = 0; i < num; ++i) {
+          std::uniform_int_distribution<int64_t> distribution(i, degree - 1);
+          std::swap(pool[i], pool[distribution(*rnd)]);
+          *out_itr++ = pool[i];
+        }
+      } else {
+        swapped.clear();
+        auto neighbor_at = [&neighbors, &swapped](int64_t pos) {
+          auto itr = swapped.find(pos);
+          return itr == swapped.end() ? neighbors.first[pos] : itr->second;
+        };
+        for (int64_t i = 0; i < num; ++i) {
+          std::uniform_int_distribution<int64_t> distribution(i, degree - 1);
+          int64_t pos = distribution(*rnd);
+          NodeIdType neighbor = neighbor_at(pos);
+          swapped[pos] = neighbor_at(i);
+          *out_itr++ = neighbor;
+        }
+      }
+      remaining -= num;
+    }
+  }
+  return Status::OK();
+}
+
+Status GraphCsr::UpdateNodeFeature(NodeIdType id, const std::shared_ptr<Feature> &feature) {
+  int64_t index = GetIndex(id);
+  CHECK_FAIL_RETURN_UNEXPECTED(index >= 0, "Invalid node id:" + std::to_string(id));
+  const std::shared_ptr<Tensor> value = feature->Value();
+  CHECK_FAIL_RETURN_UNEXPECTED(value->type().IsNumeric(),
+                               "Node feature is not numeric, feature type:" + std::to_string(feature->type()));
+  auto itr = node_features_.find(feature->type());
+  if (itr == node_features_.end()) {
+    FeatureMatrix matrix;
+    matrix.type = value->type();
+    matrix.shape = value->shape().AsVector();
+    matrix.row_bytes = value->SizeInBytes();
+    matrix.data.assign(node_ids_.size() * matrix.row_bytes, 0);
+    itr = node_features_.emplace(feature->type(), std::move(matrix)).first;
+  }
+  FeatureMatrix &matrix = itr->second;
+  CHECK_FAIL_RETURN_UNEXPECTED(value->type() == matrix.type && value->shape().AsVector() == matrix.shape,
+                               "Node features of type " + std::to_string(feature->type()) +
+                                 " differ in shape or data type, node id:" + std::to_string(id));
+  std::copy(value->GetBuffer(), value->GetBuffer() + matrix.row_bytes, matrix.data.begin() + index * matrix.row_bytes);
+  return Status::OK();
+}
+
+Status GraphCsr::GetNodeFeature(const std::shared_ptr<Tensor> &nodes, FeatureType feature_type,
+                                std::shared_ptr<Tensor> *out) const {
+  auto itr = node_features_.find(feature_type);
+  CHECK_FAIL_RETURN_UNEXPECTED(itr != node_features_.end(), "Invalid feature type:" + std::to_string(feature_type));
+  const FeatureMatrix &matrix = itr->second;
+  std::vector<uint8_t> rows(nodes->Size() * matrix.row_bytes, 0);
+  auto row_itr = rows.begin();
+  for (auto node_itr = nodes->begin<NodeIdType>(); node_itr != nodes->end<NodeIdType>(); ++node_itr) {
+    if (*node_itr != kDefaultNodeId) {
+      int64_t index = GetIndex(*node_itr);
+      CHECK_FAIL_RETURN_UNEXPECTED(index >= 0, "Invalid node id:" + std::to_string(*node_itr));
+      auto src = matrix.data.begin() + index * matrix.row_bytes;
+      std::copy(src, src + matrix.row_bytes, row_itr);
+    }
+    row_itr += matrix.row_bytes;
+  }
+  TensorShape shape(nodes->shape());
+  for (auto s : matrix.shape) {
+    shape = shape.AppendDim(s);
+  }
+  return Tensor::CreateFromMemory(shape, matrix.type, rows.data(), out);
+}
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,118 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
+
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/engine/gnn/feature.h"
+#include "minddata/dataset/engine/gnn/node.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+
+// Immutable compressed sparse row storage of a graph. The nodes are indexed by their position in the sorted array
+// of node ids, and for each neighbor type the neighbors of the node at index i are
+// neighbors[offsets[i], offsets[i + 1]), sorted by id. Node features are stored as one matrix per feature type,
+// a row per node, with zero rows for the nodes which don't have the feature.
+class GraphCsr {
+ public:
+  using NeighborRange = std::pair<const NodeIdType *, const NodeIdType *>;
+
+  GraphCsr() = default;
+
+  ~GraphCsr() = default;
+
+  // Build the node index and the neighbor arrays, the previous content is dropped
+  // @param std::vector<std::pair<NodeIdType, NodeType>> nodes - id and type of each node
+  // @param std::vector<std::pair<NodeIdType, NodeIdType>> &edges - source and destination of each edge
+  // @return Status - The error code return
+  Status Build(std::vector<std::pair<NodeIdType, NodeType>> nodes,
+               const std::vector<std::pair<NodeIdType, NodeIdType>> &edges);
+
+  // @return int64_t - number of nodes
+  int64_t NumNodes() const { return static_cast<int64_t>(node_ids_.size()); }
+
+  // Find the index of a node
+  // @param NodeIdType id - node id
+  // @return int64_t - index of the node, -1 if there is no node with this id
+  int64_t GetIndex(NodeIdType id) const;
+
+  // Get the neighbors of a node
+  // @param int64_t index - index of the node
+  // @param NodeType neighbor_type - type of neighbor
+  // @return NeighborRange - the neighbor ids, an empty range if the node has no neighbor of this type
+  NeighborRange GetNeighbors(int64_t index, NodeType neighbor_type) const;
+
+  // Sample the neighbors of a batch of nodes. As many distinct neighbors as possible are sampled, a node with
+  // fewer neighbors than samples_num repeats them. kDefaultNodeId and the nodes without neighbors get
+  // samples_num kDefaultNodeId
+  // @param std::vector<NodeIdType> &node_list - ids of the nodes
+  // @param NodeType neighbor_type - type of neighbor
+  // @param int32_t samples_num - number of neighbors to sample for each node
+  // @param std::mt19937 *rnd - random engine
+  // @param std::vector<NodeIdType> *out - Returned neighbors, samples_num for each node in node_list order
+  // @return Status - The error code return
+  Status SampleNeighbors(const std::vector<NodeIdType> &node_list, NodeType neighbor_type, int32_t samples_num,
+                         std::mt19937 *rnd, std::vector<NodeIdType> *out) const;
+
+  // Copy a feature of a node to its row of the feature matrix, the matrix is created by the first feature of a type
+  // @param NodeIdType id - node id
+  // @param std::shared_ptr<Feature> &feature - the feature, of the same type and shape for all nodes
+  // @return Status - The error code return
+  Status UpdateNodeFeature(NodeIdType id, const std::shared_ptr<Feature> &feature);
+
+  // @param FeatureType feature_type - type of feature
+  // @return bool - whether the node features of this type are stored in a matrix
+  bool HasNodeFeature(FeatureType feature_type) const { return node_features_.count(feature_type) > 0; }
+
+  // Gather the feature rows of nodes, zero for kDefaultNodeId
+  // @param std::shared_ptr<Tensor> &nodes - ids of the nodes
+  // @param FeatureType feature_type - type of feature
+  // @param std::shared_ptr<Tensor> *out - Returned features, of the shape of nodes followed by the feature shape
+  // @return Status - The error code return
+  Status GetNodeFeature(const std::shared_ptr<Tensor> &nodes, FeatureType feature_type,
+                        std::shared_ptr<Tensor> *out) const;
+
+ private:
+  struct Adjacency {
+    std::vector<int64_t> offsets;       // NumNodes() + 1 offsets in neighbors
+    std::vector<NodeIdType> neighbors;  // neighbor ids, grouped by node
+  };
+
+  struct FeatureMatrix {
+    DataType type;
+    std::vector<dsize_t> shape;  // shape of the feature of a node
+    dsize_t row_bytes = 0;       // size of the feature of a node
+    std::vector<uint8_t> data;   // NumNodes() rows
+  };
+
+  std::vector<NodeIdType> node_ids_;  // sorted
+  bool dense_ids_ = false;            // whether node_ids_ are consecutive, so an index is an offset from the first
+  std::unordered_map<NodeType, Adjacency> adjacency_;
+  std::unordered_map<FeatureType, FeatureMatrix> node_features_;
+};
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
@@ -16,6 +16,7 @@
 #include "minddata/dataset/engine/gnn/graph_data_impl.h"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
 #include <numeric>
@@ -24,6 +25,7 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/gnn/graph_loader.h"
 #include "minddata/dataset/util/random.h"
+#include "minddata/dataset/util/task_manager.h"
 namespace mindspore {
 namespace dataset {
 namespace gnn {
@@ -32,13 +34,15 @@ GraphDataImpl::GraphDataImpl(std::string dataset_file, int32_t num_workers, bool
     : dataset_file_(dataset_file),
       num_workers_(num_workers),
       rnd_(GetRandomDevice()),
-      random_walk_(this),
       server_mode_(server_mode) {
   rnd_.seed(GetSeed());
   MS_LOG(INFO) << "num_workers:" << num_workers;
 }
 
-GraphDataImpl::~GraphDataImpl() {}
+GraphDataImpl::~GraphDataImpl() {
+  // Interrupt the sample workers before their queue goes away
+  (void)sample_workers_.ServiceStop();
+}
 
 Status GraphDataImpl::GetAllNodes(NodeType node_type, std::shared_ptr<Tensor> *out) {
   auto itr = node_type_map_.find(node_type);
@@ -137,9 +141,12 @@ Status GraphDataImpl::GetAllNeighbors(const std::vector<NodeIdType> &node_list,
   size_t max_neighbor_num = 0;
   neighbors.resize(node_list.size());
   for (size_t i = 0; i < node_list.size(); ++i) {
-    std::shared_ptr<Node> node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[i], &node));
-    RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i]));
+    int64_t index = -1;
+    RETURN_IF_NOT_OK(GetNodeIndex(node_list[i], &index));
+    GraphCsr::NeighborRange range = csr_.GetNeighbors(index, neighbor_type);
+    neighbors[i].reserve(range.second - range.first + 1);
+    neighbors[i].push_back(node_list[i]);
+    neighbors[i].insert(neighbors[i].end(), range.first, range.second);
     max_neighbor_num = max_neighbor_num > neighbors[i].size() ? max_neighbor_num : neighbors[i].size();
   }
 
@@ -183,30 +190,28 @@ Status GraphDataImpl::GetSampledNeighbors(const std::vector<NodeIdType> &node_li
   }
   std::vector<std::vector<NodeIdType>> neighbors_vec(node_list.size());
   for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
-    std::shared_ptr<Node> input_node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &input_node));
+    int64_t index = -1;
+    RETURN_IF_NOT_OK(GetNodeIndex(node_list[node_idx], &index));
     neighbors_vec[node_idx].emplace_back(node_list[node_idx]);
-    std::vector<NodeIdType> input_list = {node_list[node_idx]};
+  }
+  // Sample a hop for a whole block of nodes at once, the samples of each input node are consecutive, so the samples
+  // of a node of node_list are a range of the hop
+  auto sample_block = [&](size_t begin, size_t end, std::mt19937 *rnd) -> Status {
+    std::vector<NodeIdType> input_list(node_list.begin() + begin, node_list.begin() + end);
+    size_t samples_size = 1;
     for (size_t i = 0; i < neighbor_nums.size(); ++i) {
       std::vector<NodeIdType> neighbors;
-      neighbors.reserve(input_list.size() * neighbor_nums[i]);
-      for (const auto &node_id : input_list) {
-        if (node_id == kDefaultNodeId) {
-          for (int32_t j = 0; j < neighbor_nums[i]; ++j) {
-            neighbors.emplace_back(kDefaultNodeId);
-          }
-        } else {
-          std::shared_ptr<Node> node;
-          RETURN_IF_NOT_OK(GetNodeByNodeId(node_id, &node));
-          std::vector<NodeIdType> out;
-          RETURN_IF_NOT_OK(node->GetSampledNeighbors(neighbor_types[i], neighbor_nums[i], &out));
-          neighbors.insert(neighbors.end(), out.begin(), out.end());
-        }
+      RETURN_IF_NOT_OK(csr_.SampleNeighbors(input_list, neighbor_types[i], neighbor_nums[i], rnd, &neighbors));
+      samples_size *= neighbor_nums[i];
+      for (size_t node_idx = begin; node_idx < end; ++node_idx) {
+        auto samples = neighbors.begin() + (node_idx - begin) * samples_size;
+        neighbors_vec[node_idx].insert(neighbors_vec[node_idx].end(), samples, samples + samples_size);
       }
-      neighbors_vec[node_idx].insert(neighbors_vec[node_idx].end(), neighbors.begin(), neighbors.end());
       input_list = std::move(neighbors);
     }
-  }
+    return Status::OK();
+  };
+  RETURN_IF_NOT_OK(ParallelSample(node_list.size(), sample_block));
   RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>(neighbors_vec, DataType(DataType::DE_INT32), out));
   return Status::OK();
 }
@@ -239,22 +244,20 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
   const std::vector<NodeIdType> &all_nodes = node_type_map_[neg_neighbor_type];
   std::vector<NodeIdType> shuffled_id(all_nodes.size());
   std::iota(shuffled_id.begin(), shuffled_id.end(), 0);
-  std::shuffle(shuffled_id.begin(), shuffled_id.end(), rnd_);
+  std::mt19937 rnd(GetSampleSeed());
+  std::shuffle(shuffled_id.begin(), shuffled_id.end(), rnd);
   size_t start_index = 0;
   bool need_shuffle = false;
 
   std::vector<std::vector<NodeIdType>> neg_neighbors_vec;
   neg_neighbors_vec.resize(node_list.size());
   for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
-    std::shared_ptr<Node> node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &node));
-    std::vector<NodeIdType> neighbors;
-    RETURN_IF_NOT_OK(node->GetAllNeighbors(neg_neighbor_type, &neighbors));
-    std::unordered_set<NodeIdType> exclude_nodes;
-    std::transform(neighbors.begin(), neighbors.end(),
-                   std::insert_iterator<std::unordered_set<NodeIdType>>(exclude_nodes, exclude_nodes.begin()),
-                   [](const NodeIdType node) { return node; });
-    neg_neighbors_vec[node_idx].emplace_back(node->id());
+    int64_t index = -1;
+    RETURN_IF_NOT_OK(GetNodeIndex(node_list[node_idx], &index));
+    GraphCsr::NeighborRange neighbors = csr_.GetNeighbors(index, neg_neighbor_type);
+    std::unordered_set<NodeIdType> exclude_nodes(neighbors.first, neighbors.second);
+    exclude_nodes.insert(node_list[node_idx]);
+    neg_neighbors_vec[node_idx].emplace_back(node_list[node_idx]);
     if (all_nodes.size() > exclude_nodes.size()) {
       while (neg_neighbors_vec[node_idx].size() < samples_num + 1) {
         RETURN_IF_NOT_OK(NegativeSample(all_nodes, shuffled_id, &start_index, exclude_nodes, samples_num + 1,
@@ -265,7 +268,7 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
         }
       }
     } else {
-      MS_LOG(DEBUG) << "There are no negative neighbors. node_id:" << node->id()
+      MS_LOG(DEBUG) << "There are no negative neighbors. node_id:" << node_list[node_idx]
                     << " neg_neighbor_type:" << neg_neighbor_type;
       // If there are no negative neighbors, they are filled with kDefaultNodeId
       for (int32_t i = 0; i < samples_num; ++i) {
@@ -273,7 +276,7 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
       }
     }
     if (need_shuffle) {
-      std::shuffle(shuffled_id.begin(), shuffled_id.end(), rnd_);
+      std::shuffle(shuffled_id.begin(), shuffled_id.end(), rnd);
       start_index = 0;
       need_shuffle = false;
     }
@@ -285,9 +288,12 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
 Status GraphDataImpl::RandomWalk(const std::vector<NodeIdType> &node_list, const std::vector<NodeType> &meta_path,
                                  float step_home_param, float step_away_param, NodeIdType default_node,
                                  std::shared_ptr<Tensor> *out) {
-  RETURN_IF_NOT_OK(random_walk_.Build(node_list, meta_path, step_home_param, step_away_param, default_node));
+  // The walker holds the parameters of a request, the requests of a server can run concurrently
+  RandomWalkBase random_walk(this);
+  RETURN_IF_NOT_OK(
+    random_walk.Build(node_list, meta_path, step_home_param, step_away_param, default_node, 1, num_workers_));
   std::vector<std::vector<NodeIdType>> walks;
-  RETURN_IF_NOT_OK(random_walk_.SimulateWalk(&walks));
+  RETURN_IF_NOT_OK(random_walk.SimulateWalk(&walks));
   RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>({walks}, DataType(DataType::DE_INT32), out));
   return Status::OK();
 }
@@ -322,6 +328,14 @@ Status GraphDataImpl::GetNodeFeature(const std::shared_ptr<Tensor> &nodes,
   CHECK_FAIL_RETURN_UNEXPECTED(!feature_types.empty(), "Input feature_types is empty");
   TensorRow tensors;
   for (const auto &f_type : feature_types) {
+    if (csr_.HasNodeFeature(f_type)) {
+      // Gather the rows of the feature matrix, zero rows are the default value
+      std::shared_ptr<Tensor> fea_tensor;
+      RETURN_IF_NOT_OK(csr_.GetNodeFeature(nodes, f_type, &fea_tensor));
+      fea_tensor->Squeeze();
+      tensors.push_back(fea_tensor);
+      continue;
+    }
     std::shared_ptr<Feature> default_feature;
     // If no feature can be obtained, fill in the default value
     RETURN_IF_NOT_OK(GetNodeDefaultFeature(f_type, &default_feature));
@@ -480,6 +494,7 @@ Status GraphDataImpl::GetEdgeFeatureSharedMemory(const std::shared_ptr<Tensor> &
 
 Status GraphDataImpl::Init() {
   RETURN_IF_NOT_OK(LoadNodeAndEdge());
+  RETURN_IF_NOT_OK(StartSampleWorkers());
   return Status::OK();
 }
 
@@ -567,6 +582,94 @@ Status GraphDataImpl::GetEdgeByEdgeId(EdgeIdType id, std::shared_ptr<Edge> *edge
   return Status::OK();
 }
 
+Status GraphDataImpl::GetNodeIndex(NodeIdType id, int64_t *index) {
+  *index = csr_.GetIndex(id);
+  if (*index < 0) {
+    std::string err_msg = "Invalid node id:" + std::to_string(id);
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  return Status::OK();
+}
+
+uint32_t GraphDataImpl::GetSampleSeed() {
+  std::unique_lock<std::mutex> lck(rnd_mutex_);
+  return rnd_();
+}
+
+Status GraphDataImpl::ParallelSample(size_t num_items,
+                                     const std::function<Status(size_t, size_t, std::mt19937 *)> &func) {
+  auto job = std::make_shared<SampleJob>();
+  job->num_items = num_items;
+  job->num_blocks = (num_items + kSampleBlockSize - 1) / kSampleBlockSize;
+  job->seed = GetSampleSeed();
+  job->func = &func;
+  if (job->num_blocks == 0) {
+    return Status::OK();
+  }
+  // One idle worker per block beyond the one of this thread is enough, the others are left to concurrent requests
+  size_t num_helpers = std::min(static_cast<size_t>(sample_workers_.size()), job->num_blocks - 1);
+  for (size_t i = 0; i < num_helpers; ++i) {
+    // The queue only fails once the workers are shut down, this thread then samples the remaining blocks alone
+    if (sample_queue_->Add(job).IsError()) {
+      break;
+    }
+  }
+  SampleBlocks(job.get());
+  // func lives on this stack, so wait for the blocks claimed by the workers. A worker which picks the job up later
+  // finds no block left and only touches the job.
+  std::unique_lock<std::mutex> lck(job->mux);
+  job->done_cv.wait(lck, [&job]() { return job->num_done == job->num_blocks; });
+  return job->rc;
+}
+
+void GraphDataImpl::SampleBlocks(SampleJob *job) {
+  for (size_t block = job->next_block++; block < job->num_blocks; block = job->next_block++) {
+    Status rc;
+    {
+      std::unique_lock<std::mutex> lck(job->mux);
+      rc = job->rc;
+    }
+    // The result is dropped on the first error, skip the remaining blocks
+    if (rc.IsOk()) {
+      std::seed_seq block_seed{job->seed, static_cast<uint32_t>(block)};
+      std::mt19937 rnd(block_seed);
+      size_t begin = block * kSampleBlockSize;
+      rc = (*job->func)(begin, std::min(begin + kSampleBlockSize, job->num_items), &rnd);
+    }
+    std::unique_lock<std::mutex> lck(job->mux);
+    if (rc.IsError() && job->rc.IsOk()) {
+      job->rc = rc;
+    }
+    if (++job->num_done == job->num_blocks) {
+      job->done_cv.notify_all();
+    }
+  }
+}
+
+Status GraphDataImpl::StartSampleWorkers() {
+  // The requesting thread samples too, so num_workers_ threads work on a request when the workers are idle
+  if (num_workers_ <= 1) {
+    return Status::OK();
+  }
+  sample_queue_ = std::make_unique<Queue<std::shared_ptr<SampleJob>>>(kSampleQueueCapacity);
+  RETURN_IF_NOT_OK(sample_queue_->Register(&sample_workers_));
+  for (int32_t i = 1; i < num_workers_; ++i) {
+    RETURN_IF_NOT_OK(
+      sample_workers_.CreateAsyncTask("GraphSampler", std::bind(&GraphDataImpl::SampleWorker, this)));
+  }
+  return Status::OK();
+}
+
+Status GraphDataImpl::SampleWorker() {
+  TaskManager::FindMe()->Post();
+  // Loop until the queue is interrupted by the shutdown of the graph
+  while (true) {
+    std::shared_ptr<SampleJob> job;
+    RETURN_IF_NOT_OK(sample_queue_->PopFront(&job));
+    SampleBlocks(job.get());
+  }
+}
+
 GraphDataImpl::RandomWalkBase::RandomWalkBase(GraphDataImpl *graph)
     : graph_(graph), step_home_param_(1.0), step_away_param_(1.0), default_node_(-1), num_walks_(1), num_workers_(1) {}
 
@@ -611,35 +714,34 @@ Status GraphDataImpl::RandomWalkBase::Build(const std::vector<NodeIdType> &node_
   return Status::OK();
 }
 
-Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node, std::vector<NodeIdType> *walk_path) {
+Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node, std::mt19937 *rnd,
+                                                   std::vector<NodeIdType> *walk_path) {
   // Simulate a random walk starting from start node.
   auto walk = std::vector<NodeIdType>(1, start_node);  // walk is an vector
   // walk simulate
   while (walk.size() - 1 < meta_path_.size()) {
     // current nodE
     auto cur_node_id = walk.back();
-    std::shared_ptr<Node> cur_node;
-    RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(cur_node_id, &cur_node));
+    int64_t cur_index = -1;
+    RETURN_IF_NOT_OK(graph_->GetNodeIndex(cur_node_id, &cur_index));
 
-    // current neighbors
-    std::vector<NodeIdType> cur_neighbors;
-    RETURN_IF_NOT_OK(cur_node->GetAllNeighbors(meta_path_[walk.size() - 1], &cur_neighbors, true));
-    std::sort(cur_neighbors.begin(), cur_neighbors.end());
+    // current neighbors, sorted in the CSR arrays
+    GraphCsr::NeighborRange cur_neighbors = graph_->csr_.GetNeighbors(cur_index, meta_path_[walk.size() - 1]);
 
     // break if no neighbors
-    if (cur_neighbors.empty()) {
+    if (cur_neighbors.first == cur_neighbors.second) {
       break;
     }
 
     // walk by the fist node, then by the previous 2 nodes
     std::shared_ptr<StochasticIndex> stochastic_index;
     if (walk.size() == 1) {
-      RETURN_IF_NOT_OK(GetNodeProbability(cur_node_id, meta_path_[0], &stochastic_index));
+      RETURN_IF_NOT_OK(GetNodeProbability(cur_node_id, meta_path_[0], rnd, &stochastic_index));
     } else {
       NodeIdType prev_node_id = walk[walk.size() - 2];
-      RETURN_IF_NOT_OK(GetEdgeProbability(prev_node_id, cur_node_id, walk.size() - 2, &stochastic_index));
+      RETURN_IF_NOT_OK(GetEdgeProbability(prev_node_id, cur_node_id, walk.size() - 2, rnd, &stochastic_index));
     }
-    NodeIdType next_node_id = cur_neighbors[WalkToNextNode(*stochastic_index)];
+    NodeIdType next_node_id = cur_neighbors.first[WalkToNextNode(*stochastic_index, rnd)];
     walk.push_back(next_node_id);
   }
 
@@ -652,53 +754,52 @@ Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node,
 }
 
 Status GraphDataImpl::RandomWalkBase::SimulateWalk(std::vector<std::vector<NodeIdType>> *walks) {
-  for (int32_t i = 0; i < num_walks_; ++i) {
-    for (const auto &node : node_list_) {
-      std::vector<NodeIdType> walk;
-      RETURN_IF_NOT_OK(Node2vecWalk(node, &walk));
-      walks->push_back(walk);
+  // num_walks_ rounds over node_list_, the walks are independent and run in parallel
+  walks->resize(num_walks_ * node_list_.size());
+  auto walk_block = [this, walks](size_t begin, size_t end, std::mt19937 *rnd) -> Status {
+    for (size_t i = begin; i < end; ++i) {
+      RETURN_IF_NOT_OK(Node2vecWalk(node_list_[i % node_list_.size()], rnd, &(*walks)[i]));
     }
-  }
+    return Status::OK();
+  };
+  RETURN_IF_NOT_OK(graph_->ParallelSample(walks->size(), walk_block));
   return Status::OK();
 }
 
 Status GraphDataImpl::RandomWalkBase::GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type,
+                                                         std::mt19937 *rnd,
                                                          std::shared_ptr<StochasticIndex> *node_probability) {
   // Generate alias nodes
-  std::shared_ptr<Node> node;
-  graph_->GetNodeByNodeId(node_id, &node);
-  std::vector<NodeIdType> neighbors;
-  RETURN_IF_NOT_OK(node->GetAllNeighbors(node_type, &neighbors, true));
-  std::sort(neighbors.begin(), neighbors.end());
-  auto non_normalized_probability = std::vector<float>(neighbors.size(), 1.0);
+  int64_t index = -1;
+  RETURN_IF_NOT_OK(graph_->GetNodeIndex(node_id, &index));
+  GraphCsr::NeighborRange neighbors = graph_->csr_.GetNeighbors(index, node_type);
+  auto non_normalized_probability = std::vector<float>(neighbors.second - neighbors.first, 1.0);
   *node_probability =
-    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability)));
+    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability), rnd));
   return Status::OK();
 }
 
 Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src, const NodeIdType &dst,
-                                                         uint32_t meta_path_index,
+                                                         uint32_t meta_path_index, std::mt19937 *rnd,
                                                          std::shared_ptr<StochasticIndex> *edge_probability) {
   // Get the alias edge setup lists for a given edge.
-  std::shared_ptr<Node> src_node;
-  graph_->GetNodeByNodeId(src, &src_node);
-  std::vector<NodeIdType> src_neighbors;
-  RETURN_IF_NOT_OK(src_node->GetAllNeighbors(meta_path_[meta_path_index], &src_neighbors, true));
+  int64_t src_index = -1;
+  RETURN_IF_NOT_OK(graph_->GetNodeIndex(src, &src_index));
+  GraphCsr::NeighborRange src_neighbors = graph_->csr_.GetNeighbors(src_index, meta_path_[meta_path_index]);
 
-  std::shared_ptr<Node> dst_node;
-  graph_->GetNodeByNodeId(dst, &dst_node);
-  std::vector<NodeIdType> dst_neighbors;
-  RETURN_IF_NOT_OK(dst_node->GetAllNeighbors(meta_path_[meta_path_index + 1], &dst_neighbors, true));
+  int64_t dst_index = -1;
+  RETURN_IF_NOT_OK(graph_->GetNodeIndex(dst, &dst_index));
+  GraphCsr::NeighborRange dst_neighbors = graph_->csr_.GetNeighbors(dst_index, meta_path_[meta_path_index + 1]);
 
-  std::sort(dst_neighbors.begin(), dst_neighbors.end());
   std::vector<float> non_normalized_probability;
-  for (const auto &dst_nbr : dst_neighbors) {
+  non_normalized_probability.reserve(dst_neighbors.second - dst_neighbors.first);
+  for (auto dst_itr = dst_neighbors.first; dst_itr != dst_neighbors.second; ++dst_itr) {
+    NodeIdType dst_nbr = *dst_itr;
     if (dst_nbr == src) {
       non_normalized_probability.push_back(1.0 / step_home_param_);  // replace 1.0 with G[dst][dst_nbr]['weight']
       continue;
     }
-    auto it = std::find(src_neighbors.begin(), src_neighbors.end(), dst_nbr);
-    if (it != src_neighbors.end()) {
+    if (std::binary_search(src_neighbors.first, src_neighbors.second, dst_nbr)) {
       // stay close, this node connect both src and dst
       non_normalized_probability.push_back(1.0);  // replace 1.0 with G[dst][dst_nbr]['weight']
     } else {
@@ -708,21 +809,21 @@ Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src,
   }
 
   *edge_probability =
-    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability)));
+    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability), rnd));
   return Status::OK();
 }
 
-StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::vector<float> &probability) {
+StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::vector<float> &probability,
+                                                                   std::mt19937 *rnd) {
   uint32_t K = probability.size();
   std::vector<int32_t> switch_to_large_index(K, 0);
   std::vector<float> weight(K, .0);
   std::vector<int32_t> smaller;
   std::vector<int32_t> larger;
-  auto random_device = GetRandomDevice();
   std::uniform_real_distribution<> distribution(-kGnnEpsilon, kGnnEpsilon);
   float accumulate_threshold = 0.0;
   for (uint32_t i = 0; i < K; i++) {
-    float threshold_one = distribution(random_device);
+    float threshold_one = distribution(*rnd);
     accumulate_threshold += threshold_one;
     weight[i] = i < K - 1 ? probability[i] * K + threshold_one : probability[i] * K - accumulate_threshold;
     weight[i] < 1.0 ? smaller.push_back(i) : larger.push_back(i);
@@ -740,18 +841,17 @@ StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::ve
   return StochasticIndex(switch_to_large_index, weight);
 }
 
-uint32_t GraphDataImpl::RandomWalkBase::WalkToNextNode(const StochasticIndex &stochastic_index) {
-  auto switch_to_large_index = stochastic_index.first;
-  auto weight = stochastic_index.second;
+uint32_t GraphDataImpl::RandomWalkBase::WalkToNextNode(const StochasticIndex &stochastic_index, std::mt19937 *rnd) {
+  const auto &switch_to_large_index = stochastic_index.first;
+  const auto &weight = stochastic_index.second;
   const uint32_t size_of_index = switch_to_large_index.size();
 
-  auto random_device = GetRandomDevice();
   std::uniform_real_distribution<> distribution(0.0, 1.0);
 
   // Generate random integer between [0, K)
-  uint32_t random_idx = std::floor(distribution(random_device) * size_of_index);
+  uint32_t random_idx = std::floor(distribution(*rnd) * size_of_index);
 
-  if (distribution(random_device) < weight[random_idx]) {
+  if (distribution(*rnd) < weight[random_idx]) {
     return random_idx;
   }
   return switch_to_large_index[random_idx];
@@ -17,7 +17,12 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_DATA_IMPL_H_
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <string>
 #include <map>
 #include <unordered_map>
@@ -25,10 +30,13 @@
 #include <vector>
 #include <utility>
 
+#include "minddata/dataset/engine/gnn/graph_csr.h"
 #include "minddata/dataset/engine/gnn/graph_data.h"
 #if !defined(_WIN32) && !defined(_WIN64)
 #include "minddata/dataset/engine/gnn/graph_shared_memory.h"
 #endif
+#include "minddata/dataset/util/queue.h"
+#include "minddata/dataset/util/task_manager.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
 
 namespace mindspore {
@@ -37,6 +45,8 @@ namespace gnn {
 
 const float kGnnEpsilon = 0.0001;
 const uint32_t kMaxNumWalks = 80;
+const size_t kSampleBlockSize = 128;  // Number of nodes sampled with one random stream
+const int32_t kSampleQueueCapacity = 128;  // Pending jobs of the sample workers, the requesters wait beyond it
 using StochasticIndex = std::pair<std::vector<int32_t>, std::vector<float>>;
 
 class GraphDataImpl : public GraphData {
@@ -175,17 +185,17 @@ class GraphDataImpl : public GraphData {
     Status SimulateWalk(std::vector<std::vector<NodeIdType>> *walks);
 
    private:
-    Status Node2vecWalk(const NodeIdType &start_node, std::vector<NodeIdType> *walk_path);
+    Status Node2vecWalk(const NodeIdType &start_node, std::mt19937 *rnd, std::vector<NodeIdType> *walk_path);
 
-    Status GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type,
+    Status GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type, std::mt19937 *rnd,
                               std::shared_ptr<StochasticIndex> *node_probability);
 
     Status GetEdgeProbability(const NodeIdType &src, const NodeIdType &dst, uint32_t meta_path_index,
-                              std::shared_ptr<StochasticIndex> *edge_probability);
+                              std::mt19937 *rnd, std::shared_ptr<StochasticIndex> *edge_probability);
 
-    static StochasticIndex GenerateProbability(const std::vector<float> &probability);
+    static StochasticIndex GenerateProbability(const std::vector<float> &probability, std::mt19937 *rnd);
 
-    static uint32_t WalkToNextNode(const StochasticIndex &stochastic_index);
+    static uint32_t WalkToNextNode(const StochasticIndex &stochastic_index, std::mt19937 *rnd);
 
     template <typename T>
     std::vector<float> Normalize(const std::vector<T> &non_normalized_probability);
@@ -245,6 +255,12 @@ class GraphDataImpl : public GraphData {
   // @return Status - The error code return
   Status GetEdgeByEdgeId(EdgeIdType id, std::shared_ptr<Edge> *edge);
 
+  // Find the index of a node in the CSR arrays
+  // @param NodeIdType id -
+  // @param int64_t *index - Returned node index
+  // @return Status - The error code return
+  Status GetNodeIndex(NodeIdType id, int64_t *index);
+
   // Negative sampling
   // @param std::vector<NodeIdType> &input_data - The data set to be sampled
   // @param std::unordered_set<NodeIdType> &exclude_data - Data to be excluded
@@ -257,12 +273,53 @@ class GraphDataImpl : public GraphData {
 
   Status CheckSamplesNum(NodeIdType samples_num);
 
+  // Draw the seed of the random streams of a sampling request
+  // @return uint32_t - The seed
+  uint32_t GetSampleSeed();
+
+  // A request of ParallelSample. The requesting thread and the sample workers which pick the job up claim its
+  // blocks one by one until none is left
+  struct SampleJob {
+    size_t num_items = 0;
+    size_t num_blocks = 0;
+    uint32_t seed = 0;
+    const std::function<Status(size_t, size_t, std::mt19937 *)> *func = nullptr;
+    std::atomic<size_t> next_block{0};
+    std::mutex mux;
+    std::condition_variable done_cv;
+    size_t num_done = 0;  // Blocks finished, guarded by mux
+    Status rc;            // The first error of a block, guarded by mux
+  };
+
+  // Run a sampling function over blocks of kSampleBlockSize items, on the calling thread and the sample workers.
+  // Each block gets its own random engine, seeded by a seed of the request and the index of the block, so that the
+  // result only depends on the seed, not on the number of threads
+  // @param size_t num_items - The number of items to sample, e.g. nodes or walks
+  // @param std::function<Status(size_t, size_t, std::mt19937 *)> &func - Called with the first and the end item of a
+  // block, and the random engine of the block
+  // @return Status - The error code return
+  Status ParallelSample(size_t num_items, const std::function<Status(size_t, size_t, std::mt19937 *)> &func);
+
+  // Run the blocks of a job until there are none left to claim
+  // @param SampleJob *job - The job
+  static void SampleBlocks(SampleJob *job);
+
+  // Start the sample workers, num_workers_ - 1 threads shared by all the requests to the graph
+  // @return Status - The error code return
+  Status StartSampleWorkers();
+
+  // Main loop of a sample worker
+  // @return Status - The error code return
+  Status SampleWorker();
+
   Status CheckNeighborType(NodeType neighbor_type);
 
   std::string dataset_file_;
   int32_t num_workers_;  // The number of worker threads
   std::mt19937 rnd_;
-  RandomWalkBase random_walk_;
+  std::mutex rnd_mutex_;  // rnd_ is shared by the requests served concurrently
+  std::unique_ptr<Queue<std::shared_ptr<SampleJob>>> sample_queue_;
+  TaskGroup sample_workers_;
   mindrecord::json data_schema_;
   bool server_mode_;
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -270,6 +327,7 @@ class GraphDataImpl : public GraphData {
 #endif
   std::unordered_map<NodeType, std::vector<NodeIdType>> node_type_map_;
   std::unordered_map<NodeIdType, std::shared_ptr<Node>> node_id_map_;
+  GraphCsr csr_;  // neighbors of the nodes, and node features when not in server mode
 
   std::unordered_map<EdgeType, std::vector<EdgeIdType>> edge_type_map_;
   std::unordered_map<EdgeIdType, std::shared_ptr<Edge>> edge_id_map_;
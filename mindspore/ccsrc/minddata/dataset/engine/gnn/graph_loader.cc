@@ -44,11 +44,14 @@ GraphLoader::GraphLoader(GraphDataImpl *graph_impl, std::string mr_filepath, int
 Status GraphLoader::GetNodesAndEdges() {
   NodeIdMap *n_id_map = &graph_impl_->node_id_map_;
   EdgeIdMap *e_id_map = &graph_impl_->edge_id_map_;
+  std::vector<std::pair<NodeIdType, NodeType>> csr_nodes;
+  std::vector<std::pair<NodeIdType, NodeIdType>> csr_edges;
   for (std::deque<std::shared_ptr<Node>> &dq : n_deques_) {
     while (dq.empty() == false) {
       std::shared_ptr<Node> node_ptr = dq.front();
       n_id_map->insert({node_ptr->id(), node_ptr});
       graph_impl_->node_type_map_[node_ptr->type()].push_back(node_ptr->id());
+      csr_nodes.emplace_back(node_ptr->id(), node_ptr->type());
       dq.pop_front();
     }
   }
@@ -62,7 +65,7 @@ Status GraphLoader::GetNodesAndEdges() {
       CHECK_FAIL_RETURN_UNEXPECTED(src_itr != n_id_map->end(), "invalid src_id:" + std::to_string(src_itr->first));
       CHECK_FAIL_RETURN_UNEXPECTED(dst_itr != n_id_map->end(), "invalid src_id:" + std::to_string(dst_itr->first));
       RETURN_IF_NOT_OK(edge_ptr->SetNode({src_itr->second, dst_itr->second}));
-      RETURN_IF_NOT_OK(src_itr->second->AddNeighbor(dst_itr->second));
+      csr_edges.emplace_back(src_itr->first, dst_itr->first);
       e_id_map->insert({edge_ptr->id(), edge_ptr});  // add edge to edge_id_map_
       graph_impl_->edge_type_map_[edge_ptr->type()].push_back(edge_ptr->id());
       dq.pop_front();
@@ -72,6 +75,14 @@ Status GraphLoader::GetNodesAndEdges() {
   for (auto &itr : graph_impl_->node_type_map_) itr.second.shrink_to_fit();
   for (auto &itr : graph_impl_->edge_type_map_) itr.second.shrink_to_fit();
 
+  RETURN_IF_NOT_OK(graph_impl_->csr_.Build(std::move(csr_nodes), csr_edges));
+  for (NodeFeatureDeque &dq : n_feature_deques_) {
+    while (dq.empty() == false) {
+      RETURN_IF_NOT_OK(graph_impl_->csr_.UpdateNodeFeature(dq.front().first, dq.front().second));
+      dq.pop_front();
+    }
+  }
+
   MergeFeatureMaps();
   return Status::OK();
 }
@@ -81,6 +92,7 @@ Status GraphLoader::InitAndLoad() {
   CHECK_FAIL_RETURN_UNEXPECTED(row_id_ == 0, "InitAndLoad Can only be called once!\n");
   n_deques_.resize(num_workers_);
   e_deques_.resize(num_workers_);
+  n_feature_deques_.resize(num_workers_);
   n_feature_maps_.resize(num_workers_);
   e_feature_maps_.resize(num_workers_);
   default_node_feature_maps_.resize(num_workers_);
@@ -125,7 +137,7 @@ Status GraphLoader::InitAndLoad() {
 
 Status GraphLoader::LoadNode(const std::vector<uint8_t> &col_blob, const mindrecord::json &col_jsn,
                              std::shared_ptr<Node> *node, NodeFeatureMap *feature_map,
-                             DefaultNodeFeatureMap *default_feature) {
+                             DefaultNodeFeatureMap *default_feature, NodeFeatureDeque *features) {
   NodeIdType node_id = col_jsn["first_id"];
   NodeType node_type = static_cast<NodeType>(col_jsn["type"]);
   (*node) = std::make_shared<LocalNode>(node_id, node_type);
@@ -155,7 +167,7 @@ Status GraphLoader::LoadNode(const std::vector<uint8_t> &col_blob, const mindrec
       std::shared_ptr<Tensor> tensor;
       RETURN_IF_NOT_OK(
         graph_feature_parser_->LoadFeatureTensor("node_feature_" + std::to_string(ind), col_blob, &tensor));
-      RETURN_IF_NOT_OK((*node)->UpdateFeature(std::make_shared<Feature>(ind, tensor)));
+      features->emplace_back(node_id, std::make_shared<Feature>(ind, tensor));
       (*feature_map)[node_type].insert(ind);
       if ((*default_feature)[ind] == nullptr) {
         std::shared_ptr<Tensor> zero_tensor;
@@ -231,7 +243,7 @@ Status GraphLoader::WorkerEntry(int32_t worker_id) {
       if (attr == "n") {
         std::shared_ptr<Node> node_ptr;
         RETURN_IF_NOT_OK(LoadNode(col_blob, col_jsn, &node_ptr, &(n_feature_maps_[worker_id]),
-                                  &default_node_feature_maps_[worker_id]));
+                                  &default_node_feature_maps_[worker_id], &n_feature_deques_[worker_id]));
         n_deques_[worker_id].emplace_back(node_ptr);
       } else if (attr == "e") {
         std::shared_ptr<Edge> edge_ptr;
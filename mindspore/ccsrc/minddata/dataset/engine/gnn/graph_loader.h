@@ -23,6 +23,7 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 #include "minddata/dataset/core/data_type.h"
 #include "minddata/dataset/core/tensor.h"
@@ -49,6 +50,7 @@ using NodeFeatureMap = std::unordered_map<NodeType, std::unordered_set<FeatureTy
 using EdgeFeatureMap = std::unordered_map<EdgeType, std::unordered_set<FeatureType>>;
 using DefaultNodeFeatureMap = std::unordered_map<FeatureType, std::shared_ptr<Feature>>;
 using DefaultEdgeFeatureMap = std::unordered_map<FeatureType, std::shared_ptr<Feature>>;
+using NodeFeatureDeque = std::deque<std::pair<NodeIdType, std::shared_ptr<Feature>>>;
 
 // this class interfaces with the underlying storage format (mindrecord)
 // it returns raw nodes and edges via GetNodesAndEdges
@@ -67,6 +69,8 @@ class GraphLoader {
   // nodes and edges are added to map without any connection. That's because there nodes and edges are read in
   // random order. src_node and dst_node in Edge are node_id only with -1 as type.
   // features attached to each node and edge are expected to be filled correctly
+  // the neighbors of the nodes are then built in the CSR arrays of the graph, as well as the node feature matrices
+  // when not in server mode
   Status GetNodesAndEdges();
 
  private:
@@ -82,9 +86,10 @@ class GraphLoader {
   // @param std::shared_ptr<Node> *node - return value
   // @param NodeFeatureMap *feature_map -
   // @param DefaultNodeFeatureMap *default_feature -
+  // @param NodeFeatureDeque *features - features to copy to the feature matrices, when not in server mode
   // @return Status - the status code
   Status LoadNode(const std::vector<uint8_t> &blob, const mindrecord::json &jsn, std::shared_ptr<Node> *node,
-                  NodeFeatureMap *feature_map, DefaultNodeFeatureMap *default_feature);
+                  NodeFeatureMap *feature_map, DefaultNodeFeatureMap *default_feature, NodeFeatureDeque *features);
 
   // @param std::vector<uint8_t> &blob - contains data in blob field in mindrecord
   // @param mindrecord::json &jsn - contains raw data
@@ -106,6 +111,7 @@ class GraphLoader {
   std::unique_ptr<GraphFeatureParser> graph_feature_parser_;
   std::vector<std::deque<std::shared_ptr<Node>>> n_deques_;
   std::vector<std::deque<std::shared_ptr<Edge>>> e_deques_;
+  std::vector<NodeFeatureDeque> n_feature_deques_;
   std::vector<NodeFeatureMap> n_feature_maps_;
   std::vector<EdgeFeatureMap> e_feature_maps_;
   std::vector<DefaultNodeFeatureMap> default_node_feature_maps_;
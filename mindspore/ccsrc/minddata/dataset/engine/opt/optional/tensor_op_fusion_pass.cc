@@ -15,43 +15,92 @@
  */
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
+#include "minddata/dataset/kernels/image/crop_flip_op.h"
 #include "minddata/dataset/kernels/image/decode_op.h"
 #include "minddata/dataset/engine/datasetops/map_op/map_op.h"
+#include "minddata/dataset/kernels/image/normalize_hwc_to_chw_op.h"
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
+#include "minddata/dataset/kernels/image/rescale_normalize_op.h"
 
 namespace mindspore {
 namespace dataset {
-
-Status TensorOpFusionPass::RunOnNode(std::shared_ptr<MapOp> node, bool *modified) {
-  // Most primitive pattern: DecodeOp immediately followed by RandomCropAndResizeOp
-  // Abstract into a more general member function that can find any pattern, expressed
-  // by regular expressions, for instance.
-  // Add a list of optimisation policies. For now, just this lambda
-  auto FindPattern = [](auto &tfuncs) {
-    auto it =
-      std::find_if(tfuncs.begin(), tfuncs.end(), [](const auto &tf) -> bool { return tf->Name() == kDecodeOp; });
-    auto next = it + 1;
-    if (it != tfuncs.end() && next != tfuncs.end() && (*next)->Name() == kRandomCropAndResizeOp) {
-      return it;
-    } else {
-      return tfuncs.end();
+namespace {
+bool MatchesAt(const TensorOpFusionRule &rule, const std::vector<std::shared_ptr<TensorOp>> &tfuncs, size_t pos) {
+  if (pos + rule.pattern.size() > tfuncs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < rule.pattern.size(); i++) {
+    if (tfuncs[pos + i]->Name() != rule.pattern[i]) {
+      return false;
     }
-  };
-
-  auto &tfuncs = node->TFuncs();
-  auto it = FindPattern(tfuncs);
-  if (it != tfuncs.end()) {
-    auto next = it + 1;
-    auto op = static_cast<RandomCropAndResizeOp *>(next->get());
-    *it = std::static_pointer_cast<TensorOp>(std::make_shared<RandomCropDecodeResizeOp>(*op));
-    tfuncs.erase(next);
   }
-  if (modified != nullptr) {
-    *modified = true;
-  } else {
+  return true;
+}
+}  // namespace
+
+TensorOpFusionPass::TensorOpFusionPass() {
+  AddRule({kRandomCropDecodeResizeOp, {kDecodeOp, kRandomCropAndResizeOp}, [](const auto &ops) {
+             auto op = static_cast<RandomCropAndResizeOp *>(ops[1].get());
+             return std::make_shared<RandomCropDecodeResizeOp>(*op);
+           }});
+  AddRule({kRescaleNormalizeOp, {kRescaleOp, kNormalizeOp}, [](const auto &ops) {
+             auto rescale = static_cast<RescaleOp *>(ops[0].get());
+             auto normalize = static_cast<NormalizeOp *>(ops[1].get());
+             return std::make_shared<RescaleNormalizeOp>(*rescale, *normalize);
+           }});
+  AddRule({kNormalizeHwcToChwOp, {kNormalizeOp, kHwcToChwOp}, [](const auto &ops) {
+             auto normalize = static_cast<NormalizeOp *>(ops[0].get());
+             return std::make_shared<NormalizeHwcToChwOp>(*normalize);
+           }});
+  AddRule({kNormalizeHwcToChwOp, {kRescaleNormalizeOp, kHwcToChwOp}, [](const auto &ops) {
+             auto rescale_normalize = static_cast<RescaleNormalizeOp *>(ops[0].get());
+             return std::make_shared<NormalizeHwcToChwOp>(*rescale_normalize);
+           }});
+  AddRule({kCropFlipOp, {kCropOp, kRandomHorizontalFlipOp}, [](const auto &ops) {
+             auto crop = static_cast<CropOp *>(ops[0].get());
+             auto flip = static_cast<RandomHorizontalFlipOp *>(ops[1].get());
+             return std::make_shared<CropFlipOp>(*crop, *flip);
+           }});
+}
+
+void TensorOpFusionPass::AddRule(TensorOpFusionRule rule) { rules_.push_back(std::move(rule)); }
+
+Status TensorOpFusionPass::RunOnNode(std::shared_ptr<MapOp> node, bool *modified) {
+  if (modified == nullptr) {
     RETURN_STATUS_UNEXPECTED("modified is nullptr");
   }
+  // Start over after every fusion, as a fused op can take part in another rule. For instance RescaleOp, NormalizeOp
+  // and HwcToChwOp become RescaleNormalizeOp and HwcToChwOp, then NormalizeHwcToChwOp.
+  auto &tfuncs = node->TFuncs();
+  bool fused = true;
+  while (fused) {
+    fused = false;
+    for (size_t pos = 0; pos < tfuncs.size() && !fused; pos++) {
+      for (const auto &rule : rules_) {
+        if (!MatchesAt(rule, tfuncs, pos)) {
+          continue;
+        }
+        auto first = tfuncs.begin() + pos;
+        auto last = first + rule.pattern.size();
+        std::shared_ptr<TensorOp> fused_op = rule.fuse(std::vector<std::shared_ptr<TensorOp>>(first, last));
+        if (fused_op == nullptr) {
+          RETURN_STATUS_UNEXPECTED("Fusion rule " + rule.name + " did not create a tensor op.");
+        }
+        *first = fused_op;
+        tfuncs.erase(first + 1, last);
+        fusions_fired_[rule.name]++;
+        MS_LOG(INFO) << "TensorOpFusionPass fused " << rule.pattern.size() << " tensor ops into " << rule.name
+                     << " in MapOp " << node->id() << ".";
+        fused = true;
+        *modified = true;
+        break;
+      }
+    }
+  }
   return Status::OK();
 }
 }  // namespace dataset
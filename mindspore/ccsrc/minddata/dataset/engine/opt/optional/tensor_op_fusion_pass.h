@@ -16,21 +16,56 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 
+#include <functional>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 #include "minddata/dataset/engine/opt/pass.h"
 
 namespace mindspore {
 namespace dataset {
 
+class TensorOp;
+
+/// \struct TensorOpFusionRule tensor_op_fusion_pass.h
+/// \brief A chain of consecutive tensor ops, by name, and how to fuse it into a single tensor op
+struct TensorOpFusionRule {
+  using FuseFunc = std::function<std::shared_ptr<TensorOp>(const std::vector<std::shared_ptr<TensorOp>> &)>;
+
+  std::string name;
+  std::vector<std::string> pattern;
+  FuseFunc fuse;
+};
+
 /// \class TensorOpFusionPass tensor_op_fusion_pass.h
 /// \brief And optional optimization pass identifying and fusing
 ///     tensor ops within MapOp
 class TensorOpFusionPass : public NodePass {
+ public:
+  /// \brief Constructor, registers the default fusion rules
+  TensorOpFusionPass();
+
+  /// \brief Destructor
+  ~TensorOpFusionPass() = default;
+
+  /// \brief Adds a fusion rule. At each position of the tensor op list, rules are tried in the order they are added.
+  /// \param[in] rule The fusion rule
+  void AddRule(TensorOpFusionRule rule);
+
+  /// \brief Getter
+  /// \return The number of times each fusion rule fired, by rule name
+  const std::map<std::string, int32_t> &FusionsFired() const { return fusions_fired_; }
+
   /// \brief Identifies and fuses tensor ops within MapOp
   /// \param[in] node The node being visited
-  /// \param[inout] *modified indicates whether the node has been visited
+  /// \param[inout] *modified indicates if the node was changed at all
   /// \return Status The error code return
   Status RunOnNode(std::shared_ptr<MapOp> node, bool *modified) override;
+
+ private:
+  std::vector<TensorOpFusionRule> rules_;
+  std::map<std::string, int32_t> fusions_fired_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,186 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "minddata/dataset/engine/perf/auto_tune.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/engine/datasetops/map_op/map_op.h"
+#include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/task_manager.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Number of samples in one tuning window
+constexpr int64_t kAutoTuneWindow = 50;
+// A connector is considered full above this usage and empty below the low one
+constexpr double kHighUsage = 0.8;
+constexpr double kLowUsage = 0.2;
+// A queue is bursty when it is empty and full for at least this fraction of the samples each
+constexpr double kBurstRatio = 0.2;
+// A queue is saturated when it is full for at least this fraction of the samples
+constexpr double kSaturatedRatio = 0.9;
+// Queues never grow beyond this multiple of their original size
+constexpr int32_t kMaxQueueGrowth = 4;
+
+double Usage(int32_t size, int32_t capacity) {
+  return capacity > 0 ? static_cast<double>(size) / capacity : 0;
+}
+}  // namespace
+
+AutoTune::AutoTune(ExecutionTree *tree) : tree_(tree), num_samples_(0) {
+  std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+  sampling_interval_ = cfg->monitor_sampling_interval();
+  cpu_budget_ = cfg->autotune_cpu_budget();
+}
+
+Status AutoTune::operator()() {
+  // Register this thread with TaskManager to receive proper interrupt signal.
+  TaskManager::FindMe()->Post();
+  CollectOps();
+
+  // Keep tuning until the task is interrupted or the iterator has received EOF
+  while (!this_thread::is_interrupted() && !(tree_->isFinished())) {
+    Sample();
+    if (num_samples_ >= kAutoTuneWindow) {
+      TuneWorkers();
+      RETURN_IF_NOT_OK(TuneQueues());
+      stats_.clear();
+      num_samples_ = 0;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(sampling_interval_));
+  }
+  return Status::OK();
+}
+
+void AutoTune::CollectOps() {
+  for (auto itr = tree_->begin(); itr != tree_->end(); ++itr) {
+    DatasetOp *op = &(*itr);
+    ops_.push_back(op);
+    original_queue_size_[op->id()] = op->connector_queue_size();
+    auto map_op = dynamic_cast<MapOp *>(op);
+    if (map_op != nullptr) {
+      map_ops_.push_back(map_op);
+    }
+  }
+  MS_LOG(INFO) << "Autotune starts with " << map_ops_.size() << " map ops and a cpu budget of " << cpu_budget_
+               << " workers.";
+}
+
+void AutoTune::Sample() {
+  for (auto op : ops_) {
+    auto &stats = stats_[op->id()];
+    if (!op->Children().empty()) {
+      stats.in_usage += Usage(op->ChildOpConnectorSize(), op->ChildOpConnectorCapacity());
+    }
+    if (!op->inlined()) {
+      int32_t size = op->ConnectorSize();
+      int32_t capacity = op->ConnectorCapacity();
+      stats.out_usage += Usage(size, capacity);
+      stats.out_empty += (size == 0) ? 1 : 0;
+      stats.out_full += (size >= capacity) ? 1 : 0;
+    }
+  }
+  num_samples_++;
+}
+
+void AutoTune::TuneWorkers() {
+  // Stats taken while a worker change is waiting for its eoe still describe the old setting.
+  for (auto map_op : map_ops_) {
+    if (map_op->requested_workers() != map_op->num_active_workers()) {
+      return;
+    }
+  }
+  MapOp *bottleneck = nullptr;
+  double max_gap = 0;
+  for (auto map_op : map_ops_) {
+    auto &stats = stats_[map_op->id()];
+    double in_usage = stats.in_usage / num_samples_;
+    double out_usage = stats.out_usage / num_samples_;
+    if (in_usage >= kHighUsage && out_usage <= kLowUsage && map_op->num_active_workers() < map_op->num_workers() &&
+        in_usage - out_usage > max_gap) {
+      bottleneck = map_op;
+      max_gap = in_usage - out_usage;
+    }
+  }
+  if (bottleneck == nullptr) {
+    return;
+  }
+  if (TotalWorkers() < cpu_budget_) {
+    bottleneck->RequestActiveWorkers(bottleneck->num_active_workers() + 1);
+    MS_LOG(INFO) << "Autotune gives MapOp " << bottleneck->id() << " one more worker, "
+                 << bottleneck->requested_workers() << " in total.";
+    return;
+  }
+  // The budget is used up, take a worker from the map op which waits most for its input.
+  MapOp *donor = nullptr;
+  double min_in_usage = kLowUsage;
+  for (auto map_op : map_ops_) {
+    double in_usage = stats_[map_op->id()].in_usage / num_samples_;
+    if (map_op != bottleneck && map_op->num_active_workers() > 1 && in_usage <= min_in_usage) {
+      donor = map_op;
+      min_in_usage = in_usage;
+    }
+  }
+  if (donor != nullptr) {
+    donor->RequestActiveWorkers(donor->num_active_workers() - 1);
+    bottleneck->RequestActiveWorkers(bottleneck->num_active_workers() + 1);
+    MS_LOG(INFO) << "Autotune moves a worker from MapOp " << donor->id() << " to MapOp " << bottleneck->id() << ".";
+  }
+}
+
+Status AutoTune::TuneQueues() {
+  for (auto op : ops_) {
+    if (op->inlined() || op->Name() == kDeviceQueueOp) {
+      continue;
+    }
+    auto &stats = stats_[op->id()];
+    double empty_ratio = static_cast<double>(stats.out_empty) / num_samples_;
+    double full_ratio = static_cast<double>(stats.out_full) / num_samples_;
+    int32_t queue_size = op->connector_queue_size();
+    int32_t original_size = original_queue_size_[op->id()];
+    int32_t new_size = queue_size;
+    if (empty_ratio >= kBurstRatio && full_ratio >= kBurstRatio) {
+      new_size = std::min(queue_size * 2, original_size * kMaxQueueGrowth);
+    } else if (full_ratio >= kSaturatedRatio) {
+      new_size = std::max(queue_size / 2, original_size);
+    }
+    if (new_size != queue_size) {
+      RETURN_IF_NOT_OK(op->SetConnectorQueueSize(new_size));
+      MS_LOG(INFO) << "Autotune resizes the connector queues of " << op->Name() << " " << op->id() << " from "
+                   << queue_size << " to " << new_size << ".";
+    }
+  }
+  return Status::OK();
+}
+
+int32_t AutoTune::TotalWorkers() const {
+  int32_t total = 0;
+  for (auto op : ops_) {
+    if (op->inlined()) {
+      continue;
+    }
+    auto map_op = dynamic_cast<MapOp *>(op);
+    total += (map_op != nullptr) ? map_op->requested_workers() : op->num_workers();
+  }
+  return total;
+}
+}  // namespace dataset
+}  // namespace mindspore
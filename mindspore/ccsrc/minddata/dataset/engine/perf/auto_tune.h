@@ -0,0 +1,86 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_AUTO_TUNE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_AUTO_TUNE_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+class DatasetOp;
+class ExecutionTree;
+class MapOp;
+
+// AutoTune samples the connector of every op while the tree is running, the same way the ConnectorSize
+// profiling node does. After each window of samples it looks for the bottleneck MapOp, whose input connector
+// stays full while its output connector stays empty, and gives it one more worker within the cpu budget,
+// taking a worker from a starved MapOp once the budget is used up. The MapOp applies the new worker count at
+// its next eoe. Queues which are often empty and often full are grown to absorb the bursts, and queues which
+// are always full are shrunk back towards their original size.
+class AutoTune {
+ public:
+  // AutoTune object constructor
+  // @param tree - The execution tree to tune
+  explicit AutoTune(ExecutionTree *tree);
+
+  ~AutoTune() = default;
+
+  // Functor for the autotune main loop.
+  // This function will be the entry point of mindspore::Dataset::Task
+  Status operator()();
+
+ private:
+  // Connector usage of one op over the current window
+  struct OpStats {
+    double in_usage = 0;   // sum of the input connector usage (size / capacity)
+    double out_usage = 0;  // sum of the output connector usage
+    int64_t out_empty = 0;
+    int64_t out_full = 0;
+  };
+
+  // Collect the ops of the tree and remember their original connector queue sizes.
+  void CollectOps();
+
+  // Take one sample of the connector of every op.
+  void Sample();
+
+  // Move one worker to the bottleneck MapOp, if there is one.
+  void TuneWorkers();
+
+  // Grow or shrink the output connector queues.
+  Status TuneQueues();
+
+  // @return The number of worker threads in use by all the ops of the tree.
+  int32_t TotalWorkers() const;
+
+  ExecutionTree *tree_;
+  int64_t sampling_interval_;
+  int32_t cpu_budget_;
+  int64_t num_samples_;
+  std::vector<DatasetOp *> ops_;
+  std::vector<MapOp *> map_ops_;
+  std::unordered_map<int32_t, int32_t> original_queue_size_;
+  std::unordered_map<int32_t, OpStats> stats_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_AUTO_TUNE_H_
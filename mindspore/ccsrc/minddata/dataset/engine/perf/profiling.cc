@@ -24,6 +24,8 @@
 #include "minddata/dataset/engine/perf/connector_size.h"
 #include "minddata/dataset/engine/perf/connector_throughput.h"
 #include "minddata/dataset/engine/perf/dataset_iterator_tracing.h"
+#include "minddata/dataset/engine/perf/tensor_pool_sampling.h"
+#include "minddata/dataset/core/global_context.h"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -84,6 +86,10 @@ Status ProfilingManager::Initialize() {
   std::shared_ptr<Sampling> connector_thr_sampling = std::make_shared<ConnectorThroughput>(tree_);
   RETURN_IF_NOT_OK(RegisterSamplingNode(connector_thr_sampling));
 
+  std::shared_ptr<Sampling> tensor_pool_sampling =
+    std::make_shared<TensorPoolSampling>(GlobalContext::Instance()->tensor_pool());
+  RETURN_IF_NOT_OK(RegisterSamplingNode(tensor_pool_sampling));
+
   return Status::OK();
 }
 
@@ -0,0 +1,59 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/perf/tensor_pool_sampling.h"
+#include <fstream>
+#include <string>
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/util/path.h"
+
+namespace mindspore {
+namespace dataset {
+Status TensorPoolSampling::Sample() {
+  if (pool_ != nullptr) {
+    sample_table_.push_back(pool_->GetStats());
+  }
+  return Status::OK();
+}
+
+Status TensorPoolSampling::SaveToFile() {
+  json output;
+  output["sampling_interval"] = GlobalContext::config_manager()->monitor_sampling_interval();
+  output["max_cache_size"] = pool_ == nullptr ? 0 : pool_->max_cache_size();
+  json metrics;
+  for (const auto &sample : sample_table_) {
+    metrics["num_allocs"].push_back(sample.num_allocs);
+    metrics["num_cache_hits"].push_back(sample.num_cache_hits);
+    metrics["num_system_allocs"].push_back(sample.num_system_allocs);
+    metrics["num_system_frees"].push_back(sample.num_system_frees);
+    metrics["bytes_in_use"].push_back(sample.bytes_in_use);
+    metrics["peak_bytes_in_use"].push_back(sample.peak_bytes_in_use);
+    metrics["bytes_cached"].push_back(sample.bytes_cached);
+  }
+  output["metrics"] = metrics;
+
+  // Discard the content of the file when opening.
+  std::ofstream os(file_path_, std::ios::trunc);
+  os << output;
+  return Status::OK();
+}
+
+Status TensorPoolSampling::Init(const std::string &dir_path, const std::string &device_id) {
+  file_path_ = (Path(dir_path) / Path("tensor_pool_profiling_" + device_id + ".json")).toString();
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
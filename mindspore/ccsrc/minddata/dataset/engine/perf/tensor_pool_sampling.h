@@ -0,0 +1,57 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_POOL_SAMPLING_H
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_POOL_SAMPLING_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "minddata/dataset/engine/perf/profiling.h"
+#include "minddata/dataset/util/size_class_pool.h"
+
+using json = nlohmann::json;
+
+namespace mindspore {
+namespace dataset {
+// Tensor pool sampling samples the statistics of the global tensor pool, i.e. how much memory the pipeline holds
+// and how often freed memory is reused.
+// It support JSON serialization for external usage.
+class TensorPoolSampling : public Sampling {
+ public:
+  explicit TensorPoolSampling(std::shared_ptr<SizeClassPool> pool) : pool_(std::move(pool)) {}
+
+  ~TensorPoolSampling() override = default;
+
+  // Driver function for tensor pool sampling.
+  Status Sample() override;
+
+  std::string Name() const override { return kTensorPoolSamplingName; }
+
+  // Save sampling data to file
+  // @return Status - The error code return
+  Status SaveToFile() override;
+
+  Status Init(const std::string &dir_path, const std::string &device_id) override;
+
+ private:
+  std::shared_ptr<SizeClassPool> pool_;
+  std::vector<SizeClassPool::Stats> sample_table_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_POOL_SAMPLING_H
@@ -375,6 +375,51 @@ Status Crop(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
   }
 }
 
+Status CropFlip(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x, int y, int w, int h,
+                bool horizontal_flip) {
+  std::shared_ptr<CVTensor> input_cv = CVTensor::AsCVTensor(input);
+  if (!input_cv->mat().data) {
+    RETURN_STATUS_UNEXPECTED("Could not convert to CV Tensor");
+  }
+  if (input_cv->Rank() != 3 && input_cv->Rank() != 2) {
+    RETURN_STATUS_UNEXPECTED("Shape not <H,W,C> or <H,W>");
+  }
+  // account for integer overflow
+  if (y < 0 || (y + h) > input_cv->shape()[0] || (y + h) < 0) {
+    RETURN_STATUS_UNEXPECTED("Invalid y coordinate value for crop");
+  }
+  // account for integer overflow
+  if (x < 0 || (x + w) > input_cv->shape()[1] || (x + w) < 0) {
+    RETURN_STATUS_UNEXPECTED("Invalid x coordinate value for crop");
+  }
+  TensorShape shape{h, w};
+  int num_channels = 1;
+  if (input_cv->Rank() == 3) {
+    num_channels = input_cv->shape()[2];
+    shape = shape.AppendDim(num_channels);
+  }
+  std::shared_ptr<CVTensor> output_cv;
+  RETURN_IF_NOT_OK(CVTensor::CreateEmpty(shape, input_cv->type(), &output_cv));
+  const size_t pixel_size = num_channels * input_cv->type().SizeInBytes();
+  const size_t in_row_size = input_cv->shape()[1] * pixel_size;
+  const size_t out_row_size = w * pixel_size;
+  const uchar *in = input_cv->mat().data + y * in_row_size + x * pixel_size;
+  uchar *out = output_cv->mat().data;
+  for (int row = 0; row < h && w > 0; row++) {
+    const uchar *src = in + row * in_row_size;
+    uchar *dst = out + row * out_row_size;
+    if (!horizontal_flip) {
+      std::copy_n(src, out_row_size, dst);
+      continue;
+    }
+    for (int col = 0; col < w; col++) {
+      std::copy_n(src + (w - 1 - col) * pixel_size, pixel_size, dst + col * pixel_size);
+    }
+  }
+  *output = std::static_pointer_cast<Tensor>(output_cv);
+  return Status::OK();
+}
+
 Status HwcToChw(std::shared_ptr<Tensor> input, std::shared_ptr<Tensor> *output) {
   try {
     std::shared_ptr<CVTensor> input_cv = CVTensor::AsCVTensor(input);
@@ -619,6 +664,74 @@ Status Normalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *
   }
 }
 
+template <typename T>
+void NormalizeChannelsImpl(const T *in, float *out, int64_t num_pixels, const std::vector<float> &scale,
+                           const std::vector<float> &shift, bool hwc_to_chw) {
+  const int64_t num_channels = scale.size();
+  if (hwc_to_chw) {
+    for (int64_t c = 0; c < num_channels; c++) {
+      const T *src = in + c;
+      float *dst = out + c * num_pixels;
+      for (int64_t p = 0; p < num_pixels; p++) {
+        dst[p] = static_cast<float>(src[p * num_channels]) * scale[c] + shift[c];
+      }
+    }
+    return;
+  }
+  for (int64_t p = 0; p < num_pixels; p++) {
+    for (int64_t c = 0; c < num_channels; c++) {
+      out[p * num_channels + c] = static_cast<float>(in[p * num_channels + c]) * scale[c] + shift[c];
+    }
+  }
+}
+
+Status NormalizeChannels(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
+                         const std::vector<float> &scale, const std::vector<float> &shift, bool hwc_to_chw) {
+  std::shared_ptr<CVTensor> input_cv = CVTensor::AsCVTensor(input);
+  if (!(input_cv->mat().data && input_cv->Rank() == 3)) {
+    RETURN_STATUS_UNEXPECTED("Could not convert to CV Tensor");
+  }
+  int64_t height = input_cv->shape()[0];
+  int64_t width = input_cv->shape()[1];
+  int64_t num_channels = input_cv->shape()[2];
+  if (num_channels != scale.size() || num_channels != shift.size()) {
+    RETURN_STATUS_UNEXPECTED("The number of channels does not match the normalize parameters.");
+  }
+  TensorShape shape = hwc_to_chw ? TensorShape{num_channels, height, width} : input_cv->shape();
+  std::shared_ptr<CVTensor> output_cv;
+  RETURN_IF_NOT_OK(CVTensor::CreateEmpty(shape, DataType(DataType::DE_FLOAT32), &output_cv));
+  float *out = reinterpret_cast<float *>(output_cv->mat().data);
+  const uchar *in = input_cv->mat().data;
+  int64_t num_pixels = height * width;
+  switch (input_cv->type().value()) {
+    case DataType::DE_UINT8:
+      NormalizeChannelsImpl(in, out, num_pixels, scale, shift, hwc_to_chw);
+      break;
+    case DataType::DE_INT8:
+      NormalizeChannelsImpl(reinterpret_cast<const int8_t *>(in), out, num_pixels, scale, shift, hwc_to_chw);
+      break;
+    case DataType::DE_UINT16:
+      NormalizeChannelsImpl(reinterpret_cast<const uint16_t *>(in), out, num_pixels, scale, shift, hwc_to_chw);
+      break;
+    case DataType::DE_INT16:
+      NormalizeChannelsImpl(reinterpret_cast<const int16_t *>(in), out, num_pixels, scale, shift, hwc_to_chw);
+      break;
+    case DataType::DE_INT32:
+      NormalizeChannelsImpl(reinterpret_cast<const int32_t *>(in), out, num_pixels, scale, shift, hwc_to_chw);
+      break;
+    case DataType::DE_FLOAT32:
+      NormalizeChannelsImpl(reinterpret_cast<const float *>(in), out, num_pixels, scale, shift, hwc_to_chw);
+      break;
+    case DataType::DE_FLOAT64:
+      NormalizeChannelsImpl(reinterpret_cast<const double *>(in), out, num_pixels, scale, shift, hwc_to_chw);
+      break;
+    default:
+      RETURN_STATUS_UNEXPECTED("Unsupported image type in Normalize.");
+  }
+  *output = std::static_pointer_cast<Tensor>(output_cv);
+  return Status::OK();
+}
+
 Status AdjustBrightness(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, const float &alpha) {
   try {
     std::shared_ptr<CVTensor> input_cv = CVTensor::AsCVTensor(input);
@@ -115,6 +115,17 @@ Status Rescale(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *ou
 /// \param output: Cropped image Tensor of shape <h,w,C> or <h,w> and same input type.
 Status Crop(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x, int y, int w, int h);
 
+/// \brief Returns cropped ROI of an image, flipped horizontally if asked, in a single copy of the ROI
+/// \param input: Tensor of shape <H,W,C> or <H,W> and any OpenCv compatible type, see CVTensor.
+/// \param x: starting horizontal position of ROI
+/// \param y: starting vertical position of ROI
+/// \param w: width of the ROI
+/// \param h: height of the ROI
+/// \param horizontal_flip: whether to flip the ROI horizontally
+/// \param output: Cropped image Tensor of shape <h,w,C> or <h,w> and same input type.
+Status CropFlip(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x, int y, int w, int h,
+                bool horizontal_flip);
+
 /// \brief Swaps the channels in the image, i.e. converts HWC to CHW
 /// \param input: Tensor of shape <H,W,C> or <H,W> and any OpenCv compatible type, see CVTensor.
 /// \param output: Tensor of shape <C,H,W> or <H,W> and same input type.
@@ -182,6 +193,16 @@ Status Rotate(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *out
 Status Normalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
                  const std::shared_ptr<Tensor> &mean, const std::shared_ptr<Tensor> &std);
 
+/// \brief Returns image * scale + shift of each channel, computed in a single pass over the pixels.
+///     Rescale and Normalize both fold into scale and shift, with hwc_to_chw HwcToChw is done in the same pass.
+/// \param input: Tensor of shape <H,W,C> and any OpenCv compatible type, see CVTensor.
+/// \param scale: scale of each channel, of size C
+/// \param shift: shift of each channel, of size C
+/// \param hwc_to_chw: whether to write the output in <C,H,W> layout
+/// \param output: Tensor of shape <H,W,C>, or <C,H,W> with hwc_to_chw, and type DE_FLOAT32
+Status NormalizeChannels(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
+                         const std::vector<float> &scale, const std::vector<float> &shift, bool hwc_to_chw);
+
 /// \brief Returns image with adjusted brightness.
 /// \param input: Tensor of shape <H,W,3> in RGB order and any OpenCv compatible type, see CVTensor.
 /// \param alpha: Alpha value to adjust brightness by. Should be a positive number.
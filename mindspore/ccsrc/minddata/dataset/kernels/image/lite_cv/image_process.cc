@@ -15,6 +15,7 @@
  */
 
 #include "lite_cv/image_process.h"
+#include "lite_cv/image_process_simd.h"
 
 #include <string.h>
 #include <cmath>
@@ -68,7 +69,7 @@ static void ResizeBilinear3C(const unsigned char *src, int src_width, int src_he
   int *y_offset = data_buf + dst_width;
 
   int16_t *x_weight = reinterpret_cast<int16_t *>(data_buf + dst_width + dst_height);
-  int16_t *y_weight = reinterpret_cast<int16_t *>(x_weight + dst_width);
+  int16_t *y_weight = x_weight + 2 * dst_width;
 
   InitBilinearWeight(x_offset, x_weight, scale_width, dst_width, src_width, 3);
   InitBilinearWeight(y_offset, y_weight, scale_height, dst_height, src_height, 1);
@@ -122,15 +123,7 @@ static void ResizeBilinear3C(const unsigned char *src, int src_width, int src_he
     }
     prev_height = y_span;
 
-    int16_t *row0_ptr0 = row0_ptr;
-    int16_t *row1_ptr1 = row1_ptr;
-    unsigned char *dst_ptr = dst + dst_width * 3 * (y);
-
-    for (int k = 0; k < dst_width * 3; k++) {
-      int16_t t0 = (int16_t)((y_weight[0] * (int16_t)(*row0_ptr0++)) >> 16);
-      int16_t t1 = (int16_t)((y_weight[1] * (int16_t)(*row1_ptr1++)) >> 16);
-      *dst_ptr++ = (unsigned char)((t0 + t1 + 2) >> 2);
-    }
+    ResizeBilinearVertical(row0_ptr, row1_ptr, y_weight[0], y_weight[1], dst + dst_width * 3 * y, dst_width * 3);
     y_weight += 2;
   }
   delete[] data_buf;
@@ -147,7 +140,7 @@ static void ResizeBilinear1C(const unsigned char *src, int src_width, int src_he
   int *y_offset = data_buf + dst_width;
 
   int16_t *x_weight = reinterpret_cast<int16_t *>(data_buf + dst_width + dst_height);
-  int16_t *y_weight = reinterpret_cast<int16_t *>(x_weight + dst_width);
+  int16_t *y_weight = x_weight + 2 * dst_width;
 
   InitBilinearWeight(x_offset, x_weight, scale_width, dst_width, src_width, 1);
   InitBilinearWeight(y_offset, y_weight, scale_height, dst_height, src_height, 1);
@@ -172,7 +165,7 @@ static void ResizeBilinear1C(const unsigned char *src, int src_width, int src_he
       int16_t *row1_ptr1 = row1_ptr;
       for (int x = 0; x < dst_width; x++) {
         const unsigned char *src_start_p = src_start + x_offset[x];
-        row1_ptr1[x] = (src_start_p[0] * x_weight_p[0] + src_start_p[3] * x_weight_p[1]) >> 4;
+        row1_ptr1[x] = (src_start_p[0] * x_weight_p[0] + src_start_p[1] * x_weight_p[1]) >> 4;
         x_weight_p += 2;
       }
     } else {
@@ -186,24 +179,15 @@ static void ResizeBilinear1C(const unsigned char *src, int src_width, int src_he
         const unsigned char *src0_ptr = src0 + x_offset[x];
         const unsigned char *src1_ptr = src1 + x_offset[x];
 
-        row0_ptr0[x] = (src0_ptr[0] * x_weight_ptr[0] + src0_ptr[3] * x_weight_ptr[1]) >> 4;
-        row1_ptr1[x] = (src1_ptr[0] * x_weight_ptr[0] + src1_ptr[3] * x_weight_ptr[1]) >> 4;
+        row0_ptr0[x] = (src0_ptr[0] * x_weight_ptr[0] + src0_ptr[1] * x_weight_ptr[1]) >> 4;
+        row1_ptr1[x] = (src1_ptr[0] * x_weight_ptr[0] + src1_ptr[1] * x_weight_ptr[1]) >> 4;
 
         x_weight_ptr += 2;
       }
     }
     prev_height = y_span;
 
-    int16_t *row0_ptr0 = row0_ptr;
-    int16_t *row1_ptr1 = row1_ptr;
-    unsigned char *dst_ptr = dst + dst_width * (y);
-
-    for (int k = 0; k < dst_width; k++) {
-      int16_t t0 = (int16_t)((y_weight[0] * (int16_t)(*row0_ptr0++)) >> 16);
-      int16_t t1 = (int16_t)((y_weight[1] * (int16_t)(*row1_ptr1++)) >> 16);
-      *dst_ptr++ = (unsigned char)((t0 + t1 + 2) >> 2);
-    }
-
+    ResizeBilinearVertical(row0_ptr, row1_ptr, y_weight[0], y_weight[1], dst + dst_width * y, dst_width);
     y_weight += 2;
   }
   delete[] data_buf;
@@ -317,14 +301,7 @@ bool ConvertTo(const LiteMat &src, LiteMat &dst, double scale) {
   (void)dst.Init(src.width_, src.height_, src.channel_, LDataType::FLOAT32);
   const unsigned char *src_start_p = src;
   float *dst_start_p = dst;
-  for (int h = 0; h < src.height_; h++) {
-    for (int w = 0; w < src.width_; w++) {
-      for (int c = 0; c < src.channel_; c++) {
-        int index = (h * src.width_ + w) * src.channel_;
-        dst_start_p[index + c] = (static_cast<float>(src_start_p[index + c] * scale));
-      }
-    }
-  }
+  ConvertToFloat(src_start_p, dst_start_p, src.width_ * src.height_ * src.channel_, static_cast<float>(scale));
   return true;
 }
 
@@ -403,37 +380,48 @@ bool SubStractMeanNormalize(const LiteMat &src, LiteMat &dst, const std::vector<
 
   dst.Init(src.width_, src.height_, src.channel_, LDataType::FLOAT32);
 
+  // a missing mean subtracts 0 and a missing std divides by 1, which leave the values unchanged
+  std::vector<float> mean_c = mean.empty() ? std::vector<float>(src.channel_, 0.0f) : mean;
+  std::vector<float> std_c = std.empty() ? std::vector<float>(src.channel_, 1.0f) : std;
   const float *src_start_p = src;
   float *dst_start_p = dst;
-  if ((!mean.empty()) && std.empty()) {
-    for (int h = 0; h < src.height_; h++) {
-      for (int w = 0; w < src.width_; w++) {
-        for (int c = 0; c < src.channel_; c++) {
-          int index = (h * src.width_ + w) * src.channel_ + c;
-          dst_start_p[index] = src_start_p[index] - mean[c];
-        }
-      }
-    }
-  } else if (mean.empty() && (!std.empty())) {
-    for (int h = 0; h < src.height_; h++) {
-      for (int w = 0; w < src.width_; w++) {
-        for (int c = 0; c < src.channel_; c++) {
-          int index = (h * src.width_ + w) * src.channel_ + c;
-          dst_start_p[index] = src_start_p[index] / std[c];
-        }
-      }
-    }
-  } else if ((!mean.empty()) && (!std.empty())) {
-    for (int h = 0; h < src.height_; h++) {
-      for (int w = 0; w < src.width_; w++) {
-        for (int c = 0; c < src.channel_; c++) {
-          int index = (h * src.width_ + w) * src.channel_ + c;
-          dst_start_p[index] = (src_start_p[index] - mean[c]) / std[c];
-        }
+  SubStractMeanNormalizeRow(src_start_p, dst_start_p, src.width_ * src.height_ * src.channel_, src.channel_,
+                            mean_c.data(), std_c.data());
+  return true;
+}
+
+bool ResizeNormalizeCHW(const LiteMat &src, LiteMat &dst, int dst_w, int dst_h, const std::vector<float> &mean,
+                        const std::vector<float> &std, double scale) {
+  if ((!mean.empty() && mean.size() != src.channel_) || (!std.empty() && std.size() != src.channel_)) {
+    return false;
+  }
+  if (CheckZero(std)) {
+    return false;
+  }
+  LiteMat resize_mat;
+  if (!ResizeBilinear(src, resize_mat, dst_w, dst_h)) {
+    return false;
+  }
+  int channel = resize_mat.channel_;
+  std::vector<float> mean_c = mean.empty() ? std::vector<float>(channel, 0.0f) : mean;
+  std::vector<float> std_c = std.empty() ? std::vector<float>(channel, 1.0f) : std;
+
+  dst.Init(dst_w, dst_h, channel, LDataType::FLOAT32);
+  // each row is normalized in a small buffer and then split into the channel planes, the float image is written once
+  LiteMat row_buf(dst_w * channel, LDataType::FLOAT32);
+  const unsigned char *src_start_p = resize_mat;
+  float *row_p = row_buf;
+  float *dst_start_p = dst;
+  int plane_size = dst_w * dst_h;
+  for (int h = 0; h < dst_h; h++) {
+    ConvertNormalizeRow(src_start_p + h * dst_w * channel, row_p, dst_w * channel, channel, static_cast<float>(scale),
+                        mean_c.data(), std_c.data());
+    for (int c = 0; c < channel; c++) {
+      float *plane_p = dst_start_p + c * plane_size + h * dst_w;
+      for (int w = 0; w < dst_w; w++) {
+        plane_p[w] = row_p[w * channel + c];
       }
     }
-  } else {
-    return false;
   }
   return true;
 }
@@ -445,63 +433,32 @@ static void PadWithConstant(const LiteMat &src, LiteMat &dst, const int top, con
   dst.Init(src.width_ + left + right, src.height_ + top + bottom, src.channel_, src.data_type_);
   const T *src_start_p = src;
   T *dst_start_p = dst;
-  // padd top
-  for (int h = 0; h < top; h++) {
-    for (int w = 0; w < dst.width_; w++) {
-      int index = (h * dst.width_ + w) * dst.channel_;
-      if (dst.channel_ == 1) {
-        dst_start_p[index] = fill_b_or_gray;
-      } else if (dst.channel_ == 3) {
-        dst_start_p[index] = fill_b_or_gray;
-        dst_start_p[index + 1] = fill_g;
-        dst_start_p[index + 2] = fill_r;
-      } else {
-      }
+  // one row of the fill color, the borders are copied from it
+  std::vector<T> fill_row(dst.width_ * dst.channel_);
+  for (int w = 0; w < dst.width_; w++) {
+    int index = w * dst.channel_;
+    if (dst.channel_ == 1) {
+      fill_row[index] = fill_b_or_gray;
+    } else if (dst.channel_ == 3) {
+      fill_row[index] = fill_b_or_gray;
+      fill_row[index + 1] = fill_g;
+      fill_row[index + 2] = fill_r;
+    } else {
     }
   }
-  // padd bottom
-  for (int h = dst.height_ - bottom; h < dst.height_; h++) {
-    for (int w = 0; w < dst.width_; w++) {
-      int index = (h * dst.width_ + w) * dst.channel_;
-      if (dst.channel_ == 1) {
-        dst_start_p[index] = fill_b_or_gray;
-      } else if (dst.channel_ == 3) {
-        dst_start_p[index] = fill_b_or_gray;
-        dst_start_p[index + 1] = fill_g;
-        dst_start_p[index + 2] = fill_r;
-      } else {
-      }
-    }
+  int row_size = dst.width_ * dst.channel_;
+  // padd top and bottom
+  for (int h = 0; h < top; h++) {
+    (void)memcpy(dst_start_p + h * row_size, fill_row.data(), row_size * sizeof(T));
   }
-
-  // padd left
-  for (int h = top; h < dst.height_ - bottom; h++) {
-    for (int w = 0; w < left; w++) {
-      int index = (h * dst.width_ + w) * dst.channel_;
-      if (dst.channel_ == 1) {
-        dst_start_p[index] = fill_b_or_gray;
-      } else if (dst.channel_ == 3) {
-        dst_start_p[index] = fill_b_or_gray;
-        dst_start_p[index + 1] = fill_g;
-        dst_start_p[index + 2] = fill_r;
-      } else {
-      }
-    }
+  for (int h = dst.height_ - bottom; h < dst.height_; h++) {
+    (void)memcpy(dst_start_p + h * row_size, fill_row.data(), row_size * sizeof(T));
   }
-
-  // padd right
+  // padd left and right
   for (int h = top; h < dst.height_ - bottom; h++) {
-    for (int w = dst.width_ - right; w < dst.width_; w++) {
-      int index = (h * dst.width_ + w) * dst.channel_;
-      if (dst.channel_ == 1) {
-        dst_start_p[index] = fill_b_or_gray;
-      } else if (dst.channel_ == 3) {
-        dst_start_p[index] = fill_b_or_gray;
-        dst_start_p[index + 1] = fill_g;
-        dst_start_p[index + 2] = fill_r;
-      } else {
-      }
-    }
+    (void)memcpy(dst_start_p + h * row_size, fill_row.data(), left * dst.channel_ * sizeof(T));
+    (void)memcpy(dst_start_p + (h + 1) * row_size - right * dst.channel_, fill_row.data(),
+                 right * dst.channel_ * sizeof(T));
   }
   // image data
   dst_start_p = dst_start_p + (top * dst.width_ + left) * dst.channel_;
@@ -66,6 +66,12 @@ bool Crop(const LiteMat &src, LiteMat &dst, int x, int y, int w, int h);
 bool SubStractMeanNormalize(const LiteMat &src, LiteMat &dst, const std::vector<float> &mean,
                             const std::vector<float> &std);
 
+/// \brief resize by bilinear algorithm, then compute (x * scale - mean) / std and split the channels into planes,
+///          in one pass which writes the float image once. dst has the size and channel of the resized image,
+///          its data is in CHW order. An empty mean or std is skipped
+bool ResizeNormalizeCHW(const LiteMat &src, LiteMat &dst, int dst_w, int dst_h, const std::vector<float> &mean,
+                        const std::vector<float> &std, double scale = 1.0);
+
 /// \brief padd image, the channel supports is 3 and 1
 bool Pad(const LiteMat &src, LiteMat &dst, int top, int bottom, int left, int right, PaddBorderType pad_type,
          uint8_t fill_b_or_gray, uint8_t fill_g, uint8_t fill_r);
@@ -0,0 +1,250 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lite_cv/image_process_simd.h"
+
+#ifdef ENABLE_NEON
+#include <arm_neon.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+// the avx2 kernels are compiled for avx2 without changing the flags of the file, and chosen by cpuid at runtime
+#define LITE_CV_AVX2
+#define AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace mindspore {
+namespace dataset {
+
+#if (defined(ENABLE_NEON) && defined(ENABLE_ARM64)) || defined(LITE_CV_AVX2)
+// mean and std repeated over 24 values, a multiple of the vector sizes and of the usual channel numbers
+static const int kPatternSize = 24;
+
+static bool InitChannelPattern(int channel, const float *mean, const float *std, float *mean_pattern,
+                               float *std_pattern) {
+  if (channel <= 0 || kPatternSize % channel != 0) {
+    return false;
+  }
+  for (int i = 0; i < kPatternSize; i++) {
+    mean_pattern[i] = mean[i % channel];
+    std_pattern[i] = std[i % channel];
+  }
+  return true;
+}
+#endif
+
+#ifdef LITE_CV_AVX2
+static bool SupportAvx2() {
+  static const bool support = []() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }();
+  return support;
+}
+
+// Each avx2 kernel returns the number of values it processed, the caller finishes the row
+AVX2_TARGET static int ResizeBilinearVerticalAvx2(const int16_t *row0, const int16_t *row1, int16_t w0, int16_t w1,
+                                                  uint8_t *dst, int n) {
+  const __m256i v_w0 = _mm256_set1_epi16(w0);
+  const __m256i v_w1 = _mm256_set1_epi16(w1);
+  const __m256i v_delta = _mm256_set1_epi16(2);
+  int i = 0;
+  for (; i <= n - 16; i += 16) {
+    __m256i t0 = _mm256_mulhi_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(row0 + i)), v_w0);
+    __m256i t1 = _mm256_mulhi_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(row1 + i)), v_w1);
+    __m256i sum = _mm256_srai_epi16(_mm256_add_epi16(_mm256_add_epi16(t0, t1), v_delta), 2);
+    // packus works in 128 bit lanes, gather the two packed halves in the low lane
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), 0x08);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm256_castsi256_si128(packed));
+  }
+  return i;
+}
+
+AVX2_TARGET static int ConvertToFloatAvx2(const uint8_t *src, float *dst, int n, float scale) {
+  const __m256 v_scale = _mm256_set1_ps(scale);
+  int i = 0;
+  for (; i <= n - 8; i += 8) {
+    __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i)));
+    _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v), v_scale));
+  }
+  return i;
+}
+
+AVX2_TARGET static int SubStractMeanNormalizeRowAvx2(const float *src, float *dst, int n, int channel,
+                                                     const float *mean, const float *std) {
+  float mean_pattern[kPatternSize];
+  float std_pattern[kPatternSize];
+  if (!InitChannelPattern(channel, mean, std, mean_pattern, std_pattern)) {
+    return 0;
+  }
+  const __m256 m0 = _mm256_loadu_ps(mean_pattern);
+  const __m256 m1 = _mm256_loadu_ps(mean_pattern + 8);
+  const __m256 m2 = _mm256_loadu_ps(mean_pattern + 16);
+  const __m256 s0 = _mm256_loadu_ps(std_pattern);
+  const __m256 s1 = _mm256_loadu_ps(std_pattern + 8);
+  const __m256 s2 = _mm256_loadu_ps(std_pattern + 16);
+  int i = 0;
+  for (; i <= n - kPatternSize; i += kPatternSize) {
+    _mm256_storeu_ps(dst + i, _mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(src + i), m0), s0));
+    _mm256_storeu_ps(dst + i + 8, _mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(src + i + 8), m1), s1));
+    _mm256_storeu_ps(dst + i + 16, _mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(src + i + 16), m2), s2));
+  }
+  return i;
+}
+
+AVX2_TARGET static inline __m256 LoadFloatAvx2(const uint8_t *src, __m256 scale) {
+  __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src)));
+  return _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale);
+}
+
+AVX2_TARGET static int ConvertNormalizeRowAvx2(const uint8_t *src, float *dst, int n, int channel, float scale,
+                                               const float *mean, const float *std) {
+  float mean_pattern[kPatternSize];
+  float std_pattern[kPatternSize];
+  if (!InitChannelPattern(channel, mean, std, mean_pattern, std_pattern)) {
+    return 0;
+  }
+  const __m256 v_scale = _mm256_set1_ps(scale);
+  const __m256 m0 = _mm256_loadu_ps(mean_pattern);
+  const __m256 m1 = _mm256_loadu_ps(mean_pattern + 8);
+  const __m256 m2 = _mm256_loadu_ps(mean_pattern + 16);
+  const __m256 s0 = _mm256_loadu_ps(std_pattern);
+  const __m256 s1 = _mm256_loadu_ps(std_pattern + 8);
+  const __m256 s2 = _mm256_loadu_ps(std_pattern + 16);
+  int i = 0;
+  for (; i <= n - kPatternSize; i += kPatternSize) {
+    _mm256_storeu_ps(dst + i, _mm256_div_ps(_mm256_sub_ps(LoadFloatAvx2(src + i, v_scale), m0), s0));
+    _mm256_storeu_ps(dst + i + 8, _mm256_div_ps(_mm256_sub_ps(LoadFloatAvx2(src + i + 8, v_scale), m1), s1));
+    _mm256_storeu_ps(dst + i + 16, _mm256_div_ps(_mm256_sub_ps(LoadFloatAvx2(src + i + 16, v_scale), m2), s2));
+  }
+  return i;
+}
+#endif
+
+#ifdef ENABLE_NEON
+static inline int16x8_t MulHighNeon(int16x8_t v, int16x4_t w) {
+  return vcombine_s16(vshrn_n_s32(vmull_s16(vget_low_s16(v), w), 16), vshrn_n_s32(vmull_s16(vget_high_s16(v), w), 16));
+}
+
+static inline void ConvertToFloatNeon(const uint8_t *src, float32x4_t scale, float32x4_t *low, float32x4_t *high) {
+  uint16x8_t v = vmovl_u8(vld1_u8(src));
+  *low = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), scale);
+  *high = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), scale);
+}
+#endif
+
+void ResizeBilinearVertical(const int16_t *row0, const int16_t *row1, int16_t w0, int16_t w1, uint8_t *dst, int n) {
+  int i = 0;
+#ifdef ENABLE_NEON
+  const int16x4_t v_w0 = vdup_n_s16(w0);
+  const int16x4_t v_w1 = vdup_n_s16(w1);
+  const int16x8_t v_delta = vdupq_n_s16(2);
+  for (; i <= n - 8; i += 8) {
+    int16x8_t t0 = MulHighNeon(vld1q_s16(row0 + i), v_w0);
+    int16x8_t t1 = MulHighNeon(vld1q_s16(row1 + i), v_w1);
+    vst1_u8(dst + i, vqmovun_s16(vshrq_n_s16(vaddq_s16(vaddq_s16(t0, t1), v_delta), 2)));
+  }
+#elif defined(LITE_CV_AVX2)
+  if (SupportAvx2()) {
+    i = ResizeBilinearVerticalAvx2(row0, row1, w0, w1, dst, n);
+  }
+#endif
+  for (; i < n; i++) {
+    int16_t t0 = (int16_t)((w0 * row0[i]) >> 16);
+    int16_t t1 = (int16_t)((w1 * row1[i]) >> 16);
+    dst[i] = (uint8_t)((t0 + t1 + 2) >> 2);
+  }
+}
+
+void ConvertToFloat(const uint8_t *src, float *dst, int n, float scale) {
+  int i = 0;
+#ifdef ENABLE_NEON
+  const float32x4_t v_scale = vdupq_n_f32(scale);
+  for (; i <= n - 8; i += 8) {
+    float32x4_t low, high;
+    ConvertToFloatNeon(src + i, v_scale, &low, &high);
+    vst1q_f32(dst + i, low);
+    vst1q_f32(dst + i + 4, high);
+  }
+#elif defined(LITE_CV_AVX2)
+  if (SupportAvx2()) {
+    i = ConvertToFloatAvx2(src, dst, n, scale);
+  }
+#endif
+  for (; i < n; i++) {
+    dst[i] = src[i] * scale;
+  }
+}
+
+void SubStractMeanNormalizeRow(const float *src, float *dst, int n, int channel, const float *mean,
+                               const float *std) {
+  int i = 0;
+#if defined(ENABLE_NEON) && defined(ENABLE_ARM64)
+  // armv7 neon has no division, it keeps the scalar loop
+  float mean_pattern[kPatternSize];
+  float std_pattern[kPatternSize];
+  if (InitChannelPattern(channel, mean, std, mean_pattern, std_pattern)) {
+    for (; i <= n - kPatternSize; i += kPatternSize) {
+      for (int j = 0; j < kPatternSize; j += 4) {
+        float32x4_t v = vsubq_f32(vld1q_f32(src + i + j), vld1q_f32(mean_pattern + j));
+        vst1q_f32(dst + i + j, vdivq_f32(v, vld1q_f32(std_pattern + j)));
+      }
+    }
+  }
+#elif defined(LITE_CV_AVX2)
+  if (SupportAvx2()) {
+    i = SubStractMeanNormalizeRowAvx2(src, dst, n, channel, mean, std);
+  }
+#endif
+  // i is a multiple of the channel here
+  for (; i < n; i++) {
+    int c = i % channel;
+    dst[i] = (src[i] - mean[c]) / std[c];
+  }
+}
+
+void ConvertNormalizeRow(const uint8_t *src, float *dst, int n, int channel, float scale, const float *mean,
+                         const float *std) {
+  int i = 0;
+#if defined(ENABLE_NEON) && defined(ENABLE_ARM64)
+  float mean_pattern[kPatternSize];
+  float std_pattern[kPatternSize];
+  if (InitChannelPattern(channel, mean, std, mean_pattern, std_pattern)) {
+    const float32x4_t v_scale = vdupq_n_f32(scale);
+    for (; i <= n - kPatternSize; i += kPatternSize) {
+      for (int j = 0; j < kPatternSize; j += 8) {
+        float32x4_t low, high;
+        ConvertToFloatNeon(src + i + j, v_scale, &low, &high);
+        low = vdivq_f32(vsubq_f32(low, vld1q_f32(mean_pattern + j)), vld1q_f32(std_pattern + j));
+        high = vdivq_f32(vsubq_f32(high, vld1q_f32(mean_pattern + j + 4)), vld1q_f32(std_pattern + j + 4));
+        vst1q_f32(dst + i + j, low);
+        vst1q_f32(dst + i + j + 4, high);
+      }
+    }
+  }
+#elif defined(LITE_CV_AVX2)
+  if (SupportAvx2()) {
+    i = ConvertNormalizeRowAvx2(src, dst, n, channel, scale, mean, std);
+  }
+#endif
+  for (; i < n; i++) {
+    int c = i % channel;
+    float v = src[i] * scale;
+    dst[i] = (v - mean[c]) / std[c];
+  }
+}
+
+}  // namespace dataset
+}  // namespace mindspore
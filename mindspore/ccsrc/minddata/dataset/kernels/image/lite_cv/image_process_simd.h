@@ -0,0 +1,46 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IMAGE_PROCESS_SIMD_H_
+#define IMAGE_PROCESS_SIMD_H_
+
+#include <stdint.h>
+
+namespace mindspore {
+namespace dataset {
+
+/// \brief Row kernels of image_process.cc. They use NEON when ENABLE_NEON is defined, and AVX2 on x86 cpus which
+///          support it, checked by cpuid at runtime. There is no SSE tier, x86 cpus without AVX2 run the scalar loop.
+///          Every path gives the same result as the scalar loop.
+
+/// \brief blend two rows of the horizontal pass of ResizeBilinear with the vertical weights of a dst row,
+///          dst[i] = (((w0 * row0[i]) >> 16) + ((w1 * row1[i]) >> 16) + 2) >> 2
+void ResizeBilinearVertical(const int16_t *row0, const int16_t *row1, int16_t w0, int16_t w1, uint8_t *dst, int n);
+
+/// \brief dst[i] = src[i] * scale
+void ConvertToFloat(const uint8_t *src, float *dst, int n, float scale);
+
+/// \brief dst[i] = (src[i] - mean[i % channel]) / std[i % channel], for n interleaved values
+void SubStractMeanNormalizeRow(const float *src, float *dst, int n, int channel, const float *mean,
+                               const float *std);
+
+/// \brief dst[i] = (src[i] * scale - mean[i % channel]) / std[i % channel], for n interleaved values
+void ConvertNormalizeRow(const uint8_t *src, float *dst, int n, int channel, float scale, const float *mean,
+                         const float *std);
+
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // IMAGE_PROCESS_SIMD_H_
@@ -38,7 +38,7 @@ class NormalizeOp : public TensorOp {
 
   std::string Name() const override { return kNormalizeOp; }
 
- private:
+ protected:
   std::shared_ptr<Tensor> mean_;
   std::shared_ptr<Tensor> std_;
 };
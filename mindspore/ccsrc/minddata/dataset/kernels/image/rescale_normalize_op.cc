@@ -0,0 +1,61 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/rescale_normalize_op.h"
+
+#include <string>
+
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+RescaleNormalizeOp::RescaleNormalizeOp(const RescaleOp &rescale, const NormalizeOp &normalize)
+    : NormalizeOp(normalize) {
+  fold_status_ = FoldRescale(rescale);
+}
+
+Status RescaleNormalizeOp::FoldRescale(const RescaleOp &rescale) {
+  CHECK_FAIL_RETURN_UNEXPECTED(mean_ != nullptr && std_ != nullptr && mean_->Size() == std_->Size(),
+                               "Mean and std tensors are missing or differ in size.");
+  for (dsize_t i = 0; i < mean_->Size(); i++) {
+    float mean_c = 0.0;
+    float std_c = 0.0;
+    RETURN_IF_NOT_OK(mean_->GetItemAt<float>(&mean_c, {i}));
+    RETURN_IF_NOT_OK(std_->GetItemAt<float>(&std_c, {i}));
+    CHECK_FAIL_RETURN_UNEXPECTED(std_c != 0.0, "Std of channel " + std::to_string(i) + " is 0.");
+    scale_.push_back(rescale.rescale() / std_c);
+    shift_.push_back((rescale.shift() - mean_c) / std_c);
+  }
+  return Status::OK();
+}
+
+Status RescaleNormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  RETURN_IF_NOT_OK(fold_status_);
+  return NormalizeChannels(input, output, scale_, shift_, false);
+}
+
+Status RescaleNormalizeOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  outputs[0] = DataType(DataType::DE_FLOAT32);
+  return Status::OK();
+}
+
+void RescaleNormalizeOp::Print(std::ostream &out) const {
+  out << Name() << ", mean: " << mean_ << std::endl << "std: " << std_ << std::endl;
+}
+}  // namespace dataset
+}  // namespace mindspore
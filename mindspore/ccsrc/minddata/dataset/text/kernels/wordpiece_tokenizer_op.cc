@@ -16,6 +16,7 @@
 
 #include "minddata/dataset/text/kernels/wordpiece_tokenizer_op.h"
 #include <algorithm>
+#include <iterator>
 #include <utility>
 
 namespace mindspore {
@@ -30,37 +31,38 @@ WordpieceTokenizerOp::WordpieceTokenizerOp(const std::shared_ptr<Vocab> &vocab,
                                            const int &max_bytes_per_token, const std::string &unknown_token,
                                            const bool &with_offsets)
     : vocab_(vocab),
+      trie_(std::make_shared<VocabTrie>(vocab, suffix_indicator)),
       suffix_indicator_(suffix_indicator),
       max_bytes_per_token_(max_bytes_per_token),
       unknown_token_(unknown_token),
       with_offsets_(with_offsets) {}
 
-Status WordpieceTokenizerOp::LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start,
-                                        bool *out_found, int *out_end) const {
+Status WordpieceTokenizerOp::LookupWord(std::string_view input_token, const int start, bool *out_found,
+                                        int *out_end) const {
   CHECK_FAIL_RETURN_UNEXPECTED(start >= 0 && start < input_token.size(), "Out of range");
   *out_found = false;
-  for (int i = runes.size() - 1; i >= 0; i--) {
-    *out_end = runes[i].offset + runes[i].len;
-    int len = *out_end - start;
-    std::string word = input_token.substr(start, len);
-    if (start > 0) {
-      word = suffix_indicator_ + word;
-    }
-    if (vocab_->Lookup(word) != Vocab::kNoTokenExists) {
+  // Walk down the trie rune by rune, the last word passed is the longest match
+  VocabTrie::NodeId node = trie_->Root(start > 0);
+  for (int end = start; end < input_token.size() && node != VocabTrie::kNoNode;) {
+    RuneStrLite rune = DecodeRuneInString(input_token.data() + end, input_token.size() - end);
+    CHECK_FAIL_RETURN_UNEXPECTED(rune.len > 0, "Decode utf8 string failed.");
+    node = trie_->Step(node, input_token.substr(end, rune.len));
+    end += rune.len;
+    if (node != VocabTrie::kNoNode && trie_->GetWordId(node) != Vocab::kNoTokenExists) {
       *out_found = true;
-      break;
+      *out_end = end;
     }
   }
   return Status::OK();
 }
 
-Status WordpieceTokenizerOp::FoundNoToken(const std::string &input_token, const uint32_t &basic_start,
+Status WordpieceTokenizerOp::FoundNoToken(std::string_view input_token, const uint32_t &basic_start,
                                           std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
                                           std::vector<uint32_t> *offsets_limit) const {
   out_tokens->clear();
   offsets_start->push_back(basic_start);
   if (unknown_token_.empty()) {
-    out_tokens->emplace_back(input_token);
+    out_tokens->emplace_back(std::string(input_token));
     offsets_limit->push_back(basic_start + input_token.length());
   } else {
     out_tokens->emplace_back(unknown_token_);
@@ -69,18 +71,20 @@ Status WordpieceTokenizerOp::FoundNoToken(const std::string &input_token, const
   return Status::OK();
 }
 
-Status WordpieceTokenizerOp::AddSubword(const std::string &input_token, const int &start, const int &end,
+Status WordpieceTokenizerOp::AddSubword(std::string_view input_token, const int &start, const int &end,
                                         std::vector<std::string> *out_tokens) const {
   CHECK_FAIL_RETURN_UNEXPECTED(start >= 0 && end > start && end <= input_token.size(), "Out of range");
-  std::string subword = input_token.substr(start, end - start);
+  std::string subword;
   if (start > 0) {
-    subword = suffix_indicator_ + subword;
+    subword.reserve(suffix_indicator_.size() + end - start);
+    subword.append(suffix_indicator_);
   }
-  out_tokens->emplace_back(subword);
+  subword.append(input_token.substr(start, end - start));
+  out_tokens->emplace_back(std::move(subword));
   return Status::OK();
 }
 
-Status WordpieceTokenizerOp::GetTokens(const std::string &input_token, const uint32_t &basic_start,
+Status WordpieceTokenizerOp::GetTokens(std::string_view input_token, const uint32_t &basic_start,
                                        std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
                                        std::vector<uint32_t> *offsets_limit) const {
   if (input_token.size() > max_bytes_per_token_) {
@@ -89,19 +93,22 @@ Status WordpieceTokenizerOp::GetTokens(const std::string &input_token, const uin
       offsets_limit->push_back(basic_start + unknown_token_.size());
       out_tokens->emplace_back(unknown_token_);
     } else {
-      out_tokens->emplace_back(input_token);
+      out_tokens->emplace_back(std::string(input_token));
       offsets_limit->push_back(basic_start + input_token.size());
     }
     return Status::OK();
   }
-  RuneStrArray runes;
-  if (!DecodeRunesInString(input_token.data(), input_token.size(), runes)) {
-    RETURN_STATUS_UNEXPECTED("Decode utf8 string failed.");
+  for (size_t pos = 0; pos < input_token.size();) {
+    RuneStrLite rune = DecodeRuneInString(input_token.data() + pos, input_token.size() - pos);
+    if (rune.len == 0) {
+      RETURN_STATUS_UNEXPECTED("Decode utf8 string failed.");
+    }
+    pos += rune.len;
   }
   int end = 0;
   for (int start = 0; start < input_token.size();) {
     bool found = false;
-    RETURN_IF_NOT_OK(LookupWord(input_token, runes, start, &found, &end));
+    RETURN_IF_NOT_OK(LookupWord(input_token, start, &found, &end));
     if (found) {
       RETURN_IF_NOT_OK(AddSubword(input_token, start, end, out_tokens));
       offsets_start->push_back(static_cast<uint32_t>(basic_start + start));
@@ -123,14 +130,16 @@ Status WordpieceTokenizerOp::Compute(const TensorRow &input, TensorRow *output)
   std::vector<std::string> out_tokens;
   std::vector<uint32_t> offsets_start, offsets_limit;
   std::shared_ptr<Tensor> token_tensor, offsets_start_tensor, offsets_limit_tensor;
+  std::vector<std::string> temp_tokens;
   for (auto iter = input[0]->begin<std::string_view>(); iter != input[0]->end<std::string_view>(); iter++) {
     uint32_t basic_start = 0;
-    std::vector<std::string> temp_tokens;
+    temp_tokens.clear();
     if (with_offsets_ && input.size() == 3) {
       RETURN_IF_NOT_OK(input[1]->GetItemAt<uint32_t>(&basic_start, {count, 0}));
     }
-    RETURN_IF_NOT_OK(GetTokens(std::string(*iter), basic_start, &temp_tokens, &offsets_start, &offsets_limit));
-    out_tokens.insert(out_tokens.end(), temp_tokens.begin(), temp_tokens.end());
+    RETURN_IF_NOT_OK(GetTokens(*iter, basic_start, &temp_tokens, &offsets_start, &offsets_limit));
+    out_tokens.insert(out_tokens.end(), std::make_move_iterator(temp_tokens.begin()),
+                      std::make_move_iterator(temp_tokens.end()));
     count++;
   }
   if (out_tokens.empty()) {
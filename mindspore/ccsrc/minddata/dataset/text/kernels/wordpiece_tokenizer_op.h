@@ -25,10 +25,11 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 #include "minddata/dataset/text/vocab.h"
+#include "minddata/dataset/text/vocab_trie.h"
 #include "minddata/dataset/util/status.h"
 
-using cppjieba::DecodeRunesInString;
-using cppjieba::RuneStrArray;
+using cppjieba::DecodeRuneInString;
+using cppjieba::RuneStrLite;
 namespace mindspore {
 namespace dataset {
 
@@ -47,19 +48,19 @@ class WordpieceTokenizerOp : public TensorOp {
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
  protected:
-  Status AddSubword(const std::string &input_token, const int &start, const int &end,
+  Status AddSubword(std::string_view input_token, const int &start, const int &end,
                     std::vector<std::string> *out_token) const;
-  Status FoundNoToken(const std::string &input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
+  Status FoundNoToken(std::string_view input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
                       std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
-  Status LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start, bool *out_found,
-                    int *out_end) const;
-  Status GetTokens(const std::string &input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
+  Status LookupWord(std::string_view input_token, const int start, bool *out_found, int *out_end) const;
+  Status GetTokens(std::string_view input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
                    std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
 
   std::string Name() const override { return kWordpieceTokenizerOp; }
 
  private:
   const std::shared_ptr<Vocab> vocab_;
+  const std::shared_ptr<VocabTrie> trie_;  // vocab compiled for longest matches, shared by the copies of the op
   const std::string suffix_indicator_;
   const bool with_offsets_;
   const int max_bytes_per_token_;
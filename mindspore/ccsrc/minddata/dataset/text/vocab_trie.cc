@@ -0,0 +1,95 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/text/vocab_trie.h"
+
+#include <algorithm>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+const VocabTrie::NodeId VocabTrie::kNoNode = -1;
+const VocabTrie::NodeId VocabTrie::kWordRoot = 0;
+const VocabTrie::NodeId VocabTrie::kContinuationRoot = 1;
+
+VocabTrie::VocabTrie(const std::shared_ptr<Vocab> &vocab, const std::string &suffix_indicator) {
+  // words of each root, sorted so that the words under a node are contiguous
+  std::unordered_map<WordType, WordIdType> word2id;
+  if (vocab != nullptr) {
+    word2id = vocab->vocab();
+  }
+  std::vector<std::vector<std::pair<std::string_view, WordIdType>>> words(2);
+  for (const auto &p : word2id) {
+    words[kWordRoot].emplace_back(p.first, p.second);
+    if (p.first.compare(0, suffix_indicator.size(), suffix_indicator) == 0) {
+      words[kContinuationRoot].emplace_back(std::string_view(p.first).substr(suffix_indicator.size()), p.second);
+    }
+  }
+
+  // Breadth first, each node lists its children at once: (node, words under the node, depth of the node)
+  using Range = std::tuple<NodeId, const std::pair<std::string_view, WordIdType> *, size_t, size_t>;
+  std::queue<Range> pending;
+  for (NodeId root : {kWordRoot, kContinuationRoot}) {
+    std::sort(words[root].begin(), words[root].end());
+    nodes_.push_back({0, 0, Vocab::kNoTokenExists});
+    pending.emplace(root, words[root].data(), words[root].size(), 0);
+  }
+  while (!pending.empty()) {
+    NodeId node;
+    const std::pair<std::string_view, WordIdType> *first;
+    size_t count, depth;
+    std::tie(node, first, count, depth) = pending.front();
+    pending.pop();
+    const auto *last = first + count;
+    // the word ending at the node sorts before the longer ones
+    if (first != last && first->first.size() == depth) {
+      nodes_[node].word_id = first->second;
+      ++first;
+    }
+    nodes_[node].edges_begin = static_cast<uint32_t>(edges_.size());
+    while (first != last) {
+      auto byte = static_cast<uint8_t>(first->first[depth]);
+      const auto *next = first;
+      while (next != last && static_cast<uint8_t>(next->first[depth]) == byte) {
+        ++next;
+      }
+      auto child = static_cast<NodeId>(nodes_.size());
+      nodes_.push_back({0, 0, Vocab::kNoTokenExists});
+      edges_.push_back({byte, child});
+      pending.emplace(child, first, next - first, depth + 1);
+      first = next;
+    }
+    nodes_[node].edges_end = static_cast<uint32_t>(edges_.size());
+  }
+}
+
+VocabTrie::NodeId VocabTrie::Step(NodeId node, std::string_view bytes) const {
+  for (char c : bytes) {
+    auto byte = static_cast<uint8_t>(c);
+    auto begin = edges_.begin() + nodes_[node].edges_begin;
+    auto end = edges_.begin() + nodes_[node].edges_end;
+    auto edge = std::lower_bound(begin, end, byte, [](const Edge &e, uint8_t b) { return e.byte < b; });
+    if (edge == end || edge->byte != byte) {
+      return kNoNode;
+    }
+    node = edge->child;
+  }
+  return node;
+}
+}  // namespace dataset
+}  // namespace mindspore
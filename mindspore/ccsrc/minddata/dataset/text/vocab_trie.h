@@ -0,0 +1,84 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "minddata/dataset/text/vocab.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A vocab compiled to a byte trie, to match the longest word at a position of a string without building
+/// strings. The trie has two roots: the words of the vocab, and the continuations, i.e. the words which start with
+/// the suffix indicator, without it. The children of a node are contiguous and sorted, so a step is a binary search
+/// in a small array.
+class VocabTrie {
+ public:
+  using NodeId = int32_t;
+
+  static const NodeId kNoNode;
+
+  /// \brief Compile a vocab
+  /// \param[in] vocab The vocab, an empty trie is built if it is null
+  /// \param[in] suffix_indicator The prefix of the continuation words
+  VocabTrie(const std::shared_ptr<Vocab> &vocab, const std::string &suffix_indicator);
+
+  ~VocabTrie() = default;
+
+  /// \brief Get a root of the trie
+  /// \param[in] continuation Whether to match continuation words, i.e. not at the start of a token
+  /// \return The root node
+  NodeId Root(bool continuation) const { return continuation ? kContinuationRoot : kWordRoot; }
+
+  /// \brief Follow the bytes of a string from a node
+  /// \param[in] node The node to start from
+  /// \param[in] bytes The bytes to follow
+  /// \return The node reached, kNoNode if no word continues with these bytes
+  NodeId Step(NodeId node, std::string_view bytes) const;
+
+  /// \brief Get the id of the word which ends at a node
+  /// \param[in] node The node
+  /// \return The id of the word, Vocab::kNoTokenExists if no word ends at the node
+  WordIdType GetWordId(NodeId node) const { return nodes_[node].word_id; }
+
+ private:
+  static const NodeId kWordRoot;
+  static const NodeId kContinuationRoot;
+
+  struct Node {
+    uint32_t edges_begin;  // index of the first edge to a child in edges_
+    uint32_t edges_end;    // index after the last edge to a child in edges_
+    WordIdType word_id;    // id of the word ending at the node, Vocab::kNoTokenExists if none
+  };
+
+  struct Edge {
+    uint8_t byte;  // label of the edge
+    NodeId child;  // node the edge leads to
+  };
+
+  std::vector<Node> nodes_;
+  std::vector<Edge> edges_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
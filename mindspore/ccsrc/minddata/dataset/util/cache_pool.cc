@@ -21,10 +21,22 @@
 namespace mindspore {
 namespace dataset {
 CachePool::CachePool(const value_allocator &alloc, const std::string &root)
-    : alloc_(alloc), root_(root), subfolder_(Services::GetUniqueID()), sm_(nullptr), tree_(nullptr) {}
+    : alloc_(alloc),
+      root_(root),
+      subfolder_(Services::GetUniqueID()),
+      sm_(nullptr),
+      tree_(nullptr),
+      num_mem_hit_(0),
+      num_disk_hit_(0),
+      num_promoted_(0),
+      num_evicted_(0) {}
 
 Status CachePool::DoServiceStart() {
   tree_ = std::make_shared<data_index>();
+  num_mem_hit_ = 0;
+  num_disk_hit_ = 0;
+  num_promoted_ = 0;
+  num_evicted_ = 0;
   // If we are given a disk path, set up the StorageManager
   if (!root_.toString().empty()) {
     Path spill = GetSpillPath();
@@ -51,6 +63,11 @@ Status CachePool::DoServiceStop() {
     }
   }
   tree_.reset();
+  {
+    std::unique_lock<std::mutex> lck(lru_mux_);
+    lru_.clear();
+    lru_pos_.clear();
+  }
   if (!root_.toString().empty()) {
     Path spill = GetSpillPath();
     auto it = Path::DirIterator::OpenDirectory(&spill);
@@ -105,6 +122,9 @@ Status CachePool::Insert(const std::vector<ReadableSlice> &buf, CachePool::key_t
   rc = tree_->insert(bl, key);
   if (rc.IsError() && bl.ptr != nullptr) {
     alloc_.deallocate(bl.ptr, sz);
+  } else if (rc.IsOk() && bl.ptr != nullptr && sm_ != nullptr) {
+    // Without a disk to spill to nothing is ever evicted, so only a tiered pool tracks the use of its buffers.
+    AddToLru(*key);
   }
   return rc;
 }
@@ -113,16 +133,37 @@ Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *byt
   auto r = tree_->Search(key);
   if (r.second) {
     auto &it = r.first;
-    if (it->ptr != nullptr) {
-      ReadableSlice src(it->ptr, it->sz);
-      RETURN_IF_NOT_OK(WritableSlice::Copy(dest, src));
-    } else if (sm_ != nullptr) {
-      size_t expectedLength = 0;
-      RETURN_IF_NOT_OK(sm_->Read(it->storage_key, dest, &expectedLength));
-      if (expectedLength != it->sz) {
-        MS_LOG(ERROR) << "Unexpected length. Read " << expectedLength << ". Expected " << it->sz << "."
-                      << " Internal key: " << key << "\n";
-        RETURN_STATUS_UNEXPECTED("Length mismatch. See log file for details.");
+    if (sm_ == nullptr) {
+      // Nothing is evicted without a disk tier, so the buffer stays where Insert put it.
+      if (it->ptr != nullptr) {
+        ReadableSlice src(it->ptr, it->sz);
+        RETURN_IF_NOT_OK(WritableSlice::Copy(dest, src));
+        ++num_mem_hit_;
+      }
+    } else {
+      StorageManager::key_type storage_key = kNoStorageKey;
+      {
+        // The buffer can't be evicted while we are reading it.
+        SharedLock lck(&tier_lock_);
+        if (it->ptr != nullptr) {
+          ReadableSlice src(it->ptr, it->sz);
+          RETURN_IF_NOT_OK(WritableSlice::Copy(dest, src));
+          ++num_mem_hit_;
+          Touch(key);
+        } else {
+          storage_key = it->storage_key;
+        }
+      }
+      // The copy on disk never moves once written, so it is read without holding up the evictions.
+      if (storage_key != kNoStorageKey) {
+        size_t expectedLength = 0;
+        RETURN_IF_NOT_OK(sm_->Read(storage_key, dest, &expectedLength));
+        if (expectedLength != it->sz) {
+          MS_LOG(ERROR) << "Unexpected length. Read " << expectedLength << ". Expected " << it->sz << "."
+                        << " Internal key: " << key << "\n";
+          RETURN_STATUS_UNEXPECTED("Length mismatch. See log file for details.");
+        }
+        ++num_disk_hit_;
       }
     }
     if (bytesRead != nullptr) {
@@ -141,6 +182,7 @@ Path CachePool::GetSpillPath() const {
 CachePool::CacheStat CachePool::GetStat() const {
   CacheStat cs{0};
   int64_t total_sz = 0;
+  SharedLock lck(&tier_lock_);
   for (auto &it : *tree_) {
     total_sz += it.sz;
     if (it.ptr != nullptr) {
@@ -156,41 +198,119 @@ CachePool::CacheStat CachePool::GetStat() const {
       cs.average_cache_sz = 1;
     }
   }
+  cs.num_mem_hit = num_mem_hit_;
+  cs.num_disk_hit = num_disk_hit_;
+  cs.num_promoted = num_promoted_;
+  cs.num_evicted = num_evicted_;
   return cs;
 }
-Status CachePool::Spill(CachePool::DataLocator *dl) {
+Status CachePool::Promote(CachePool::key_type key) {
+  auto r = tree_->Search(key);
+  if (!r.second) {
+    RETURN_STATUS_UNEXPECTED("Key not found");
+  }
+  auto &it = r.first;
   if (sm_ == nullptr) {
-    RETURN_STATUS_UNEXPECTED("No disk storage to spill");
+    // Every buffer of a pool without a disk tier is in memory.
+    CHECK_FAIL_RETURN_UNEXPECTED(it->ptr != nullptr, "No disk storage to locate the data");
+    return Status::OK();
   }
-  RETURN_UNEXPECTED_IF_NULL(dl);
-  RETURN_UNEXPECTED_IF_NULL(dl->ptr);
-  if (dl->storage_key == 0) {
-    ReadableSlice data(dl->ptr, dl->sz);
-    RETURN_IF_NOT_OK(sm_->Write(&dl->storage_key, {data}));
+  {
+    SharedLock lck(&tier_lock_);
+    if (it->ptr != nullptr) {
+      Touch(key);
+      return Status::OK();
+    }
   }
-  alloc_.deallocate(dl->ptr, dl->sz);
-  dl->ptr = nullptr;
+  // The disk copy doesn't move, so we can read it into the new block without any lock.
+  pointer p = nullptr;
+  RETURN_IF_NOT_OK(AllocateOrEvict(it->sz, &p));
+  WritableSlice dest(p, it->sz);
+  size_t bytesRead = 0;
+  Status rc = sm_->Read(it->storage_key, &dest, &bytesRead);
+  if (rc.IsOk() && bytesRead != it->sz) {
+    MS_LOG(ERROR) << "Unexpected length. Read " << bytesRead << ". Expected " << it->sz << "."
+                  << " Internal key: " << key << "\n";
+    rc = Status(StatusCode::kUnexpectedError, __LINE__, __FILE__, "Length mismatch. See log file for details.");
+  }
+  if (rc.IsOk()) {
+    UniqueLock lck(&tier_lock_);
+    // Someone else may have promoted it in the meantime.
+    if (it->ptr == nullptr) {
+      it->ptr = p;
+      p = nullptr;
+    }
+  }
+  if (p != nullptr) {
+    alloc_.deallocate(p, it->sz);
+    return rc;
+  }
+  AddToLru(key);
+  ++num_promoted_;
   return Status::OK();
 }
-Status CachePool::Locate(CachePool::DataLocator *dl) {
-  RETURN_UNEXPECTED_IF_NULL(dl);
-  if (dl->ptr == nullptr) {
-    if (sm_ == nullptr) {
-      RETURN_STATUS_UNEXPECTED("No disk storage to locate the data");
-    }
+void CachePool::AddToLru(CachePool::key_type key) {
+  std::unique_lock<std::mutex> lck(lru_mux_);
+  if (lru_pos_.find(key) == lru_pos_.end()) {
+    lru_.push_front(key);
+    lru_pos_.emplace(key, lru_.begin());
+  }
+}
+void CachePool::Touch(CachePool::key_type key) const {
+  std::unique_lock<std::mutex> lck(lru_mux_);
+  auto it = lru_pos_.find(key);
+  if (it != lru_pos_.end()) {
+    lru_.splice(lru_.begin(), lru_, it->second);
+  }
+}
+Status CachePool::AllocateOrEvict(size_t sz, CachePool::pointer *p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  do {
     try {
-      dl->ptr = alloc_.allocate(dl->sz);
-      WritableSlice dest(dl->ptr, dl->sz);
-      Status rc = Read(dl->storage_key, &dest);
-      if (rc.IsError()) {
-        alloc_.deallocate(dl->ptr, dl->sz);
-        dl->ptr = nullptr;
-        return rc;
-      }
+      *p = alloc_.allocate(sz);
+      return Status::OK();
     } catch (const std::bad_alloc &e) {
-      return Status(StatusCode::kOutOfMemory, __LINE__, __FILE__);
+      key_type victim;
+      {
+        std::unique_lock<std::mutex> lck(lru_mux_);
+        if (lru_.empty()) {
+          return Status(StatusCode::kOutOfMemory, __LINE__, __FILE__);
+        }
+        victim = lru_.back();
+        lru_pos_.erase(victim);
+        lru_.pop_back();
+      }
+      RETURN_IF_NOT_OK(Evict(victim));
+    }
+  } while (true);
+}
+Status CachePool::Evict(CachePool::key_type key) {
+  if (sm_ == nullptr) {
+    RETURN_STATUS_UNEXPECTED("No disk storage to spill");
+  }
+  auto r = tree_->Search(key);
+  if (!r.second) {
+    RETURN_STATUS_UNEXPECTED("Key not found");
+  }
+  auto &it = r.first;
+  pointer p = nullptr;
+  {
+    SharedLock lck(&tier_lock_);
+    if (it->ptr == nullptr) {
+      return Status::OK();
+    }
+    // A cached buffer never changes. If it was promoted from disk, the copy on disk is still good.
+    if (it->storage_key == kNoStorageKey) {
+      ReadableSlice data(it->ptr, it->sz);
+      RETURN_IF_NOT_OK(sm_->Write(&it->storage_key, {data}));
     }
+    // Wait for the readers of the memory block to finish.
+    lck.Upgrade();
+    p = it->ptr;
+    it->ptr = nullptr;
   }
+  alloc_.deallocate(p, it->sz);
+  ++num_evicted_;
   return Status::OK();
 }
 size_t CachePool::GetSize(CachePool::key_type key) const {
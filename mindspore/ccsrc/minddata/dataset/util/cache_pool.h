@@ -16,11 +16,15 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_CACHE_POOL_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_CACHE_POOL_H_
 
+#include <atomic>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "minddata/dataset/util/allocator.h"
+#include "minddata/dataset/util/lock.h"
 #include "minddata/dataset/util/service.h"
 #include "minddata/dataset/util/slice.h"
 #include "minddata/dataset/util/storage_manager.h"
@@ -32,6 +36,8 @@ namespace dataset {
 /// ReadableSlice where all memory blocks will be copied to one contiguous block which can be in memory or spilled to
 /// disk (if a disk directory is provided). Every buffer insert will return a generated key which can be used to
 /// restore the buffer.
+/// The memory is the hot tier and the disk the warm tier. A buffer goes to disk when it doesn't fit in memory, and
+/// can be promoted back ahead of a Read, in which case the least recently used buffers in memory are evicted to disk.
 /// \see ReadableSlice
 class CachePool : public Service {
  public:
@@ -42,10 +48,13 @@ class CachePool : public Service {
   using const_reference = const base_type &;
   using value_allocator = Allocator<base_type>;
 
-  // An internal class to locate the whereabouts of a backed up buffer which can be either in
+  /// Storage key of a buffer which has never been written to disk
+  static constexpr StorageManager::key_type kNoStorageKey = -1;
+
+  // An internal class to locate the whereabouts of a backed up buffer which can be in memory, on disk, or both
   class DataLocator {
    public:
-    DataLocator() : ptr(nullptr), sz(0), storage_key(0) {}
+    DataLocator() : ptr(nullptr), sz(0), storage_key(kNoStorageKey) {}
     ~DataLocator() = default;
     DataLocator(const DataLocator &other) = default;
     DataLocator &operator=(const DataLocator &other) = default;
@@ -55,7 +64,7 @@ class CachePool : public Service {
       storage_key = other.storage_key;
       other.ptr = nullptr;
       other.sz = 0;
-      other.storage_key = 0;
+      other.storage_key = kNoStorageKey;
     }
     DataLocator &operator=(DataLocator &&other) noexcept {
       if (&other != this) {
@@ -64,7 +73,7 @@ class CachePool : public Service {
         storage_key = other.storage_key;
         other.ptr = nullptr;
         other.sz = 0;
-        other.storage_key = 0;
+        other.storage_key = kNoStorageKey;
       }
       return *this;
     }
@@ -78,11 +87,15 @@ class CachePool : public Service {
   using bl_alloc_type = typename value_allocator::template rebind<DataLocator>::other;
 
   /// \brief Simple statistics returned from CachePool like how many elements are cached in memory and
-  /// how many elements are spilled to disk.
+  /// how many elements are spilled to disk, and how many reads are served from each tier.
   struct CacheStat {
     int64_t num_mem_cached;
     int64_t num_disk_cached;
     int64_t average_cache_sz;
+    int64_t num_mem_hit;
+    int64_t num_disk_hit;
+    int64_t num_promoted;
+    int64_t num_evicted;
   };
 
   /// \brief Constructor
@@ -114,9 +127,11 @@ class CachePool : public Service {
   /// \return Error code
   Status Read(key_type key, WritableSlice *dest, size_t *bytesRead = nullptr) const;
 
-  Status Spill(DataLocator *dl);
-
-  Status Locate(DataLocator *dl);
+  /// \brief Bring a buffer spilled to disk back to memory ahead of a Read. If memory is full, the least recently
+  /// used buffers in memory are evicted to disk to make room.
+  /// \param[in] key A previous key returned from Insert
+  /// \return Error code. kOutOfMemory if nothing can be evicted to make room.
+  Status Promote(key_type key);
 
   size_t GetSize(key_type key) const;
 
@@ -134,6 +149,28 @@ class CachePool : public Service {
   const std::string subfolder_;
   std::shared_ptr<StorageManager> sm_;
   std::shared_ptr<data_index> tree_;
+  // Shared by the readers of a buffer in memory, exclusive to move a buffer between memory and disk.
+  mutable RWLock tier_lock_;
+  // Keys of the buffers in memory, most recently used first. Only tracked when there is a disk tier to evict to.
+  mutable std::mutex lru_mux_;
+  mutable std::list<key_type> lru_;
+  mutable std::unordered_map<key_type, std::list<key_type>::iterator> lru_pos_;
+  mutable std::atomic<int64_t> num_mem_hit_;
+  mutable std::atomic<int64_t> num_disk_hit_;
+  std::atomic<int64_t> num_promoted_;
+  std::atomic<int64_t> num_evicted_;
+
+  /// \brief Add a buffer just put in memory as the most recently used one
+  void AddToLru(key_type key);
+
+  /// \brief Mark a buffer in memory as the most recently used one
+  void Touch(key_type key) const;
+
+  /// \brief Allocate memory, evicting the least recently used buffers until it fits
+  Status AllocateOrEvict(size_t sz, pointer *p);
+
+  /// \brief Free the memory of a buffer. It is written to disk first unless a copy is already there.
+  Status Evict(key_type key);
 };
 }  // namespace dataset
 }  // namespace mindspore
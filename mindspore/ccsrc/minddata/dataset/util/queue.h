@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_QUEUE_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_QUEUE_H_
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -44,7 +45,12 @@ class Queue {
   using const_reference = const T &;
 
   explicit Queue(int sz)
-      : sz_(sz), arr_(Services::GetAllocator<T>()), head_(0), tail_(0), my_name_(Services::GetUniqueID()) {
+      : sz_(sz),
+        cap_(sz),
+        arr_(Services::GetAllocator<T>()),
+        head_(0),
+        tail_(0),
+        my_name_(Services::GetUniqueID()) {
     Status rc = arr_.allocate(sz);
     if (rc.IsError()) {
       MS_LOG(ERROR) << "Fail to create a queue.";
@@ -61,7 +67,7 @@ class Queue {
     return (v >= 0) ? v : 0;
   }
 
-  size_t capacity() const { return sz_; }
+  size_t capacity() const { return cap_; }
 
   bool empty() const { return head_ == tail_; }
 
@@ -71,7 +77,7 @@ class Queue {
   Status Add(const_reference ele) noexcept {
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
-    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
+    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() < capacity()); });
     if (rc.IsOk()) {
       auto k = tail_++ % sz_;
       *(arr_[k]) = ele;
@@ -86,7 +92,7 @@ class Queue {
   Status Add(T &&ele) noexcept {
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
-    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
+    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() < capacity()); });
     if (rc.IsOk()) {
       auto k = tail_++ % sz_;
       *(arr_[k]) = std::forward<T>(ele);
@@ -102,7 +108,7 @@ class Queue {
   Status EmplaceBack(Ts &&... args) noexcept {
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
-    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
+    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() < capacity()); });
     if (rc.IsOk()) {
       auto k = tail_++ % sz_;
       new (arr_[k]) T(std::forward<Ts>(args)...);
@@ -130,6 +136,30 @@ class Queue {
     return rc;
   }
 
+  // Change the capacity of the queue while producers and consumers are running. The elements in the queue
+  // are kept. When shrinking below the current size, producers block until enough elements are popped.
+  Status Resize(size_t new_capacity) noexcept {
+    if (new_capacity == 0) {
+      RETURN_STATUS_UNEXPECTED("Queue capacity 0 is invalid.");
+    }
+    std::unique_lock<std::mutex> _lock(mux_);
+    size_t n = size();
+    size_t new_sz = std::max(new_capacity, n);
+    MemGuard<T, Allocator<T>> new_arr(Services::GetAllocator<T>());
+    RETURN_IF_NOT_OK(new_arr.allocate(new_sz));
+    for (size_t i = 0; i < n; ++i) {
+      *(new_arr[i]) = std::move(*(arr_[(head_ + i) % sz_]));
+    }
+    arr_ = std::move(new_arr);
+    sz_ = new_sz;
+    cap_ = new_capacity;
+    head_ = 0;
+    tail_ = n;
+    full_cv_.NotifyAll();
+    MS_LOG(DEBUG) << "Resize Q with uuid " << my_name_ << " to capacity " << cap_ << ".";
+    return Status::OK();
+  }
+
   void ResetQue() noexcept {
     std::unique_lock<std::mutex> _lock(mux_);
     // If there are elements in the queue, drain them. We won't call PopFront directly
@@ -160,6 +190,7 @@ class Queue {
 
  private:
   size_t sz_;
+  size_t cap_;
   MemGuard<T, Allocator<T>> arr_;
   size_t head_;
   size_t tail_;
@@ -0,0 +1,227 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/size_class_pool.h"
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Every block starts with a header which remembers its size class. The header is 16 bytes so the memory handed out
+// keeps the alignment of malloc.
+struct BlockHeader {
+  uint64_t size_class;
+  uint64_t size;
+};
+constexpr size_t kHeaderSize = sizeof(BlockHeader);
+constexpr uint64_t kLargeBlock = std::numeric_limits<uint64_t>::max();
+constexpr size_t kLog2MinClassSize = 6;
+constexpr size_t kClassesPerDoubling = 4;
+constexpr size_t kMaxBlocksPerThreadCache = 64;
+}  // namespace
+
+size_t SizeClassPool::SizeClass(size_t n) {
+  if (n <= kMinClassSize) {
+    return 0;
+  }
+  // 2^p < n <= 2^(p+1), the classes between them are 2^p + k * 2^(p-2) for k in [1, 4].
+  size_t p = 0;
+  for (size_t v = n - 1; v > 1; v >>= 1) {
+    ++p;
+  }
+  size_t base = static_cast<size_t>(1) << p;
+  size_t step = base / kClassesPerDoubling;
+  size_t k = (n - base + step - 1) / step;
+  return (p - kLog2MinClassSize) * kClassesPerDoubling + k;
+}
+
+size_t SizeClassPool::ClassSize(size_t size_class) {
+  if (size_class == 0) {
+    return kMinClassSize;
+  }
+  size_t p = kLog2MinClassSize + (size_class - 1) / kClassesPerDoubling;
+  size_t k = (size_class - 1) % kClassesPerDoubling + 1;
+  size_t base = static_cast<size_t>(1) << p;
+  return base + k * (base / kClassesPerDoubling);
+}
+
+SizeClassPool::SizeClassPool(int64_t max_cache_size)
+    : max_cache_size_(max_cache_size),
+      num_allocs_(0),
+      num_cache_hits_(0),
+      num_system_allocs_(0),
+      num_system_frees_(0),
+      bytes_in_use_(0),
+      peak_bytes_in_use_(0),
+      bytes_cached_(0) {
+  const size_t num_classes = SizeClass(kMaxClassSize) + 1;
+  // Pipelines usually run more threads than there are cores, two caches per core keep the sharing low.
+  const size_t num_caches = std::max<size_t>(std::thread::hardware_concurrency(), 2) * 2;
+  thread_caches_.reserve(num_caches);
+  for (size_t i = 0; i < num_caches; ++i) {
+    auto cache = std::make_unique<Cache>();
+    cache->free_blocks.resize(num_classes);
+    thread_caches_.push_back(std::move(cache));
+  }
+  central_cache_.free_blocks.resize(num_classes);
+}
+
+SizeClassPool::~SizeClassPool() { Trim(); }
+
+SizeClassPool::Cache *SizeClassPool::MyCache() {
+  static std::atomic<uint32_t> next_thread_id(0);
+  thread_local uint32_t thread_id = next_thread_id++;
+  return thread_caches_[thread_id % thread_caches_.size()].get();
+}
+
+void *SizeClassPool::TakeBlock(Cache *cache, size_t size_class) {
+  std::unique_lock<std::mutex> lck(cache->mux);
+  auto &blocks = cache->free_blocks[size_class];
+  if (blocks.empty()) {
+    return nullptr;
+  }
+  void *block = blocks.back();
+  blocks.pop_back();
+  return block;
+}
+
+int64_t SizeClassPool::FreeBlocks(Cache *cache) {
+  std::unique_lock<std::mutex> lck(cache->mux);
+  int64_t freed = 0;
+  for (auto &blocks : cache->free_blocks) {
+    for (auto block : blocks) {
+      freed += static_cast<int64_t>(static_cast<BlockHeader *>(block)->size);
+      free(block);
+      ++num_system_frees_;
+    }
+    blocks.clear();
+  }
+  return freed;
+}
+
+Status SizeClassPool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  ++num_allocs_;
+  uint64_t size_class = n > kMaxClassSize ? kLargeBlock : SizeClass(n);
+  size_t size = size_class == kLargeBlock ? n : ClassSize(size_class);
+  void *block = nullptr;
+  if (size_class != kLargeBlock) {
+    block = TakeBlock(MyCache(), size_class);
+    if (block == nullptr) {
+      block = TakeBlock(&central_cache_, size_class);
+    }
+  }
+  if (block != nullptr) {
+    ++num_cache_hits_;
+    bytes_cached_ -= static_cast<int64_t>(size);
+  } else {
+    RETURN_IF_NOT_OK(DeMalloc(kHeaderSize + size, &block, false));
+    ++num_system_allocs_;
+  }
+  auto header = static_cast<BlockHeader *>(block);
+  header->size_class = size_class;
+  header->size = size;
+  int64_t in_use = bytes_in_use_ += static_cast<int64_t>(size);
+  int64_t peak = peak_bytes_in_use_;
+  while (in_use > peak && !peak_bytes_in_use_.compare_exchange_weak(peak, in_use)) {
+  }
+  *p = static_cast<uint8_t *>(block) + kHeaderSize;
+  return Status::OK();
+}
+
+void SizeClassPool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  void *block = static_cast<uint8_t *>(p) - kHeaderSize;
+  auto header = static_cast<BlockHeader *>(block);
+  uint64_t size_class = header->size_class;
+  auto size = static_cast<int64_t>(header->size);
+  bytes_in_use_ -= size;
+  if (size_class == kLargeBlock || bytes_cached_ + size > max_cache_size_) {
+    free(block);
+    ++num_system_frees_;
+    return;
+  }
+  bytes_cached_ += size;
+  std::vector<void *> spill;
+  Cache *cache = MyCache();
+  {
+    std::unique_lock<std::mutex> lck(cache->mux);
+    auto &blocks = cache->free_blocks[size_class];
+    blocks.push_back(block);
+    if (blocks.size() > kMaxBlocksPerThreadCache) {
+      auto half = blocks.begin() + blocks.size() / 2;
+      spill.assign(half, blocks.end());
+      blocks.erase(half, blocks.end());
+    }
+  }
+  if (!spill.empty()) {
+    std::unique_lock<std::mutex> lck(central_cache_.mux);
+    auto &blocks = central_cache_.free_blocks[size_class];
+    blocks.insert(blocks.end(), spill.begin(), spill.end());
+  }
+}
+
+Status SizeClassPool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  if (*p == nullptr) {
+    return Allocate(new_sz, p);
+  }
+  auto header = reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(*p) - kHeaderSize);
+  if (header->size >= new_sz) {
+    // The block of the current size class is big enough.
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  errno_t err = memcpy_s(q, new_sz, *p, std::min<size_t>(old_sz, header->size));
+  if (err) {
+    Deallocate(q);
+    RETURN_STATUS_UNEXPECTED(std::to_string(err));
+  }
+  Deallocate(*p);
+  *p = q;
+  return Status::OK();
+}
+
+uint64_t SizeClassPool::get_max_size() const { return std::numeric_limits<uint64_t>::max(); }
+
+// Like SystemPool, the memory comes from the system and there is no fixed capacity to run out of.
+int SizeClassPool::PercentFree() const { return 100; }
+
+void SizeClassPool::Trim() {
+  for (auto &cache : thread_caches_) {
+    bytes_cached_ -= FreeBlocks(cache.get());
+  }
+  bytes_cached_ -= FreeBlocks(&central_cache_);
+}
+
+SizeClassPool::Stats SizeClassPool::GetStats() const {
+  Stats stats;
+  stats.num_allocs = num_allocs_;
+  stats.num_cache_hits = num_cache_hits_;
+  stats.num_system_allocs = num_system_allocs_;
+  stats.num_system_frees = num_system_frees_;
+  stats.bytes_in_use = bytes_in_use_;
+  stats.peak_bytes_in_use = peak_bytes_in_use_;
+  stats.bytes_cached = bytes_cached_;
+  return stats;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,114 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "minddata/dataset/core/constants.h"
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+// A memory pool which keeps freed blocks for reuse instead of returning them to the system. Requests are rounded
+// up to a size class, four classes per power of two, so a freed block can serve any later request of its class.
+// Freed blocks go to a cache of the freeing thread first, which keeps the threads of a pipeline off a shared lock.
+// A thread cache which holds too many blocks of a class moves half of them to a central cache that every thread
+// takes from when its own cache is empty. At most max_cache_size bytes are cached, the rest is freed to the system.
+// Requests bigger than the largest class are passed to the system.
+class SizeClassPool : public MemoryPool {
+ public:
+  struct Stats {
+    uint64_t num_allocs;          // Number of Allocate() calls
+    uint64_t num_cache_hits;      // Allocations served from a cache
+    uint64_t num_system_allocs;   // Allocations which had to go to the system
+    uint64_t num_system_frees;    // Blocks given back to the system
+    int64_t bytes_in_use;         // Bytes handed out, rounded up to their size class
+    int64_t peak_bytes_in_use;    // Highest bytes_in_use so far
+    int64_t bytes_cached;         // Bytes kept in the caches
+  };
+
+  static constexpr size_t kMinClassSize = 64;
+  static constexpr size_t kMaxClassSize = 256 * 1024 * 1024;
+
+  // @param max_cache_size - The number of bytes the caches may hold
+  explicit SizeClassPool(int64_t max_cache_size = kCfgTensorPoolCacheSize);
+
+  SizeClassPool(const SizeClassPool &) = delete;
+
+  SizeClassPool &operator=(const SizeClassPool &) = delete;
+
+  ~SizeClassPool() override;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override;
+
+  // Change the number of bytes the caches may hold. Blocks already cached are kept until they are reused.
+  void set_max_cache_size(int64_t max_cache_size) { max_cache_size_ = max_cache_size; }
+
+  int64_t max_cache_size() const { return max_cache_size_; }
+
+  // Give every cached block back to the system
+  void Trim();
+
+  Stats GetStats() const;
+
+  // The size class of a request and the size of the blocks of a class
+  static size_t SizeClass(size_t n);
+
+  static size_t ClassSize(size_t size_class);
+
+ private:
+  struct Cache {
+    std::mutex mux;
+    std::vector<std::vector<void *>> free_blocks;  // Free blocks of each size class
+  };
+
+  Cache *MyCache();
+
+  // Pop a free block of the size class from the cache, nullptr if there is none
+  static void *TakeBlock(Cache *cache, size_t size_class);
+
+  // Free every block of the cache and return the number of bytes freed
+  int64_t FreeBlocks(Cache *cache);
+
+  std::vector<std::unique_ptr<Cache>> thread_caches_;
+  Cache central_cache_;
+  std::atomic<int64_t> max_cache_size_;
+
+  std::atomic<uint64_t> num_allocs_;
+  std::atomic<uint64_t> num_cache_hits_;
+  std::atomic<uint64_t> num_system_allocs_;
+  std::atomic<uint64_t> num_system_frees_;
+  std::atomic<int64_t> bytes_in_use_;
+  std::atomic<int64_t> peak_bytes_in_use_;
+  std::atomic<int64_t> bytes_cached_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
@@ -110,6 +110,9 @@ const int kMaxFileCount = 4096;   // read
 const int kMinConsumerCount = 1;
 const int kMaxConsumerCount = 128;
 
+// number of tasks the pages of a task are read ahead of, when shard files are mapped
+const int kNumPrefetchTasks = 16;
+
 const int kMaxSchemaCount = 1;
 const int kMaxThreadCount = 32;
 const int kMaxFieldCount = 100;
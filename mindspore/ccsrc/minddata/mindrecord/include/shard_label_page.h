@@ -0,0 +1,104 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_LABEL_PAGE_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_LABEL_PAGE_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/shard_error.h"
+#include "minddata/mindrecord/include/shard_schema.h"
+
+namespace mindspore {
+namespace mindrecord {
+/// \brief Layout of the label pages of a schema.
+/// The label columns are the scalar int32, int64, float32 and float64 fields. A label page stores rows
+/// [start_row_id, end_row_id) of a shard column by column, each column as a fixed-width array: int32 as 4 bytes,
+/// int64 as 8 bytes, float32 and float64 as 8 bytes doubles, which keeps the value written to the raw page.
+class ShardLabelColumns {
+ public:
+  /// \brief get the label columns of the schemas, there are none unless there is exactly one schema
+  /// \param[in] schemas the schemas of the dataset
+  explicit ShardLabelColumns(const std::vector<std::shared_ptr<Schema>> &schemas);
+
+  ~ShardLabelColumns() = default;
+
+  bool Empty() const { return names_.empty(); }
+
+  const std::vector<std::string> &GetColumnNames() const { return names_; }
+
+  /// \brief check if a column is a label column
+  bool HasColumn(const std::string &column_name) const;
+
+  /// \brief check if the label columns are all the fields of the raw page
+  bool IsAllRawFields() const { return all_raw_fields_; }
+
+  /// \brief get the bytes of one row of all label columns
+  uint64_t GetRowWidth() const { return row_width_; }
+
+  /// \brief append the label columns of a row, row by row
+  /// \param[in] row the raw data of the row
+  /// \param[out] rows the encoded rows
+  /// \return MSRStatus FAILED if a label column is missing or does not hold a value of its type
+  MSRStatus AppendRow(const json &row, std::vector<uint8_t> *rows) const;
+
+  /// \brief transpose rows encoded by AppendRow to a label page
+  /// \param[in] rows the encoded rows
+  /// \param[in] start_row the first row of the page
+  /// \param[in] end_row the row after the last row of the page
+  /// \return the content of the page
+  std::vector<uint8_t> BuildPage(const std::vector<uint8_t> &rows, uint64_t start_row, uint64_t end_row) const;
+
+  /// \brief decode a label page, one column array at a time
+  /// \param[in] page the content of the page
+  /// \param[in] page_size the size of the content
+  /// \param[in] num_rows the number of rows of the page
+  /// \param[in] columns the columns to decode, all label columns if empty
+  /// \param[out] values the json of each row is appended
+  /// \return MSRStatus FAILED if the page is too small
+  MSRStatus DecodePage(const uint8_t *page, uint64_t page_size, uint64_t num_rows,
+                       const std::vector<std::string> &columns, std::vector<json> *values) const;
+
+  /// \brief get the bytes of a value decoded by DecodeColumn, the size of the type of the column in the schema
+  /// \param[in] column_name the label column
+  /// \return the bytes of a value, 0 if it is not a label column
+  uint64_t GetValueSize(const std::string &column_name) const;
+
+  /// \brief decode a column of a label page to an array of the type of the column in the schema
+  /// \param[in] page the content of the page
+  /// \param[in] page_size the size of the content
+  /// \param[in] num_rows the number of rows of the page
+  /// \param[in] column_name the label column
+  /// \param[out] array the values of the rows are appended
+  /// \return MSRStatus FAILED if the page is too small or the column is not a label column
+  MSRStatus DecodeColumn(const uint8_t *page, uint64_t page_size, uint64_t num_rows, const std::string &column_name,
+                         std::vector<uint8_t> *array) const;
+
+ private:
+  enum LabelType { kLabelInt32, kLabelInt64, kLabelFloat32, kLabelFloat64 };
+
+  std::vector<std::string> names_;  // label columns, in the order of the schema
+  std::vector<LabelType> types_;    // schema type of each label column
+  std::vector<uint64_t> widths_;    // bytes of each value of each label column
+  uint64_t row_width_ = 0;          // bytes of one row of all label columns
+  bool all_raw_fields_ = false;     // whether the raw page holds label columns only
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_LABEL_PAGE_H_
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MAPPED_FILE_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MAPPED_FILE_H_
+
+#include <cstdint>
+#include <string>
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+/// \brief Read-only memory mapping of a whole shard file.
+/// The mapping is shared by all consumers: reading a row is a copy out of the page cache, without the seek and read
+/// system calls of a file stream per consumer.
+class ShardMappedFile {
+ public:
+  ShardMappedFile() = default;
+
+  ~ShardMappedFile();
+
+  ShardMappedFile(const ShardMappedFile &) = delete;
+
+  ShardMappedFile &operator=(const ShardMappedFile &) = delete;
+
+  /// \brief map the file, fails on platforms without mmap
+  /// \param[in] file_path the shard file
+  /// \return MSRStatus the status of MSRStatus
+  MSRStatus Open(const std::string &file_path);
+
+  /// \brief unmap the file
+  void Close();
+
+  /// \brief get a slice of the mapped file
+  /// \param[in] offset offset of the slice in the file
+  /// \param[in] size size of the slice
+  /// \return the start of the slice, nullptr if the slice is not within the file
+  const uint8_t *Slice(uint64_t offset, uint64_t size) const;
+
+  /// \brief advise the kernel that a slice will be read soon, so that its pages are read ahead
+  /// \param[in] offset offset of the slice in the file
+  /// \param[in] size size of the slice
+  void Prefetch(uint64_t offset, uint64_t size) const;
+
+  uint64_t GetSize() const { return size_; }
+
+ private:
+  uint8_t *data_ = nullptr;  // start of the mapping
+  uint64_t size_ = 0;        // size of the file
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MAPPED_FILE_H_
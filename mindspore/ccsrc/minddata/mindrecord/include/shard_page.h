@@ -32,6 +32,7 @@ namespace mindrecord {
 const std::string kPageTypeRaw = "RAW_DATA";
 const std::string kPageTypeBlob = "BLOB_DATA";
 const std::string kPageTypeNewColumn = "NEW_COLUMN_DATA";
+const std::string kPageTypeLabel = "LABEL_DATA";
 
 class Page {
  public:
@@ -93,7 +94,7 @@ class Page {
   // JSON page: {
   //            "page_id":X,
   //            "shard_id":X,
-  //            "page_type":"XXX", (enum "raw_data", "blob_data", "new_column")
+  //            "page_type":"XXX", (enum "raw_data", "blob_data", "new_column", "label_data")
   //            "page_type_id":X,
   //            "start_row_id":X,
   //            "end_row_id":X,
@@ -48,6 +48,8 @@
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
+#include "minddata/mindrecord/include/shard_label_page.h"
+#include "minddata/mindrecord/include/shard_mapped_file.h"
 #include "minddata/mindrecord/include/shard_operator.h"
 #include "minddata/mindrecord/include/shard_pk_sample.h"
 #include "minddata/mindrecord/include/shard_reader.h"
@@ -183,6 +185,18 @@ class ShardReader {
   std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>> GetNextById(const int64_t &task_id,
                                                                                        const int32_t &consumer_id);
 
+  /// \brief decode the label columns to arrays of their schema types instead of json, called before Launch
+  /// \param[in] typed_labels true if the rows are read by GetLabelsById
+  void SetTypedLabels(bool typed_labels) { typed_labels_ = typed_labels; }
+
+  /// \brief get the label values of a row by id, without reading its blob or building json
+  /// \param[in] task_id the id of the row
+  /// \param[in] columns the label columns
+  /// \param[out] values the address and the size of the value of each column, valid until the reader is closed
+  /// \return MSRStatus FAILED if the row is not a common task or the shard was not read from label pages
+  MSRStatus GetLabelsById(int64_t task_id, const std::vector<std::string> &columns,
+                          std::vector<std::pair<const uint8_t *, uint64_t>> *values);
+
   /// \brief return a batch, given that one is ready, python API
   /// \return a batch of images and image data
   std::vector<std::tuple<std::vector<std::vector<uint8_t>>, pybind11::object>> GetNextPy();
@@ -213,7 +227,13 @@ class ShardReader {
   /// \brief wrap up labels to json format
   MSRStatus ConvertLabelToJson(const std::vector<std::vector<std::string>> &labels, std::shared_ptr<std::fstream> fs,
                                std::vector<std::vector<std::vector<uint64_t>>> &offsets, int shard_id,
-                               const std::vector<std::string> &columns, std::vector<std::vector<json>> &column_values);
+                               const std::vector<std::string> &columns, std::vector<std::vector<json>> &column_values,
+                               std::vector<json> &label_values);
+
+  /// \brief read the columns of all rows in one shard from its label pages
+  /// \return MSRStatus FAILED if a column is not stored in label pages or the pages do not hold all rows
+  MSRStatus ReadLabelPages(int shard_id, const std::vector<std::string> &columns, uint64_t num_rows,
+                           std::shared_ptr<std::fstream> fs, std::vector<json> *label_values);
 
   /// \brief read all rows for specified columns
   ROW_GROUPS ReadAllRowGroup(std::vector<std::string> &columns);
@@ -270,6 +290,9 @@ class ShardReader {
   /// \brief read one row by one task
   TASK_RETURN_CONTENT ConsumerOneTask(int task_id, uint32_t consumer_id);
 
+  /// \brief advise the kernel to read ahead the blob of one task, when shard files are mapped
+  void PrefetchTask(int task_id);
+
   /// \brief get labels from binary file
   std::pair<MSRStatus, std::vector<json>> GetLabelsFromBinaryFile(
     int shard_id, const std::vector<std::string> &columns, const std::vector<std::vector<std::string>> &label_offsets);
@@ -287,16 +310,18 @@ class ShardReader {
   std::pair<MSRStatus, std::vector<std::vector<uint8_t>>> UnCompressBlob(const std::vector<uint8_t> &raw_blob_data);
 
  protected:
-  uint64_t header_size_;                       // header size
-  uint64_t page_size_;                         // page size
-  int shard_count_;                            // number of shards
-  std::shared_ptr<ShardHeader> shard_header_;  // shard header
-  std::shared_ptr<ShardColumn> shard_column_;  // shard column
+  uint64_t header_size_;                              // header size
+  uint64_t page_size_;                                // page size
+  int shard_count_;                                   // number of shards
+  std::shared_ptr<ShardHeader> shard_header_;         // shard header
+  std::shared_ptr<ShardColumn> shard_column_;         // shard column
+  std::shared_ptr<ShardLabelColumns> label_columns_;  // columns stored in label pages
 
   std::vector<sqlite3 *> database_paths_;                                        // sqlite handle list
   std::vector<string> file_paths_;                                               // file paths
   std::vector<std::shared_ptr<std::fstream>> file_streams_;                      // single-file handle list
   std::vector<std::vector<std::shared_ptr<std::fstream>>> file_streams_random_;  // multiple-file handle list
+  std::vector<std::shared_ptr<ShardMappedFile>> mapped_files_;                   // mapped files shared by consumers
 
  private:
   int n_consumer_;                                         // number of workers (threads)
@@ -306,9 +331,13 @@ class ShardReader {
   ShardTask tasks_;                                        // shard task
   std::mutex shard_locker_;                                // locker of shard
 
+  // label columns of each shard decoded to their schema types, for GetLabelsById
+  std::vector<std::unordered_map<std::string, std::vector<uint8_t>>> label_arrays_;
+
   // flags
-  bool all_in_index_ = true;  // if all columns are stored in index-table
-  bool interrupt_ = false;    // reader interrupted
+  bool all_in_index_ = true;   // if all columns are stored in index-table
+  bool interrupt_ = false;     // reader interrupted
+  bool typed_labels_ = false;  // if label pages are decoded to label_arrays_ instead of json
 
   int num_padded_;  // number of padding samples
 
@@ -40,6 +40,7 @@
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "minddata/mindrecord/include/shard_index.h"
+#include "minddata/mindrecord/include/shard_label_page.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 #include "utils/log_adapter.h"
@@ -184,6 +185,12 @@ class ShardWriter {
   MSRStatus FlushBlobChunk(const std::shared_ptr<std::fstream> &out, const std::vector<std::vector<uint8_t>> &blob_data,
                            const std::pair<int, int> &blob_row);
 
+  /// \brief encode the label columns of the rows to write
+  MSRStatus SetLabelData(const std::map<uint64_t, std::vector<json>> &raw_data);
+
+  /// \brief write the label pages of the rows written to each shard to disk
+  MSRStatus WriteLabelPages();
+
   /// \brief write raw chunk to disk
   MSRStatus FlushRawChunk(const std::shared_ptr<std::fstream> &out,
                           const std::vector<std::pair<int, int>> &rows_in_group, const int &chunk_id,
@@ -253,6 +260,10 @@ class ShardWriter {
   std::shared_ptr<ShardHeader> shard_header_;                // shard header
   std::shared_ptr<ShardColumn> shard_column_;                // shard columns
 
+  std::shared_ptr<ShardLabelColumns> label_columns_;  // label columns, null if label pages are not written
+  std::vector<uint8_t> label_data_;                   // label columns of the rows to write, row by row
+  std::vector<std::vector<uint8_t>> label_rows_;      // label columns of the rows written to each shard
+
   std::map<uint64_t, std::map<int, std::string>> err_mg_;  // used for storing error raw_data info
 
   std::mutex check_mutex_;  // mutex for data check
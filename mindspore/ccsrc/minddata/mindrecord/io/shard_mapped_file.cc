@@ -0,0 +1,92 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_mapped_file.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "utils/ms_utils.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace mindrecord {
+ShardMappedFile::~ShardMappedFile() { Close(); }
+
+MSRStatus ShardMappedFile::Open(const std::string &file_path) {
+  Close();
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(common::SafeCStr(file_path), O_RDONLY);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Invalid file, failed to open file: " << file_path;
+    return FAILED;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    MS_LOG(ERROR) << "Invalid file, failed to get the size of file: " << file_path;
+    (void)close(fd);
+    return FAILED;
+  }
+  void *data = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping stays valid after the descriptor is closed
+  (void)close(fd);
+  if (data == MAP_FAILED) {
+    MS_LOG(WARNING) << "Failed to map file: " << file_path;
+    return FAILED;
+  }
+  // Rows are read in a shuffled order, read ahead is driven by Prefetch instead
+  (void)madvise(data, static_cast<size_t>(file_stat.st_size), MADV_RANDOM);
+  data_ = static_cast<uint8_t *>(data);
+  size_ = static_cast<uint64_t>(file_stat.st_size);
+  return SUCCESS;
+#else
+  return FAILED;
+#endif
+}
+
+void ShardMappedFile::Close() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (data_ != nullptr) {
+    (void)munmap(data_, static_cast<size_t>(size_));
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
+const uint8_t *ShardMappedFile::Slice(uint64_t offset, uint64_t size) const {
+  if (data_ == nullptr || offset > size_ || size > size_ - offset) {
+    return nullptr;
+  }
+  return data_ + offset;
+}
+
+void ShardMappedFile::Prefetch(uint64_t offset, uint64_t size) const {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (Slice(offset, size) == nullptr || size == 0) {
+    return;
+  }
+  // madvise works on whole pages
+  static const uint64_t kOsPageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  uint64_t start = offset - offset % kOsPageSize;
+  (void)madvise(data_ + start, static_cast<size_t>(offset + size - start), MADV_WILLNEED);
+#endif
+}
+}  // namespace mindrecord
+}  // namespace mindspore
@@ -23,6 +23,7 @@ using mindspore::ExceptionType::NoExceptionType;
 using mindspore::MsLogLevel::DEBUG;
 using mindspore::MsLogLevel::ERROR;
 using mindspore::MsLogLevel::INFO;
+using mindspore::MsLogLevel::WARNING;
 
 namespace mindspore {
 namespace mindrecord {
@@ -142,6 +143,7 @@ MSRStatus ShardReader::Init(const std::vector<std::string> &file_paths, bool loa
   } else {
     shard_column_ = std::make_shared<ShardColumn>(shard_header_, true);
   }
+  label_columns_ = std::make_shared<ShardLabelColumns>(shard_header_->GetSchemas());
   num_rows_ = 0;
   auto row_group_summary = ReadRowGroupSummary();
   for (const auto &rg : row_group_summary) {
@@ -193,6 +195,22 @@ MSRStatus ShardReader::Open() {
 }
 
 MSRStatus ShardReader::Open(int n_consumer) {
+  // All consumers read from one mapping of each file, the file streams of each consumer are the fallback
+  mapped_files_.clear();
+  for (const auto &file : file_paths_) {
+    auto mapped_file = std::make_shared<ShardMappedFile>();
+    if (mapped_file->Open(file) != SUCCESS) {
+      MS_LOG(INFO) << "Failed to map shard file, read it through file streams instead.";
+      mapped_files_.clear();
+      break;
+    }
+    mapped_files_.push_back(mapped_file);
+  }
+  if (!mapped_files_.empty()) {
+    MS_LOG(INFO) << "Map shard file successfully.";
+    return SUCCESS;
+  }
+
   file_streams_random_ =
     std::vector<std::vector<std::shared_ptr<std::fstream>>>(n_consumer, std::vector<std::shared_ptr<std::fstream>>());
   for (const auto &file : file_paths_) {
@@ -224,6 +242,7 @@ void ShardReader::FileStreamsOperator() {
       }
     }
   }
+  mapped_files_.clear();
   for (int i = static_cast<int>(database_paths_.size()) - 1; i >= 0; --i) {
     if (database_paths_[i] != nullptr) {
       auto ret = sqlite3_close(database_paths_[i]);
@@ -300,14 +319,19 @@ MSRStatus ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::str
                                           std::shared_ptr<std::fstream> fs,
                                           std::vector<std::vector<std::vector<uint64_t>>> &offsets, int shard_id,
                                           const std::vector<std::string> &columns,
-                                          std::vector<std::vector<json>> &column_values) {
+                                          std::vector<std::vector<json>> &column_values,
+                                          std::vector<json> &label_values) {
   for (int i = 0; i < static_cast<int>(labels.size()); ++i) {
     uint64_t group_id = std::stoull(labels[i][0]);
     uint64_t offset_start = std::stoull(labels[i][1]) + kInt64Len;
     uint64_t offset_end = std::stoull(labels[i][2]);
-    offsets[shard_id].emplace_back(
-      std::vector<uint64_t>{static_cast<uint64_t>(shard_id), group_id, offset_start, offset_end});
-    if (!all_in_index_) {
+    // the row index in the shard locates the row in label_arrays_
+    offsets[shard_id].emplace_back(std::vector<uint64_t>{static_cast<uint64_t>(shard_id), group_id, offset_start,
+                                                         offset_end, static_cast<uint64_t>(i)});
+    if (!all_in_index_ && !label_values.empty()) {
+      // decoded from the label pages
+      column_values[shard_id].emplace_back(std::move(label_values[i]));
+    } else if (!all_in_index_) {
       int raw_page_id = std::stoi(labels[i][3]);
       uint64_t label_start = std::stoull(labels[i][4]) + kInt64Len;
       uint64_t label_end = std::stoull(labels[i][5]);
@@ -390,7 +414,80 @@ MSRStatus ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql,
     }
   }
   sqlite3_free(errmsg);
-  return ConvertLabelToJson(labels, fs, offsets, shard_id, columns, column_values);
+
+  // Read the label pages at once instead of the raw data of each row, if they hold all columns
+  std::vector<json> label_values;
+  if (!all_in_index_ && ReadLabelPages(shard_id, columns, labels.size(), fs, &label_values) == FAILED) {
+    label_values.clear();
+  }
+  return ConvertLabelToJson(labels, fs, offsets, shard_id, columns, column_values, label_values);
+}
+
+MSRStatus ShardReader::ReadLabelPages(int shard_id, const std::vector<std::string> &columns, uint64_t num_rows,
+                                      std::shared_ptr<std::fstream> fs, std::vector<json> *label_values) {
+  if (label_columns_->Empty() || num_rows == 0) {
+    return FAILED;
+  }
+  if (columns.empty() && !label_columns_->IsAllRawFields()) {
+    return FAILED;
+  }
+  auto blob_fields = GetBlobFields().second;
+  for (const auto &col : columns) {
+    if (!label_columns_->HasColumn(col) && std::find(blob_fields.begin(), blob_fields.end(), col) == blob_fields.end()) {
+      return FAILED;
+    }
+  }
+
+  // Typed arrays only when no blob column is selected, the rows need no json then
+  bool typed = typed_labels_ && !columns.empty() &&
+               std::all_of(columns.begin(), columns.end(),
+                           [this](const std::string &col) { return label_columns_->HasColumn(col); });
+
+  // Label pages hold rows [0, num_rows) in order, unless rows were appended without label pages
+  std::unordered_map<std::string, std::vector<uint8_t>> arrays;
+  uint64_t next_row = 0;
+  auto last_page_id = shard_header_->GetLastPageId(shard_id);
+  for (int64_t page_id = 0; page_id <= last_page_id; ++page_id) {
+    auto page = shard_header_->GetPage(shard_id, page_id).first;
+    if (page == nullptr || page->GetPageType() != kPageTypeLabel) continue;
+    if (page->GetStartRowID() != next_row || page->GetEndRowID() < next_row) {
+      MS_LOG(WARNING) << "Label pages of shard " << shard_id << " are not in order, read the raw pages instead.";
+      return FAILED;
+    }
+    auto page_data = std::vector<uint8_t>(page->GetPageSize());
+    auto &io_seekg = fs->seekg(page_size_ * page_id + header_size_, std::ios::beg);
+    if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+      MS_LOG(ERROR) << "File seekg failed";
+      return FAILED;
+    }
+    auto &io_read = fs->read(reinterpret_cast<char *>(page_data.data()), page_data.size());
+    if (!io_read.good() || io_read.fail() || io_read.bad()) {
+      MS_LOG(ERROR) << "File read failed";
+      return FAILED;
+    }
+    auto page_rows = page->GetEndRowID() - next_row;
+    if (typed) {
+      for (const auto &col : columns) {
+        if (label_columns_->DecodeColumn(page_data.data(), page_data.size(), page_rows, col, &arrays[col]) == FAILED) {
+          return FAILED;
+        }
+      }
+    } else if (label_columns_->DecodePage(page_data.data(), page_data.size(), page_rows, columns, label_values) ==
+               FAILED) {
+      return FAILED;
+    }
+    next_row = page->GetEndRowID();
+  }
+  if (next_row != num_rows) {
+    MS_LOG(DEBUG) << "Label pages of shard " << shard_id << " hold " << next_row << " rows of " << num_rows << ".";
+    return FAILED;
+  }
+  if (typed) {
+    // the rows carry no json, their labels are read by GetLabelsById
+    label_values->assign(num_rows, json::object());
+    label_arrays_[shard_id] = std::move(arrays);
+  }
+  return SUCCESS;
 }
 
 MSRStatus ShardReader::GetAllClasses(const std::string &category_field, std::set<std::string> &categories) {
@@ -459,6 +556,7 @@ ROW_GROUPS ShardReader::ReadAllRowGroup(std::vector<std::string> &columns) {
 
   std::string sql = "SELECT " + fields + " FROM INDEXES ORDER BY ROW_ID ;";
 
+  label_arrays_.assign(shard_count_, {});
   std::vector<std::thread> thread_read_db = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
     thread_read_db[x] =
@@ -1044,7 +1142,8 @@ MSRStatus ShardReader::CreateTasksByRow(const std::vector<std::tuple<int, int, i
     for (int shard_id = 0; shard_id < shard_count_; shard_id++) {
       for (uint32_t i = 0; i < offsets[shard_id].size(); i += 1) {
         tasks_.InsertTask(TaskType::kCommonTask, offsets[shard_id][i][0], offsets[shard_id][i][1],
-                          std::vector<uint64_t>{offsets[shard_id][i][2], offsets[shard_id][i][3]},
+                          std::vector<uint64_t>{offsets[shard_id][i][2], offsets[shard_id][i][3],
+                                                offsets[shard_id][i][4]},
                           local_columns[shard_id][i]);
       }
     }
@@ -1119,11 +1218,23 @@ TASK_RETURN_CONTENT ShardReader::ConsumerOneTask(int task_id, uint32_t consumer_
                           std::make_pair(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>()));
   }
   const std::shared_ptr<Page> &page = ret.second;
+  auto file_offset = header_size_ + page_size_ * (page->GetPageID()) + addr[0];
+
+  if (!mapped_files_.empty()) {
+    PrefetchTask(task_id + kNumPrefetchTasks);
+    const uint8_t *blob = mapped_files_[shard_id]->Slice(file_offset, addr[1] - addr[0]);
+    if (blob == nullptr) {
+      MS_LOG(ERROR) << "Invalid data, the blob of the row is beyond the end of the file.";
+      return std::make_pair(
+        FAILED, std::make_pair(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>()));
+    }
+    std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
+    batch.emplace_back(std::vector<uint8_t>(blob, blob + (addr[1] - addr[0])), std::move(std::get<3>(task)));
+    return std::make_pair(SUCCESS, std::make_pair(TaskType::kCommonTask, std::move(batch)));
+  }
 
   // Pack image list
   std::vector<uint8_t> images(addr[1] - addr[0]);
-  auto file_offset = header_size_ + page_size_ * (page->GetPageID()) + addr[0];
-
   auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
   if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
     MS_LOG(ERROR) << "File seekg failed";
@@ -1148,6 +1259,25 @@ TASK_RETURN_CONTENT ShardReader::ConsumerOneTask(int task_id, uint32_t consumer_
   return std::make_pair(SUCCESS, std::make_pair(TaskType::kCommonTask, std::move(batch)));
 }
 
+void ShardReader::PrefetchTask(int task_id) {
+  if (task_id >= static_cast<int>(tasks_.Size())) {
+    return;
+  }
+  auto &task = tasks_.GetTaskByID(tasks_.permutation_[task_id]);
+  if (std::get<0>(task) == TaskType::kPaddedTask) {
+    return;
+  }
+  auto shard_id = std::get<0>(std::get<1>(task));
+  auto group_id = std::get<1>(std::get<1>(task));
+  const auto &addr = std::get<2>(task);
+  const auto &ret = shard_header_->GetPageByGroupId(group_id, shard_id);
+  if (SUCCESS != ret.first) {
+    return;
+  }
+  mapped_files_[shard_id]->Prefetch(header_size_ + page_size_ * (ret.second->GetPageID()) + addr[0],
+                                    addr[1] - addr[0]);
+}
+
 MSRStatus ShardReader::ConsumerByRow(int consumer_id) {
   // Set thread name
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -1221,6 +1351,30 @@ std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>> ShardRe
   return std::move(ret.second);
 }
 
+MSRStatus ShardReader::GetLabelsById(int64_t task_id, const std::vector<std::string> &columns,
+                                     std::vector<std::pair<const uint8_t *, uint64_t>> *values) {
+  if (task_id < 0 || task_id >= static_cast<int64_t>(tasks_.Size())) {
+    return FAILED;
+  }
+  const auto &task = tasks_.GetTaskByID(tasks_.permutation_[task_id]);
+  const auto &addr = std::get<2>(task);
+  if (std::get<0>(task) != TaskType::kCommonTask || addr.size() <= 2) {
+    return FAILED;
+  }
+  auto shard_id = std::get<0>(std::get<1>(task));
+  const auto &arrays = label_arrays_[shard_id];
+  values->clear();
+  for (const auto &col : columns) {
+    auto it = arrays.find(col);
+    auto value_size = label_columns_->GetValueSize(col);
+    if (it == arrays.end() || value_size == 0 || (addr[2] + 1) * value_size > it->second.size()) {
+      return FAILED;
+    }
+    values->emplace_back(it->second.data() + addr[2] * value_size, value_size);
+  }
+  return SUCCESS;
+}
+
 std::pair<MSRStatus, std::vector<std::vector<uint8_t>>> ShardReader::UnCompressBlob(
   const std::vector<uint8_t> &raw_blob_data) {
   auto loaded_columns = selected_columns_.size() == 0 ? shard_column_->GetColumnName() : selected_columns_;
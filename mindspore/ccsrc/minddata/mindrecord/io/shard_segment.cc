@@ -212,9 +212,18 @@ std::pair<MSRStatus, std::vector<uint8_t>> ShardSegment::PackImages(int group_id
   }
   const std::shared_ptr<Page> &blob_page = ret.second;
 
+  auto file_offset = header_size_ + page_size_ * (blob_page->GetPageID()) + offset[0];
+  if (!mapped_files_.empty()) {
+    const uint8_t *blob = mapped_files_[shard_id]->Slice(file_offset, offset[1] - offset[0]);
+    if (blob == nullptr) {
+      MS_LOG(ERROR) << "Invalid data, the blob of the row is beyond the end of the file.";
+      return {FAILED, {}};
+    }
+    return {SUCCESS, std::vector<uint8_t>(blob, blob + (offset[1] - offset[0]))};
+  }
+
   // Pack image list
   std::vector<uint8_t> images(offset[1] - offset[0]);
-  auto file_offset = header_size_ + page_size_ * (blob_page->GetPageID()) + offset[0];
   auto &io_seekg = file_streams_random_[0][shard_id]->seekg(file_offset, std::ios::beg);
   if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
     MS_LOG(ERROR) << "File seekg failed";
@@ -24,6 +24,7 @@ using mindspore::ExceptionType::NoExceptionType;
 using mindspore::MsLogLevel::DEBUG;
 using mindspore::MsLogLevel::ERROR;
 using mindspore::MsLogLevel::INFO;
+using mindspore::MsLogLevel::WARNING;
 
 namespace mindspore {
 namespace mindrecord {
@@ -220,6 +221,11 @@ MSRStatus ShardWriter::Commit() {
     }
   }
 
+  if (WriteLabelPages() == FAILED) {
+    MS_LOG(ERROR) << "Write label pages failed";
+    return FAILED;
+  }
+
   if (WriteShardHeader() == FAILED) {
     MS_LOG(ERROR) << "Write metadata failed";
     return FAILED;
@@ -272,6 +278,13 @@ MSRStatus ShardWriter::SetShardHeader(std::shared_ptr<ShardHeader> header_data)
   shard_header_->SetHeaderSize(header_size_);
   shard_header_->SetPageSize(page_size_);
   shard_column_ = std::make_shared<ShardColumn>(shard_header_);
+
+  // label pages are written for new files only, appended rows are read from the raw pages
+  label_columns_ = std::make_shared<ShardLabelColumns>(shard_header_->GetSchemas());
+  if (label_columns_->Empty()) {
+    label_columns_ = nullptr;
+  }
+  label_rows_ = std::vector<std::vector<uint8_t>>(shard_count_);
   return SUCCESS;
 }
 
@@ -699,6 +712,15 @@ MSRStatus ShardWriter::WriteRawData(std::map<uint64_t, std::vector<json>> &raw_d
     return SUCCESS;
   }
 
+  // The pages of parallel writers are only merged in the header, so their rows are read from the raw pages
+  if (parallel_writer) {
+    label_columns_ = nullptr;
+  }
+  if (label_columns_ != nullptr && SetLabelData(raw_data) == FAILED) {
+    MS_LOG(WARNING) << "Label pages are not written, labels will be read from the raw pages.";
+    label_columns_ = nullptr;
+  }
+
   std::vector<std::vector<uint8_t>> bin_raw_data(row_count * schema_count);
 
   // Serialize raw data
@@ -863,6 +885,11 @@ MSRStatus ShardWriter::WriteByShard(int shard_id, int start_row, int end_row,
     return FAILED;
   }
 
+  if (label_columns_ != nullptr) {
+    auto row_width = label_columns_->GetRowWidth();
+    label_rows_[shard_id].insert(label_rows_[shard_id].end(), label_data_.begin() + start_row * row_width,
+                                 label_data_.begin() + end_row * row_width);
+  }
   return SUCCESS;
 }
 
@@ -1120,6 +1147,59 @@ MSRStatus ShardWriter::FlushBlobChunk(const std::shared_ptr<std::fstream> &out,
   return SUCCESS;
 }
 
+MSRStatus ShardWriter::SetLabelData(const std::map<uint64_t, std::vector<json>> &raw_data) {
+  label_data_.clear();
+  const auto &rows = raw_data.begin()->second;
+  label_data_.reserve(rows.size() * label_columns_->GetRowWidth());
+  for (const auto &row : rows) {
+    if (label_columns_->AppendRow(row, &label_data_) == FAILED) {
+      return FAILED;
+    }
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardWriter::WriteLabelPages() {
+  if (label_columns_ == nullptr) {
+    return SUCCESS;
+  }
+  auto row_width = label_columns_->GetRowWidth();
+  uint64_t rows_per_page = page_size_ / row_width;
+  for (int shard_id = 0; shard_id < shard_count_; ++shard_id) {
+    const auto &rows = label_rows_[shard_id];
+    uint64_t num_rows = rows.size() / row_width;
+    auto page_id = shard_header_->GetLastPageId(shard_id);
+    int page_type_id = -1;
+    for (uint64_t start_row = 0; start_row < num_rows; start_row += rows_per_page) {
+      uint64_t end_row = std::min(num_rows, start_row + rows_per_page);
+      auto page_data = label_columns_->BuildPage(rows, start_row, end_row);
+
+      // Write disk
+      auto &io_seekp = file_streams_[shard_id]->seekp(page_size_ * ++page_id + header_size_, std::ios::beg);
+      if (!io_seekp.good() || io_seekp.fail() || io_seekp.bad()) {
+        MS_LOG(ERROR) << "File seekp failed";
+        file_streams_[shard_id]->close();
+        return FAILED;
+      }
+      auto &io_handle = file_streams_[shard_id]->write(reinterpret_cast<char *>(&page_data[0]), page_data.size());
+      if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
+        MS_LOG(ERROR) << "File write failed";
+        file_streams_[shard_id]->close();
+        return FAILED;
+      }
+
+      // Create new label page
+      auto page = Page(page_id, shard_id, kPageTypeLabel, ++page_type_id, start_row, end_row, {}, page_data.size());
+      if (shard_header_->AddPage(std::make_shared<Page>(page)) == FAILED) {
+        MS_LOG(ERROR) << "Add label page failed";
+        return FAILED;
+      }
+    }
+    MS_LOG(INFO) << "Write " << page_type_id + 1 << " label pages of " << num_rows << " rows to shard " << shard_id;
+  }
+  return SUCCESS;
+}
+
 MSRStatus ShardWriter::FlushRawChunk(const std::shared_ptr<std::fstream> &out,
                                      const std::vector<std::pair<int, int>> &rows_in_group, const int &chunk_id,
                                      const std::vector<std::vector<uint8_t>> &bin_raw_data) {
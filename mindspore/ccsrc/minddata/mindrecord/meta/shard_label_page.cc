@@ -0,0 +1,189 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_label_page.h"
+#include <algorithm>
+#include <limits>
+#include "./securec.h"
+
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::ERROR;
+using mindspore::MsLogLevel::WARNING;
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+template <typename T>
+void PutValue(T value, std::vector<uint8_t> *rows) {
+  auto bytes = reinterpret_cast<const uint8_t *>(&value);
+  rows->insert(rows->end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void GetColumn(const uint8_t *column, uint64_t num_rows, const std::string &name, std::vector<json> *values) {
+  std::vector<T> array(num_rows);
+  if (num_rows > 0) {
+    (void)memcpy_s(array.data(), num_rows * sizeof(T), column, num_rows * sizeof(T));
+  }
+  auto row = values->end() - num_rows;
+  for (uint64_t i = 0; i < num_rows; ++i, ++row) {
+    (*row)[name] = array[i];
+  }
+}
+}  // namespace
+
+ShardLabelColumns::ShardLabelColumns(const std::vector<std::shared_ptr<Schema>> &schemas) {
+  if (schemas.size() != 1) {
+    return;
+  }
+  auto blob_fields = schemas[0]->GetBlobFields();
+  json schema = schemas[0]->GetSchema()["schema"];
+  all_raw_fields_ = true;
+  for (const auto &el : schema.items()) {
+    const json &field = el.value();
+    if (field.find("shape") == field.end() && field["type"] == "int32") {
+      types_.push_back(kLabelInt32);
+      widths_.push_back(sizeof(int32_t));
+    } else if (field.find("shape") == field.end() && field["type"] == "int64") {
+      types_.push_back(kLabelInt64);
+      widths_.push_back(sizeof(int64_t));
+    } else if (field.find("shape") == field.end() && field["type"] == "float32") {
+      types_.push_back(kLabelFloat32);
+      widths_.push_back(sizeof(double));
+    } else if (field.find("shape") == field.end() && field["type"] == "float64") {
+      types_.push_back(kLabelFloat64);
+      widths_.push_back(sizeof(double));
+    } else {
+      if (std::find(blob_fields.begin(), blob_fields.end(), el.key()) == blob_fields.end()) {
+        all_raw_fields_ = false;
+      }
+      continue;
+    }
+    names_.push_back(el.key());
+    row_width_ += widths_.back();
+  }
+}
+
+bool ShardLabelColumns::HasColumn(const std::string &column_name) const {
+  return std::find(names_.begin(), names_.end(), column_name) != names_.end();
+}
+
+MSRStatus ShardLabelColumns::AppendRow(const json &row, std::vector<uint8_t> *rows) const {
+  for (size_t i = 0; i < names_.size(); ++i) {
+    auto it = row.find(names_[i]);
+    bool is_integer_column = types_[i] == kLabelInt32 || types_[i] == kLabelInt64;
+    if (it == row.end() || !it->is_number() || (is_integer_column && !it->is_number_integer())) {
+      MS_LOG(WARNING) << "Column " << names_[i] << " is missing or is not a number of its type.";
+      return FAILED;
+    }
+    if (types_[i] == kLabelInt32) {
+      auto value = it->get<int64_t>();
+      if (value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max()) {
+        MS_LOG(WARNING) << "Column " << names_[i] << " is out of the range of int32: " << value;
+        return FAILED;
+      }
+      PutValue(static_cast<int32_t>(value), rows);
+    } else if (types_[i] == kLabelInt64) {
+      PutValue(it->get<int64_t>(), rows);
+    } else {
+      PutValue(it->get<double>(), rows);
+    }
+  }
+  return SUCCESS;
+}
+
+std::vector<uint8_t> ShardLabelColumns::BuildPage(const std::vector<uint8_t> &rows, uint64_t start_row,
+                                                  uint64_t end_row) const {
+  std::vector<uint8_t> page(row_width_ * (end_row - start_row));
+  auto dst = page.begin();
+  uint64_t column_offset = 0;
+  for (size_t i = 0; i < names_.size(); ++i) {
+    for (uint64_t row = start_row; row < end_row; ++row) {
+      auto src = rows.begin() + row * row_width_ + column_offset;
+      dst = std::copy(src, src + widths_[i], dst);
+    }
+    column_offset += widths_[i];
+  }
+  return page;
+}
+
+MSRStatus ShardLabelColumns::DecodePage(const uint8_t *page, uint64_t page_size, uint64_t num_rows,
+                                        const std::vector<std::string> &columns, std::vector<json> *values) const {
+  if (page_size < row_width_ * num_rows) {
+    MS_LOG(ERROR) << "Label page of " << num_rows << " rows is too small: " << page_size;
+    return FAILED;
+  }
+  values->resize(values->size() + num_rows, json::object());
+  const uint8_t *column = page;
+  for (size_t i = 0; i < names_.size(); ++i) {
+    if (columns.empty() || std::find(columns.begin(), columns.end(), names_[i]) != columns.end()) {
+      if (types_[i] == kLabelInt32) {
+        GetColumn<int32_t>(column, num_rows, names_[i], values);
+      } else if (types_[i] == kLabelInt64) {
+        GetColumn<int64_t>(column, num_rows, names_[i], values);
+      } else {
+        GetColumn<double>(column, num_rows, names_[i], values);
+      }
+    }
+    column += widths_[i] * num_rows;
+  }
+  return SUCCESS;
+}
+
+uint64_t ShardLabelColumns::GetValueSize(const std::string &column_name) const {
+  auto it = std::find(names_.begin(), names_.end(), column_name);
+  if (it == names_.end()) {
+    return 0;
+  }
+  auto type = types_[it - names_.begin()];
+  return type == kLabelInt32 || type == kLabelFloat32 ? 4 : 8;
+}
+
+MSRStatus ShardLabelColumns::DecodeColumn(const uint8_t *page, uint64_t page_size, uint64_t num_rows,
+                                          const std::string &column_name, std::vector<uint8_t> *array) const {
+  if (page_size < row_width_ * num_rows) {
+    MS_LOG(ERROR) << "Label page of " << num_rows << " rows is too small: " << page_size;
+    return FAILED;
+  }
+  const uint8_t *column = page;
+  for (size_t i = 0; i < names_.size(); ++i) {
+    if (names_[i] != column_name) {
+      column += widths_[i] * num_rows;
+      continue;
+    }
+    if (types_[i] != kLabelFloat32) {
+      // stored as the type of the schema, the whole column is one copy
+      array->insert(array->end(), column, column + widths_[i] * num_rows);
+      return SUCCESS;
+    }
+    std::vector<double> values(num_rows);
+    if (num_rows > 0) {
+      (void)memcpy_s(values.data(), num_rows * sizeof(double), column, num_rows * sizeof(double));
+    }
+    auto begin = array->size();
+    array->resize(begin + num_rows * sizeof(float));
+    auto dst = reinterpret_cast<float *>(array->data() + begin);
+    for (uint64_t row = 0; row < num_rows; ++row) {
+      dst[row] = static_cast<float>(values[row]);
+    }
+    return SUCCESS;
+  }
+  MS_LOG(ERROR) << "Column " << column_name << " is not stored in label pages.";
+  return FAILED;
+}
+}  // namespace mindrecord
+}  // namespace mindspore
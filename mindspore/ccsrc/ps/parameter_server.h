@@ -43,6 +43,7 @@
 #include "ps/ps_context.h"
 #include "runtime/device/cpu/kernel_select_cpu.h"
 #include "utils/ms_context.h"
+#include "common/thread_pool.h"
 #include "backend/kernel_compiler/kernel.h"
 #include "backend/kernel_compiler/cpu/cpu_kernel_factory.h"
 #include "backend/kernel_compiler/cpu/ps/pserver_kernel.h"
@@ -131,6 +132,7 @@ class ParameterServer {
   void ResetGradAccumCount();
   const CNodePtr GetCNode(const std::string &name) const;
   std::mutex &mutex();
+  std::shared_ptr<std::mutex> KeyMutex(const Key &key);
   void GetEmbeddingTableParamPtr();
   void SyncEmbeddingTables();
 
@@ -158,7 +160,11 @@ class ParameterServer {
   std::unordered_map<Key, std::shared_ptr<PServerKernel>> embedding_lookup_ops_;
   std::unordered_map<Key, uint64_t> tokens_;
 
+  // mutex_ guards the maps above and grad_accum_count_. The training state of one key (weight data, token,
+  // accumulated gradients and optimizer info) is guarded by its own mutex in key_mutexes_, so pushes, pulls and
+  // optimizer updates of different keys do not block each other. Lock order is mutex_ before a key mutex.
   std::mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<std::mutex>> key_mutexes_;
   std::condition_variable apply_grads_cv_;
 
   std::unique_ptr<std::thread> thread_;
@@ -517,6 +523,17 @@ void ParameterServer<T>::Finalize() {
 
 template <typename T>
 void ParameterServer<T>::UpdateWeights() {
+  struct UpdateTask {
+    Key key;
+    std::shared_ptr<std::mutex> key_mutex;
+    std::shared_ptr<PServerKernel> optimizer;
+    std::shared_ptr<OptimizerInfo> optim_info;
+    InputsShapePtr original_inputs_shape;
+    uint64_t *token;
+    size_t *grads_accum_counter;
+    bool is_embedding;
+  };
+  std::vector<UpdateTask> update_tasks;
   while (true) {
     std::unique_lock<std::mutex> lock(mutex_);
     apply_grads_cv_.wait(lock, [this] { return this->ReadyForUpdateWeights() || !running_; });
@@ -524,77 +541,114 @@ void ParameterServer<T>::UpdateWeights() {
       break;
     }
 
+    // Collect what every key needs while holding mutex_, the keys are then updated without it.
+    update_tasks.clear();
     for (auto iter = weights_.begin(); iter != weights_.end(); iter++) {
       Key key = iter->first;
-      WeightPtr weight_ptr = iter->second;
-
       std::shared_ptr<PServerKernel> optimizer = nullptr;
       if (weight_key_to_optims_.count(key) > 0) {
         optimizer = optimizers_[key];
       }
       MS_EXCEPTION_IF_NULL(optimizer);
-
-      std::shared_ptr<OptimizerInfo> optim_info = optim_infos_[key];
-      if (optim_info != nullptr) {
-        const std::vector<kernel::AddressPtr> &inputs = optim_info->inputs();
-        const std::vector<kernel::AddressPtr> &workspaces = optim_info->workspaces();
-        const std::vector<kernel::AddressPtr> &outputs = optim_info->outputs();
-
-        std::vector<std::vector<size_t>> shapes = {};
-        std::vector<size_t> indices_shape = {};
-        indices_shape.emplace_back(optim_info->indice_size());
-        shapes.push_back(indices_shape);
-
-        if (original_optim_inputs_shape_.count(key) != 0) {
-          for (auto input_shapes : *(original_optim_inputs_shape_[key])) {
-            shapes.push_back(*input_shapes);
+      InputsShapePtr original_inputs_shape = nullptr;
+      if (original_optim_inputs_shape_.count(key) != 0) {
+        original_inputs_shape = original_optim_inputs_shape_[key];
+      }
+      update_tasks.push_back({key, KeyMutex(key), optimizer, optim_infos_[key], original_inputs_shape, &tokens_[key],
+                              &grads_accum_counter_[key], is_embedding_[key]});
+    }
+    lock.unlock();
+
+    // Keys are updated in parallel, a key can be pulled as soon as its own update is done.
+    auto update_keys = [this, &update_tasks](size_t start, size_t end) {
+      for (size_t i = start; i < end; i++) {
+        auto &task = update_tasks[i];
+        std::lock_guard<std::mutex> key_lock(*task.key_mutex);
+        auto &optim_info = task.optim_info;
+        if (optim_info != nullptr) {
+          const std::vector<kernel::AddressPtr> &inputs = optim_info->inputs();
+          const std::vector<kernel::AddressPtr> &workspaces = optim_info->workspaces();
+          const std::vector<kernel::AddressPtr> &outputs = optim_info->outputs();
+
+          std::vector<std::vector<size_t>> shapes = {};
+          std::vector<size_t> indices_shape = {};
+          indices_shape.emplace_back(optim_info->indice_size());
+          shapes.push_back(indices_shape);
+
+          if (task.original_inputs_shape != nullptr) {
+            for (auto input_shapes : *(task.original_inputs_shape)) {
+              shapes.push_back(*input_shapes);
+            }
           }
+          task.optimizer->ReInit(shapes);
+          optim_info->ComputeMean(shapes, worker_num_, pserver_num_, rank_id_);
+          task.optimizer->Execute(inputs, workspaces, outputs);
+          optim_info->Reset();
+        }
+        *task.grads_accum_counter = 0;
+        if (!task.is_embedding) {
+          *task.token = worker_num_;
         }
-        optimizer->ReInit(shapes);
-        optim_info->ComputeMean(shapes, worker_num_, pserver_num_, rank_id_);
-        optimizer->Execute(inputs, workspaces, outputs);
-        optim_info->Reset();
-      }
-      if (!is_embedding_[key]) {
-        tokens_[key] = worker_num_;
       }
-    }
+    };
+    common::ThreadPool::GetInstance().ParallelFor(0, update_tasks.size(), 1, update_keys);
+
+    lock.lock();
     ResetGradAccumCount();
   }
 }
 
 template <typename T>
 void ParameterServer<T>::AccumGrad(const Keys &keys, const Values &values, const Lengths &lengths) {
-  std::unique_lock<std::mutex> lock(mutex_);
   const Key &key = keys[0];
+  std::unique_lock<std::mutex> lock(mutex_);
+  // Element references of an unordered_map stay valid when other keys are inserted.
+  std::shared_ptr<OptimizerInfo> &optim_info = optim_infos_[key];
+  size_t &grads_accum_counter = grads_accum_counter_[key];
+  std::shared_ptr<std::mutex> key_mutex = KeyMutex(key);
+  std::string optim_name;
+  std::shared_ptr<OptimizerInfoBuilder> builder = nullptr;
+  std::shared_ptr<kernel::ps::PServerKernel> pserver_kernel = nullptr;
+  WeightPtr weight_ptr = nullptr;
+  InputsShapePtr inputs_shape = nullptr;
   bool no_sparse_grad = values.size() == 1 && values[0] == -100;
   if (!no_sparse_grad) {
-    std::shared_ptr<OptimizerInfo> optim_info = optim_infos_[key];
-
-    // Create or update the optimizer info
-    if (optim_info == nullptr) {
-      const std::shared_ptr<OptimizerInfoBuilder> &builder = optim_info_builders_[weight_key_to_optims_[key]];
-      std::shared_ptr<kernel::ps::PServerKernel> pserver_kernel = optimizers_[key];
-      if (pserver_kernel == nullptr) {
-        MS_LOG(EXCEPTION) << "no optimizer found for key " << key << " optim name " << weight_key_to_optims_[key];
+    optim_name = weight_key_to_optims_[key];
+    builder = optim_info_builders_[optim_name];
+    pserver_kernel = optimizers_[key];
+    weight_ptr = weights_[key];
+    inputs_shape = optim_inputs_shape_[key];
+  }
+  lock.unlock();
+
+  bool key_accumulated = false;
+  {
+    std::lock_guard<std::mutex> key_lock(*key_mutex);
+    if (!no_sparse_grad) {
+      // Create or update the optimizer info
+      if (optim_info == nullptr) {
+        if (pserver_kernel == nullptr) {
+          MS_LOG(EXCEPTION) << "no optimizer found for key " << key << " optim name " << optim_name;
+        }
+        MS_EXCEPTION_IF_NULL(builder);
+        OptimizerInfo *optim =
+          builder->Build(pserver_kernel, weight_ptr, keys, values, lengths, inputs_shape, worker_num_);
+        optim_info.reset(optim);
+      } else {
+        optim_info->Update(values, lengths);
+        optim_info->Accumulate(values, lengths);
       }
-      MS_EXCEPTION_IF_NULL(pserver_kernel);
-      OptimizerInfo *optim =
-        builder->Build(pserver_kernel, weights_[key], keys, values, lengths, optim_inputs_shape_[key], worker_num_);
-      optim_info.reset(optim);
-      optim_infos_[key] = optim_info;
-    } else {
-      optim_info->Update(values, lengths);
-      optim_info->Accumulate(values, lengths);
     }
+    grads_accum_counter += 1;
+    key_accumulated = grads_accum_counter == worker_num_;
   }
 
-  grads_accum_counter_[key] += 1;
-  if (grads_accum_counter_[key] == worker_num_) {
+  if (key_accumulated) {
+    lock.lock();
     grad_accum_count_++;
-  }
-  if (ReadyForUpdateWeights()) {
-    apply_grads_cv_.notify_one();
+    if (ReadyForUpdateWeights()) {
+      apply_grads_cv_.notify_one();
+    }
   }
 }
 
@@ -606,10 +660,15 @@ WeightPtr ParameterServer<T>::weight(const Key &key) {
   }
   WeightPtr weight_ptr = weights_[key];
   MS_EXCEPTION_IF_NULL(weight_ptr);
+  uint64_t &token = tokens_[key];
+  std::shared_ptr<std::mutex> key_mutex = KeyMutex(key);
+  lock.unlock();
+
+  std::lock_guard<std::mutex> key_lock(*key_mutex);
   WeightPtr copy_weight_ptr = std::make_shared<::ps::SArray<T>>(weight_ptr->size(), 0);
   MS_EXCEPTION_IF_NULL(copy_weight_ptr);
   copy_weight_ptr->CopyFrom(weight_ptr->data(), weight_ptr->size());
-  tokens_[key] -= 1;
+  token -= 1;
   return copy_weight_ptr;
 }
 
@@ -629,6 +688,9 @@ void ParameterServer<T>::DoEmbeddingLookup(Key key, const LookupIds &lookup_ids,
   MS_EXCEPTION_IF_NULL(table_ptr);
   std::shared_ptr<PServerKernel> table_lookup_op = embedding_lookup_ops_[key];
   MS_EXCEPTION_IF_NULL(table_lookup_op);
+  std::shared_ptr<std::mutex> key_mutex = KeyMutex(key);
+  lock.unlock();
+  std::lock_guard<std::mutex> key_lock(*key_mutex);
 
   // Update shapes of lookup operator
   std::vector<std::vector<size_t>> shapes = {};
@@ -684,7 +746,14 @@ inline bool ParameterServer<T>::ReadyForPush(const Key &key) {
     MS_LOG(EXCEPTION) << "The weights in server is empty. Many reasons could cause this: 1.The Worker didn't send "
                          "kInitWeightsCmd command. 2.The Server failed to initialize weights.";
   }
-  return grad_accum_count_ < weights_.size() && tokens_[key] <= 0;
+  if (grad_accum_count_ >= weights_.size()) {
+    return false;
+  }
+  uint64_t &token = tokens_[key];
+  std::shared_ptr<std::mutex> key_mutex = KeyMutex(key);
+  lock.unlock();
+  std::lock_guard<std::mutex> key_lock(*key_mutex);
+  return token <= 0;
 }
 
 template <typename T>
@@ -693,15 +762,17 @@ inline bool ParameterServer<T>::ReadyForPull(const Key &key) {
   if (tokens_.count(key) == 0 || weights_[key] == 0) {
     MS_LOG(EXCEPTION) << "Invalid weight key " << key;
   }
-  return tokens_[key] > 0;
+  uint64_t &token = tokens_[key];
+  std::shared_ptr<std::mutex> key_mutex = KeyMutex(key);
+  lock.unlock();
+  std::lock_guard<std::mutex> key_lock(*key_mutex);
+  return token > 0;
 }
 
 template <typename T>
 inline void ParameterServer<T>::ResetGradAccumCount() {
+  // The counter of every key is reset by its own update task in UpdateWeights.
   grad_accum_count_ = 0;
-  for (auto iter = grads_accum_counter_.begin(); iter != grads_accum_counter_.end(); iter++) {
-    grads_accum_counter_[iter->first] = 0;
-  }
 }
 
 template <typename T>
@@ -709,6 +780,16 @@ inline std::mutex &ParameterServer<T>::mutex() {
   return mutex_;
 }
 
+template <typename T>
+std::shared_ptr<std::mutex> ParameterServer<T>::KeyMutex(const Key &key) {
+  // Must be called with mutex_ held.
+  auto &key_mutex = key_mutexes_[key];
+  if (key_mutex == nullptr) {
+    key_mutex = std::make_shared<std::mutex>();
+  }
+  return key_mutex;
+}
+
 template <typename T>
 void ParameterServer<T>::GetEmbeddingTableParamPtr() {
   MS_EXCEPTION_IF_NULL(func_graph_);
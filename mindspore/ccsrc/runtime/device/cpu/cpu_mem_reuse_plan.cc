@@ -0,0 +1,135 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "runtime/device/cpu/cpu_mem_reuse_plan.h"
+#include <algorithm>
+#include "backend/optimizer/mem_reuse/mem_offset_plan.h"
+#include "backend/session/anf_runtime_algorithm.h"
+#include "frontend/operator/ops.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+size_t CPUMemReusePlan::AssignBlockOffsets(std::vector<CPUMemBlock> *blocks) {
+  MS_EXCEPTION_IF_NULL(blocks);
+  return memreuse::AssignBestFitOffsets(blocks);
+}
+
+void CPUMemReusePlan::UseAddress(DeviceAddress *address, size_t kernel_index) {
+  MS_EXCEPTION_IF_NULL(address);
+  auto iter = block_index_.find(address);
+  if (iter == block_index_.end()) {
+    block_index_[address] = blocks_.size();
+    blocks_.push_back({address, address->size_, kernel_index, kernel_index, 0});
+    return;
+  }
+  auto &block = blocks_[iter->second];
+  block.first_use_ = std::min(block.first_use_, kernel_index);
+  block.last_use_ = std::max(block.last_use_, kernel_index);
+}
+
+void CPUMemReusePlan::CollectMemBlocks(const session::KernelGraph *graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  blocks_.clear();
+  block_index_.clear();
+  auto kernels = graph->execution_order();
+  for (size_t index = 0; index < kernels.size(); ++index) {
+    auto &kernel = kernels[index];
+    MS_EXCEPTION_IF_NULL(kernel);
+    size_t input_num = AnfAlgo::GetInputTensorNum(kernel);
+    for (size_t i = 0; i < input_num; ++i) {
+      auto kernel_with_index = AnfAlgo::GetPrevNodeOutput(kernel, i);
+      MS_EXCEPTION_IF_NULL(kernel_with_index.first);
+      if (kernel_with_index.first->isa<Parameter>()) {
+        continue;
+      }
+      auto address = AnfAlgo::GetMutableOutputAddr(kernel_with_index.first, kernel_with_index.second, true);
+      MS_EXCEPTION_IF_NULL(address);
+      if (address->ptr_ == nullptr) {
+        UseAddress(address.get(), index);
+      }
+    }
+
+    size_t output_num = AnfAlgo::GetOutputTensorNum(kernel);
+    for (size_t i = 0; i < output_num; ++i) {
+      auto address = AnfAlgo::GetMutableOutputAddr(kernel, i);
+      MS_EXCEPTION_IF_NULL(address);
+      if (address->ptr_ == nullptr) {
+        UseAddress(address.get(), index);
+      }
+    }
+
+    auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
+    MS_EXCEPTION_IF_NULL(kernel_mod);
+    for (size_t i = 0; i < kernel_mod->GetWorkspaceSizeList().size(); ++i) {
+      auto address = AnfAlgo::GetWorkspaceAddr(kernel, i);
+      MS_EXCEPTION_IF_NULL(address);
+      if (address->ptr_ == nullptr) {
+        UseAddress(address, index);
+      }
+    }
+  }
+
+  // Graph outputs and summary outputs are read after the last kernel, so they must not be reused.
+  std::vector<session::KernelWithIndex> keep_alive_outputs;
+  auto output_nodes = AnfAlgo::GetAllOutput(graph->output(), {prim::kPrimTupleGetItem});
+  for (const auto &node : output_nodes) {
+    keep_alive_outputs.emplace_back(AnfAlgo::VisitKernelWithReturnType(node, 0, true));
+  }
+  for (const auto &summary_item : graph->summary_nodes()) {
+    keep_alive_outputs.emplace_back(summary_item.second.first, IntToSize(summary_item.second.second));
+  }
+  for (const auto &output : keep_alive_outputs) {
+    MS_EXCEPTION_IF_NULL(output.first);
+    if (!output.first->isa<CNode>() || !AnfAlgo::OutputAddrExist(output.first, output.second)) {
+      continue;
+    }
+    auto address = AnfAlgo::GetMutableOutputAddr(output.first, output.second, true);
+    auto iter = block_index_.find(address.get());
+    if (iter != block_index_.end()) {
+      blocks_[iter->second].last_use_ = kernels.size();
+    }
+  }
+}
+
+size_t CPUMemReusePlan::MemPlan(const session::KernelGraph *graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  CollectMemBlocks(graph);
+  naive_mem_size_ = 0;
+  for (const auto &block : blocks_) {
+    naive_mem_size_ += block.size_;
+  }
+  planned_mem_size_ = AssignBlockOffsets(&blocks_);
+  planned_graph_ = graph;
+  MS_LOG(INFO) << "Cpu memory plan of graph " << graph->graph_id() << ": " << blocks_.size()
+               << " blocks, naive size " << naive_mem_size_ << " bytes, planned size " << planned_mem_size_
+               << " bytes.";
+  return planned_mem_size_;
+}
+
+void CPUMemReusePlan::MemAssign(const session::KernelGraph *graph, uint8_t *base_ptr) {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(base_ptr);
+  if (planned_graph_ != graph) {
+    (void)MemPlan(graph);
+  }
+  for (const auto &block : blocks_) {
+    MS_EXCEPTION_IF_NULL(block.address_);
+    block.address_->ptr_ = base_ptr + block.offset_;
+  }
+}
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
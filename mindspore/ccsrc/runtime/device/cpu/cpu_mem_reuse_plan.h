@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_CPU_CPU_MEM_REUSE_PLAN_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_CPU_CPU_MEM_REUSE_PLAN_H_
+
+#include <vector>
+#include <unordered_map>
+#include "backend/session/kernel_graph.h"
+#include "runtime/device/device_address.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+// A memory block whose lifetime is [first_use_, last_use_] in kernel execution order.
+struct CPUMemBlock {
+  DeviceAddress *address_{nullptr};
+  size_t size_{0};
+  size_t first_use_{0};
+  size_t last_use_{0};
+  size_t offset_{0};
+};
+
+// Memory plan which lets kernel outputs and workspaces share memory when their lifetimes do not overlap.
+// Graph outputs and summary outputs are kept alive until the end of the graph.
+class CPUMemReusePlan {
+ public:
+  CPUMemReusePlan() = default;
+  ~CPUMemReusePlan() = default;
+
+  size_t MemPlan(const session::KernelGraph *graph);
+  void MemAssign(const session::KernelGraph *graph, uint8_t *base_ptr);
+
+  // Place every block at an offset so that blocks with overlapping lifetimes never overlap in memory,
+  // choosing the smallest free gap for each block. Return the total size needed.
+  static size_t AssignBlockOffsets(std::vector<CPUMemBlock> *blocks);
+
+  size_t naive_mem_size() const { return naive_mem_size_; }
+  size_t planned_mem_size() const { return planned_mem_size_; }
+
+ private:
+  void CollectMemBlocks(const session::KernelGraph *graph);
+  void UseAddress(DeviceAddress *address, size_t kernel_index);
+
+  const session::KernelGraph *planned_graph_{nullptr};
+  std::vector<CPUMemBlock> blocks_;
+  std::unordered_map<DeviceAddress *, size_t> block_index_;
+  size_t naive_mem_size_{0};
+  size_t planned_mem_size_{0};
+};
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_CPU_CPU_MEM_REUSE_PLAN_H_
@@ -15,6 +15,7 @@
  */
 #include "runtime/device/cpu/cpu_resource_manager.h"
 #include "backend/session/anf_runtime_algorithm.h"
+#include "utils/ms_context.h"
 
 namespace mindspore {
 namespace device {
@@ -35,7 +36,10 @@ void CPUResourceManager::MemFree() {
 }
 
 void CPUResourceManager::AssignMemory(const session::KernelGraph *graph) {
-  size_t graph_mem_size = mem_plan_.MemPlan(graph);
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  enable_mem_reuse_ = context_ptr->get_param<bool>(MS_CTX_ENABLE_MEM_REUSE);
+  size_t graph_mem_size = enable_mem_reuse_ ? mem_reuse_plan_.MemPlan(graph) : mem_plan_.MemPlan(graph);
   if (graph_mem_size > mem_size_) {
     if (mem_size_ > 0) {
       dynamic_mem_[mem_ptr_] = mem_size_;
@@ -53,7 +57,11 @@ void CPUResourceManager::AssignMemory(const session::KernelGraph *graph) {
   if (dynamic_malloc_) {
     return;
   }
-  mem_plan_.MemAssign(graph, mem_ptr_);
+  if (enable_mem_reuse_) {
+    mem_reuse_plan_.MemAssign(graph, mem_ptr_);
+  } else {
+    mem_plan_.MemAssign(graph, mem_ptr_);
+  }
 }
 
 void *CPUResourceManager::MemMalloc(size_t mem_size) {
@@ -22,6 +22,7 @@
 #include "backend/session/session_basic.h"
 #include "runtime/device/device_address.h"
 #include "runtime/device/cpu/cpu_simple_mem_plan.h"
+#include "runtime/device/cpu/cpu_mem_reuse_plan.h"
 namespace mindspore {
 namespace device {
 namespace cpu {
@@ -41,6 +42,8 @@ class CPUResourceManager {
  private:
   void MemFree();
   CPUSimpleMemPlan mem_plan_;
+  CPUMemReusePlan mem_reuse_plan_;
+  bool enable_mem_reuse_{false};
 
   size_t mem_size_{0};
   uint8_t *mem_ptr_{nullptr};
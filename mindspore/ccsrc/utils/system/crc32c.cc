@@ -16,6 +16,14 @@
 
 #include "utils/system/crc32c.h"
 #include <stdint.h>
+#include <cstring>
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <nmmintrin.h>
+#define CRC32C_HW_X86
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CRC32C_HW_ARM
+#endif
 
 namespace mindspore {
 namespace system {
@@ -282,9 +290,8 @@ static inline void CRC32T8(uint32 *crc, const uint8 **p) {
   *p += 4;
 }
 
-// calc the crc32c value
-uint32 Crc32c::MakeCrc32c(uint32 init_crc, const char *data, size_t size) {
-  MS_EXCEPT_CHECK_NULL(data);
+// calc the crc32c value with the 8 table method
+static uint32 MakeCrc32cSoft(uint32 init_crc, const char *data, size_t size) {
   uint32_t crc = init_crc ^ 0xffffffffu;
   const unsigned int OFFSET = 8;
 
@@ -318,5 +325,60 @@ uint32 Crc32c::MakeCrc32c(uint32 init_crc, const char *data, size_t size) {
   return crc ^ 0xffffffffu;
 }
 
+#if defined(CRC32C_HW_X86)
+// calc the crc32c value with the crc32 instruction of SSE4.2, which is checked at runtime
+__attribute__((target("sse4.2"))) static uint32 MakeCrc32cHw(uint32 init_crc, const char *data, size_t size) {
+  uint64_t crc = init_crc ^ 0xffffffffu;
+  auto *bp = reinterpret_cast<const uint8_t *>(data);
+  const uint8_t *ep = bp + size;
+  while ((ep - bp) >= 8) {
+    uint64_t val = 0;
+    (void)memcpy(&val, bp, sizeof(val));
+    crc = _mm_crc32_u64(crc, val);
+    bp += 8;
+  }
+  auto crc32 = static_cast<uint32_t>(crc);
+  while (bp < ep) {
+    crc32 = _mm_crc32_u8(crc32, *bp++);
+  }
+  return crc32 ^ 0xffffffffu;
+}
+
+static bool HasHwCrc32c() {
+  static const bool has_sse42 = __builtin_cpu_supports("sse4.2");
+  return has_sse42;
+}
+#elif defined(CRC32C_HW_ARM)
+// calc the crc32c value with the crc32 instructions of armv8
+static uint32 MakeCrc32cHw(uint32 init_crc, const char *data, size_t size) {
+  uint32_t crc = init_crc ^ 0xffffffffu;
+  auto *bp = reinterpret_cast<const uint8_t *>(data);
+  const uint8_t *ep = bp + size;
+  while ((ep - bp) >= 8) {
+    uint64_t val = 0;
+    (void)memcpy(&val, bp, sizeof(val));
+    crc = __crc32cd(crc, val);
+    bp += 8;
+  }
+  while (bp < ep) {
+    crc = __crc32cb(crc, *bp++);
+  }
+  return crc ^ 0xffffffffu;
+}
+
+static bool HasHwCrc32c() { return true; }
+#endif
+
+// calc the crc32c value
+uint32 Crc32c::MakeCrc32c(uint32 init_crc, const char *data, size_t size) {
+  MS_EXCEPT_CHECK_NULL(data);
+#if defined(CRC32C_HW_X86) || defined(CRC32C_HW_ARM)
+  if (HasHwCrc32c()) {
+    return MakeCrc32cHw(init_crc, data, size);
+  }
+#endif
+  return MakeCrc32cSoft(init_crc, data, size);
+}
+
 }  // namespace system
 }  // namespace mindspore
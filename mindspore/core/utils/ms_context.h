@@ -86,6 +86,7 @@ enum MsCtxParam : unsigned {
   MS_CTX_GE_REF,
   MS_CTX_MAX_CALL_DEPTH,
   MS_CTX_TSD_REF,
+  MS_CTX_CPU_THREAD_NUM,
   MS_CTX_TYPE_UINT32_END,
 
   // paramater of type float
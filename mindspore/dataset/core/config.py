@@ -21,10 +21,14 @@ import numpy
 import mindspore._c_dataengine as cde
 
 __all__ = ['set_seed', 'get_seed', 'set_prefetch_size', 'get_prefetch_size', 'set_num_parallel_workers',
-           'get_num_parallel_workers', 'set_monitor_sampling_interval', 'get_monitor_sampling_interval', 'load']
+           'get_num_parallel_workers', 'set_monitor_sampling_interval', 'get_monitor_sampling_interval',
+           'set_enable_autotune', 'get_enable_autotune', 'set_deterministic_order',
+           'get_deterministic_order', 'set_tensor_pool_cache_size', 'get_tensor_pool_cache_size',
+           'set_zero_copy_output', 'get_zero_copy_output', 'load']
 
 INT32_MAX = 2147483647
 UINT32_MAX = 4294967295
+INT64_MAX = 9223372036854775807
 
 _config = cde.GlobalContext.config_manager()
 
@@ -197,6 +201,154 @@ def get_callback_timeout():
     return _config.get_callback_timeout()
 
 
+def set_enable_autotune(enable, cpu_budget=0):
+    """
+    Enable or disable autotune of the pipeline.
+
+    When autotune is on, the pipeline watches the queue depths of its operators while it runs. It gives more
+    workers to the map operation that holds the pipeline back, which start at the end of the current epoch of
+    that map so the row order is kept, and resizes the operator queues as soon as it decides to.
+
+    Args:
+        enable (bool): Whether to enable autotune.
+        cpu_budget (int, optional): Total number of map workers autotune may use. 0 means the number of
+            CPU cores (default=0).
+
+    Raises:
+        TypeError: If enable is not a boolean or cpu_budget is not an integer.
+        ValueError: If cpu_budget is invalid (< 0 or > MAX_INT_32).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Let the pipeline tune the map workers, using at most 16 threads.
+        >>> ds.config.set_enable_autotune(True, 16)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    if not isinstance(cpu_budget, int) or isinstance(cpu_budget, bool):
+        raise TypeError("cpu_budget must be of type int.")
+    if cpu_budget < 0 or cpu_budget > INT32_MAX:
+        raise ValueError("cpu_budget given is not within the required range.")
+    _config.set_enable_autotune(enable)
+    _config.set_autotune_cpu_budget(cpu_budget)
+
+
+def get_enable_autotune():
+    """
+    Get whether autotune of the pipeline is enabled.
+
+    Returns:
+        Bool, whether autotune is enabled.
+    """
+    return _config.get_enable_autotune()
+
+
+def set_deterministic_order(deterministic):
+    """
+    Set whether map operations keep the order of the rows.
+
+    When it is off, the operation after a map takes rows from whichever map worker has one ready, so a slow row
+    does not hold back the rows behind it. Rows of an epoch may come out in a different order on every run, but
+    epochs are not mixed. A map operation whose output is read by more than one operation keeps the order.
+
+    Args:
+        deterministic (bool): Whether to keep the order of the rows (default=True).
+
+    Raises:
+        TypeError: If deterministic is not a boolean.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Trade row order for throughput.
+        >>> ds.config.set_deterministic_order(False)
+    """
+    if not isinstance(deterministic, bool):
+        raise TypeError("deterministic must be of type bool.")
+    _config.set_deterministic_order(deterministic)
+
+
+def get_deterministic_order():
+    """
+    Get whether map operations keep the order of the rows.
+
+    Returns:
+        Bool, whether the order of the rows is kept.
+    """
+    return _config.get_deterministic_order()
+
+
+def set_tensor_pool_cache_size(size):
+    """
+    Set the number of bytes of freed tensor memory kept for reuse.
+
+    Memory of the tensors a pipeline frees is kept in a pool and handed to the next tensors of a similar size,
+    instead of being returned to the system. Memory beyond this size is returned to the system.
+
+    Args:
+        size (int): Number of bytes to keep, 0 returns all freed memory to the system (default=1GB).
+
+    Raises:
+        ValueError: If size is invalid (< 0 or > INT64_MAX).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Keep at most 256MB of freed tensor memory.
+        >>> ds.config.set_tensor_pool_cache_size(256 * 1024 * 1024)
+    """
+    if size < 0 or size > INT64_MAX:
+        raise ValueError("Tensor pool cache size given is not within the required range.")
+    _config.set_tensor_pool_cache_size(size)
+
+
+def get_tensor_pool_cache_size():
+    """
+    Get the number of bytes of freed tensor memory kept for reuse.
+
+    Returns:
+        Int, number of bytes.
+    """
+    return _config.get_tensor_pool_cache_size()
+
+
+def set_zero_copy_output(zero_copy):
+    """
+    Set whether the iterators return tensors which share memory with the pipeline output.
+
+    When it is on, a MindSpore Tensor returned by an iterator borrows the buffer of the dataset tensor instead of
+    copying it, and holds a reference to the buffer for as long as it lives. On the host this saves a copy of every
+    batch, e.g. when a CPU network is fed without dataset sink mode. The batches prefetched by the pipeline
+    (see set_prefetch_size) are not copied either. Tensors of strings are always copied.
+
+    Args:
+        zero_copy (bool): Whether to share memory with the pipeline output (default=False).
+
+    Raises:
+        TypeError: If zero_copy is not a boolean.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Feed the network with the memory of the pipeline output.
+        >>> ds.config.set_zero_copy_output(True)
+    """
+    if not isinstance(zero_copy, bool):
+        raise TypeError("zero_copy must be of type bool.")
+    _config.set_zero_copy_output(zero_copy)
+
+
+def get_zero_copy_output():
+    """
+    Get whether the iterators return tensors which share memory with the pipeline output.
+
+    Returns:
+        Bool, whether memory is shared.
+    """
+    return _config.get_zero_copy_output()
+
+
 def __str__():
     """
     String representation of the configurations.
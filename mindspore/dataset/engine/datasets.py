@@ -1150,7 +1150,7 @@ class Dataset:
         return SaveOp(self).save(file_names, file_type)
 
     @check_iterator
-    def create_tuple_iterator(self, columns=None, num_epochs=-1, output_numpy=False):
+    def create_tuple_iterator(self, columns=None, num_epochs=-1, output_numpy=False, state=None):
         """
         Create an iterator over the dataset. The data retrieved will be a list of ndarrays of data.
 
@@ -1164,6 +1164,10 @@ class Dataset:
                 (default=-1, iterator can be iterated infinite number of epochs)
             output_numpy (bool, optional): Whether or not to output NumPy datatype.
                 If output_numpy=False, iterator will output MSTensor (default=False).
+            state (str, optional): State saved by save_state() of an iterator over the same pipeline,
+                to resume right after the last row that iterator returned (default=None, start from the beginning).
+                Only chains of mappable sources with a SequentialSampler, RandomSampler or DistributedSampler
+                followed by shuffle, map with deterministic order, batch, project and rename can be resumed.
 
         Returns:
             Iterator, list of ndarrays.
@@ -1185,10 +1189,10 @@ class Dataset:
 
         if self._noop_mode():
             return DummyIterator(self, 'tuple')
-        return TupleIterator(self, columns, num_epochs, output_numpy)
+        return TupleIterator(self, columns, num_epochs, output_numpy, state)
 
     @check_iterator
-    def create_dict_iterator(self, num_epochs=-1, output_numpy=False):
+    def create_dict_iterator(self, num_epochs=-1, output_numpy=False, state=None):
         """
         Create an iterator over the dataset. The data retrieved will be a dictionary.
 
@@ -1199,6 +1203,10 @@ class Dataset:
                 (default=-1, iterator can be iterated infinite number of epochs).
             output_numpy (bool, optional): Whether or not to output NumPy datatype,
                 if output_numpy=False, iterator will output MSTensor (default=False).
+            state (str, optional): State saved by save_state() of an iterator over the same pipeline,
+                to resume right after the last row that iterator returned (default=None, start from the beginning).
+                Only chains of mappable sources with a SequentialSampler, RandomSampler or DistributedSampler
+                followed by shuffle, map with deterministic order, batch, project and rename can be resumed.
 
         Returns:
             Iterator, dictionary of column name-ndarray pair.
@@ -1220,7 +1228,7 @@ class Dataset:
 
         if self._noop_mode():
             return DummyIterator(self, 'dict')
-        return DictIterator(self, num_epochs, output_numpy)
+        return DictIterator(self, num_epochs, output_numpy, state)
 
     def __iter__(self):
         """Create an iterator over the dataset."""
@@ -2603,10 +2611,10 @@ class TransferDataset(DatasetOp):
         args["send_epoch_end"] = self._send_epoch_end
         return args
 
-    def create_dict_iterator(self, num_epochs=-1, output_numpy=False):
+    def create_dict_iterator(self, num_epochs=-1, output_numpy=False, state=None):
         raise RuntimeError("TransferDataset is not iterable.")
 
-    def create_tuple_iterator(self, columns=None, num_epochs=-1, output_numpy=False):
+    def create_tuple_iterator(self, columns=None, num_epochs=-1, output_numpy=False, state=None):
         raise RuntimeError("TransferDataset is not iterable.")
 
     def __iter__(self):
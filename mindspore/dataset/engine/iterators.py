@@ -25,6 +25,7 @@ from mindspore._c_dataengine import OpName
 
 from mindspore import log as logger
 from . import datasets as de
+from ..core.config import get_zero_copy_output
 
 
 _ITERATOR_CLEANUP = False
@@ -81,9 +82,10 @@ class Iterator:
         dataset: Dataset to be iterated over
     """
 
-    def __init__(self, dataset, num_epochs=-1, output_numpy=False):
+    def __init__(self, dataset, num_epochs=-1, output_numpy=False, state=None):
         self.num_epochs = num_epochs
         self.output_numpy = output_numpy
+        self.zero_copy = get_zero_copy_output()
         ITERATORS_LIST.append(weakref.ref(self))
         _unset_iterator_cleanup()
         # create a copy of tree and work on it.
@@ -110,6 +112,8 @@ class Iterator:
         root = self.__convert_node_postorder(self.dataset)
         self.depipeline.AssignRootNode(root)
         self.depipeline.PrepareTree(self.num_epochs)
+        if state is not None:
+            self.depipeline.RestoreState(state)
         self._index = 0
 
     def stop(self):
@@ -250,6 +254,14 @@ class Iterator:
         if hasattr(self, 'depipeline') and self.depipeline:
             del self.depipeline
 
+    def _to_tensor(self, de_tensor):
+        """Convert a dataset tensor to a MindSpore Tensor, sharing its memory in zero copy mode."""
+        array = de_tensor.as_array()
+        # The array keeps the dataset tensor alive, and the MindSpore Tensor keeps the array alive.
+        if self.zero_copy and array.dtype.kind in 'biuf' and array.flags['C_CONTIGUOUS']:
+            return Tensor.from_numpy(array)
+        return Tensor(array)
+
     @abstractmethod
     def get_next(self):
         raise RuntimeError("Calling base class Iterator's get_next is invalid.")
@@ -295,6 +307,15 @@ class Iterator:
     def get_col_names(self):
         return self.depipeline.GetColumnNames()
 
+    def save_state(self):
+        """
+        Save the state needed to resume the pipeline right after the last row this iterator returned.
+
+        Returns:
+            str, the saved state, to be passed as the state of a new iterator over the same pipeline.
+        """
+        return self.depipeline.SaveState()
+
     def __deepcopy__(self, memo):
         return self
 
@@ -321,8 +342,8 @@ class DictIterator(Iterator):
     """
     The derived class of Iterator with dict type.
     """
-    def __init__(self, dataset, num_epochs=-1, output_numpy=False):
-        super().__init__(dataset, num_epochs, output_numpy)
+    def __init__(self, dataset, num_epochs=-1, output_numpy=False, state=None):
+        super().__init__(dataset, num_epochs, output_numpy, state)
         self.depipeline.LaunchTreeExec()
 
     def check_node_type(self, node):
@@ -341,7 +362,7 @@ class DictIterator(Iterator):
 
         if self.output_numpy:
             return {k: v.as_array() for k, v in self.depipeline.GetNextAsMap().items()}
-        return {k: Tensor(v.as_array()) for k, v in self.depipeline.GetNextAsMap().items()}
+        return {k: self._to_tensor(v) for k, v in self.depipeline.GetNextAsMap().items()}
 
 
 class TupleIterator(Iterator):
@@ -351,12 +372,12 @@ class TupleIterator(Iterator):
     def check_node_type(self, node):
         pass
 
-    def __init__(self, dataset, columns=None, num_epochs=-1, output_numpy=False):
+    def __init__(self, dataset, columns=None, num_epochs=-1, output_numpy=False, state=None):
         if columns is not None:
             if not isinstance(columns, list):
                 columns = [columns]
             dataset = dataset.project(columns)
-        super().__init__(dataset, num_epochs, output_numpy)
+        super().__init__(dataset, num_epochs, output_numpy, state)
         self.depipeline.LaunchTreeExec()
 
     def __iter__(self):
@@ -372,7 +393,7 @@ class TupleIterator(Iterator):
 
         if self.output_numpy:
             return [t.as_array() for t in self.depipeline.GetNextAsList()]
-        return [Tensor(t.as_array()) for t in self.depipeline.GetNextAsList()]
+        return [self._to_tensor(t) for t in self.depipeline.GetNextAsList()]
 
 
 class DummyIterator():
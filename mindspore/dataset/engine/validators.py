@@ -284,6 +284,8 @@ def check_iterator(method):
         _, param_dict = parse_user_args(method, *args, **kwargs)
         nreq_param_bool = ['output_numpy']
         validate_dataset_param_value(nreq_param_bool, param_dict, bool)
+        nreq_param_str = ['state']
+        validate_dataset_param_value(nreq_param_str, param_dict, str)
         return method(self, *args, **kwargs)
 
     return new_method
@@ -48,6 +48,8 @@ struct Context {
   int thread_num_ = 2; /**< thread number config for thread pool */
   std::shared_ptr<Allocator> allocator = nullptr;
   CpuBindMode cpu_bind_mode_ = MID_CPU;
+  bool enable_work_stealing_ = false; /**< split kernels into more tasks than threads and let idle threads steal them */
+  int inter_op_parallel_num_ = 1; /**< kernels of independent branches run at the same time, sharing thread_num_ */
 };
 }  // namespace mindspore::lite
 #endif  // MINDSPORE_LITE_INCLUDE_CONTEXT_H_
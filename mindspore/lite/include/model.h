@@ -35,7 +35,8 @@ struct Model {
   Uint32Vector input_indices_;
   Uint32Vector output_indices_;
   NodePtrVector nodes_;
-  char *buf;
+  char *buf = nullptr;
+  size_t mmap_size_ = 0; /**< non-zero when buf maps the model file instead of being malloced */
 
   /// \brief Static method to create a Model pointer.
   ///
@@ -45,6 +46,17 @@ struct Model {
   /// \return Pointer of MindSpore Lite Model.
   static Model *Import(const char *model_buf, size_t size);
 
+  /// \brief Static method to create a Model pointer by mapping a model file into memory.
+  ///
+  /// \note The file is mapped read-only. Weights which kernels repack point into the mapping and share its pages with
+  /// the page cache and other processes, other constant tensors are still copied by each session. Free keeps the
+  /// mapping, Destroy releases it.
+  ///
+  /// \param[in] model_path Define the path of the model file.
+  ///
+  /// \return Pointer of MindSpore Lite Model.
+  static Model *ImportFromFile(const char *model_path);
+
   /// \brief Free meta graph temporary buffer
   virtual void Free();
 
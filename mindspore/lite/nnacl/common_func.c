@@ -16,6 +16,9 @@
 
 #include "nnacl/common_func.h"
 #include "nnacl/quantization/fixed_point.h"
+#ifdef ENABLE_AVX
+#include "nnacl/x86_64/matmul_avx.h"
+#endif
 
 int offset(const int *shape, const int dim0, const int dim1, const int dim2, const int dim3) {
   return ((dim0 * shape[1] + dim1) * shape[2] + dim2) * shape[3] + dim3;
@@ -73,6 +76,12 @@ void IndirectGemmFp32(float *output, const float *input, const float *weight, co
 void IndirectGemmFp32_8x8(float *output, const float *input, const float *weight, const float *bias, size_t step,
                           size_t ic4, size_t output_channel, size_t offset, size_t mode, size_t writeC4, size_t relu,
                           size_t relu6) {
+#ifdef ENABLE_AVX
+  if (!mode && X86SupportAvx2()) {
+    IndirectGemmFp32Avx2_8x8(output, input, weight, bias, step, ic4, output_channel, relu, relu6);
+    return;
+  }
+#endif
   int oc4 = UP_DIV(output_channel, C4NUM);
   if (mode && writeC4) {
     for (int i = 0; i < TILE_NUM; i++) {
@@ -15,6 +15,9 @@
  */
 
 #include "nnacl/fp32/matmul.h"
+#ifdef ENABLE_AVX
+#include "nnacl/x86_64/matmul_avx.h"
+#endif
 
 void RowMajor2Row4Major(float *src_ptr, float *dst_ptr, int row, int col) {
   for (int r = 0; r < row; r++) {
@@ -479,6 +482,14 @@ void MatMulOpt(const float *a, const float *b, float *c, const float *bias, ActT
 #elif ENABLE_ARM32
   MatmulFloatNeon32Opt(a, b, c, bias, (int)act_type, deep, row, col, stride, (int)(out_type == OutType_Nhwc),
                        (int)(out_type == OutType_TileC8));
+#elif ENABLE_AVX
+  if (X86SupportAvx512()) {
+    MatMulAvx512_12x16(a, b, c, bias, act_type, deep, row, col, stride, out_type);
+  } else if (X86SupportAvx2()) {
+    MatMulAvx2_12x8(a, b, c, bias, act_type, deep, row, col, stride, out_type);
+  } else {
+    MatMul12x8(a, b, c, bias, act_type, deep, row, col, stride, out_type);
+  }
 #else
   MatMul12x8(a, b, c, bias, act_type, deep, row, col, stride, out_type);
 #endif
@@ -0,0 +1,31 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/x86_64/matmul_avx.h"
+
+static bool support_avx2 = false;
+static bool support_avx512 = false;
+
+/* cpuid is checked once when the library is loaded, not on each kernel call */
+__attribute__((constructor)) static void X86InitCpuInfo(void) {
+  __builtin_cpu_init();
+  support_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  support_avx512 = support_avx2 && __builtin_cpu_supports("avx512f");
+}
+
+bool X86SupportAvx2(void) { return support_avx2; }
+
+bool X86SupportAvx512(void) { return support_avx512; }
@@ -0,0 +1,46 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_NNACL_X86_64_MATMUL_AVX_H_
+#define MINDSPORE_LITE_NNACL_X86_64_MATMUL_AVX_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "nnacl/op_base.h"
+#include "nnacl/matmul_parameter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* cpuid checks, the avx kernels below must only be called when they return true */
+bool X86SupportAvx2(void);
+bool X86SupportAvx512(void);
+
+/* same layouts and out types as MatMul12x8: a packed in 12 rows, b packed in 8 columns */
+void MatMulAvx2_12x8(const float *a, const float *b, float *dst, const float *bias, ActType act_type, int deep, int row,
+                     int col, size_t stride, int out_type);
+/* computes two packed 8-column blocks of b per tile */
+void MatMulAvx512_12x16(const float *a, const float *b, float *dst, const float *bias, ActType act_type, int deep,
+                        int row, int col, size_t stride, int out_type);
+
+/* mode 0 of IndirectGemmFp32_8x8: TILE_NUM output pixels by output_channel, written in nhwc */
+void IndirectGemmFp32Avx2_8x8(float *output, const float *input, const float *weight, const float *bias, size_t step,
+                              size_t ic4, size_t output_channel, size_t relu, size_t relu6);
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_LITE_NNACL_X86_64_MATMUL_AVX_H_
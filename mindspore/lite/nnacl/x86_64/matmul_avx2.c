@@ -0,0 +1,146 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <immintrin.h>
+#include "nnacl/x86_64/matmul_avx.h"
+
+#define MATMUL_AVX2_FMA(i) acc##i = _mm256_fmadd_ps(_mm256_broadcast_ss(a_value + i), b_value, acc##i)
+#define MATMUL_AVX2_STORE(i) _mm256_store_ps(tile + (i)*C8NUM, acc##i)
+#define GEMM_AVX2_FMA(i, m) acc##i = _mm256_fmadd_ps(_mm256_broadcast_ss(in + (i)*C4NUM + (m)), w##m, acc##i)
+#define GEMM_AVX2_FMA_TILE(m)     \
+  do {                            \
+    GEMM_AVX2_FMA(0, m);          \
+    GEMM_AVX2_FMA(1, m);          \
+    GEMM_AVX2_FMA(2, m);          \
+    GEMM_AVX2_FMA(3, m);          \
+    GEMM_AVX2_FMA(4, m);          \
+    GEMM_AVX2_FMA(5, m);          \
+    GEMM_AVX2_FMA(6, m);          \
+    GEMM_AVX2_FMA(7, m);          \
+  } while (0)
+
+static inline __m256i ColMaskAvx2(int valid_num) {
+  const __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm256_cmpgt_epi32(_mm256_set1_epi32(valid_num), index);
+}
+
+static inline __m256 ActivateAvx2(__m256 value, ActType act_type) {
+  if (act_type == ActType_Relu6) {
+    value = _mm256_min_ps(value, _mm256_set1_ps(6.0f));
+  }
+  if (act_type != ActType_No) {
+    value = _mm256_max_ps(value, _mm256_setzero_ps());
+  }
+  return value;
+}
+
+void MatMulAvx2_12x8(const float *a, const float *b, float *dst, const float *bias, ActType act_type, int deep, int row,
+                     int col, size_t stride, int out_type) {
+  int row_12 = UP_ROUND(row, C12NUM);
+  int row_end = out_type == OutType_C8 ? row_12 : row;
+  int col_end = out_type == OutType_C8 ? UP_ROUND(col, C8NUM) : col;
+  float tile[C12NUM * C8NUM] __attribute__((aligned(32)));
+  for (int r = 0; r < row_end; r += C12NUM) {
+    int row_num = MSMIN(C12NUM, row_end - r);
+    const float *a_block = a + (r / C12NUM) * deep * C12NUM;
+    for (int c = 0; c < col_end; c += C8NUM) {
+      int col_num = MSMIN(C8NUM, col_end - c);
+      const float *b_block = b + (c / C8NUM) * deep * C8NUM;
+      __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps(), acc2 = _mm256_setzero_ps();
+      __m256 acc3 = _mm256_setzero_ps(), acc4 = _mm256_setzero_ps(), acc5 = _mm256_setzero_ps();
+      __m256 acc6 = _mm256_setzero_ps(), acc7 = _mm256_setzero_ps(), acc8 = _mm256_setzero_ps();
+      __m256 acc9 = _mm256_setzero_ps(), acc10 = _mm256_setzero_ps(), acc11 = _mm256_setzero_ps();
+      for (int d = 0; d < deep; ++d) {
+        const float *a_value = a_block + d * C12NUM;
+        __m256 b_value = _mm256_loadu_ps(b_block + d * C8NUM);
+        MATMUL_AVX2_FMA(0);
+        MATMUL_AVX2_FMA(1);
+        MATMUL_AVX2_FMA(2);
+        MATMUL_AVX2_FMA(3);
+        MATMUL_AVX2_FMA(4);
+        MATMUL_AVX2_FMA(5);
+        MATMUL_AVX2_FMA(6);
+        MATMUL_AVX2_FMA(7);
+        MATMUL_AVX2_FMA(8);
+        MATMUL_AVX2_FMA(9);
+        MATMUL_AVX2_FMA(10);
+        MATMUL_AVX2_FMA(11);
+      }
+      MATMUL_AVX2_STORE(0);
+      MATMUL_AVX2_STORE(1);
+      MATMUL_AVX2_STORE(2);
+      MATMUL_AVX2_STORE(3);
+      MATMUL_AVX2_STORE(4);
+      MATMUL_AVX2_STORE(5);
+      MATMUL_AVX2_STORE(6);
+      MATMUL_AVX2_STORE(7);
+      MATMUL_AVX2_STORE(8);
+      MATMUL_AVX2_STORE(9);
+      MATMUL_AVX2_STORE(10);
+      MATMUL_AVX2_STORE(11);
+
+      __m256i mask = ColMaskAvx2(col_num);
+      __m256 bias_value = bias == NULL ? _mm256_setzero_ps() : _mm256_maskload_ps(bias + c, mask);
+      for (int i = 0; i < row_num; ++i) {
+        __m256 value = ActivateAvx2(_mm256_add_ps(_mm256_load_ps(tile + i * C8NUM), bias_value), act_type);
+        float *dst_ptr = NULL;
+        if (out_type == OutType_Nhwc) {
+          dst_ptr = dst + (r + i) * stride + c;
+        } else if (out_type == OutType_C8) {
+          dst_ptr = dst + c * row_12 + (r + i) * C8NUM;
+        } else {
+          dst_ptr = dst + (r + i) * col * stride + c * stride;
+        }
+        _mm256_maskstore_ps(dst_ptr, mask, value);
+      }
+    }
+  }
+}
+
+void IndirectGemmFp32Avx2_8x8(float *output, const float *input, const float *weight, const float *bias, size_t step,
+                              size_t ic4, size_t output_channel, size_t relu, size_t relu6) {
+  size_t depth = step * ic4;
+  __m256 zero = _mm256_setzero_ps();
+  __m256 six = _mm256_set1_ps(6.0f);
+  for (size_t oc = 0; oc < output_channel; oc += C8NUM) {
+    const float *weight_block = weight + oc * depth * C4NUM;
+    __m256 acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero, acc4 = zero, acc5 = zero, acc6 = zero, acc7 = zero;
+    for (size_t s = 0; s < depth; ++s) {
+      const float *in = input + s * TILE_NUM * C4NUM;
+      const float *w = weight_block + s * C4NUM * C8NUM;
+      __m256 w0 = _mm256_loadu_ps(w);
+      __m256 w1 = _mm256_loadu_ps(w + C8NUM);
+      __m256 w2 = _mm256_loadu_ps(w + 2 * C8NUM);
+      __m256 w3 = _mm256_loadu_ps(w + 3 * C8NUM);
+      GEMM_AVX2_FMA_TILE(0);
+      GEMM_AVX2_FMA_TILE(1);
+      GEMM_AVX2_FMA_TILE(2);
+      GEMM_AVX2_FMA_TILE(3);
+    }
+    __m256 acc[TILE_NUM] = {acc0, acc1, acc2, acc3, acc4, acc5, acc6, acc7};
+    __m256i mask = ColMaskAvx2((int)MSMIN(C8NUM, output_channel - oc));
+    __m256 bias_value = _mm256_maskload_ps(bias + oc, mask);
+    for (int i = 0; i < TILE_NUM; ++i) {
+      __m256 value = _mm256_add_ps(acc[i], bias_value);
+      if (relu) {
+        value = _mm256_max_ps(value, zero);
+      } else if (relu6) {
+        value = _mm256_min_ps(_mm256_max_ps(value, zero), six);
+      }
+      _mm256_maskstore_ps(output + i * output_channel + oc, mask, value);
+    }
+  }
+}
@@ -0,0 +1,113 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <immintrin.h>
+#include "nnacl/x86_64/matmul_avx.h"
+
+#define MATMUL_AVX512_FMA(i) acc##i = _mm512_fmadd_ps(_mm512_set1_ps(a_value[i]), b_value, acc##i)
+#define MATMUL_AVX512_STORE(i) _mm512_store_ps(tile + (i)*C16NUM, acc##i)
+
+static inline __m512 LoadTwoBlocksAvx512(const float *low, const float *high) {
+  __m512d value = _mm512_castps_pd(_mm512_castps256_ps512(_mm256_loadu_ps(low)));
+  return _mm512_castpd_ps(_mm512_insertf64x4(value, _mm256_castps_pd(_mm256_loadu_ps(high)), 1));
+}
+
+static inline __m256i ColMaskAvx512(int valid_num) {
+  const __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm256_cmpgt_epi32(_mm256_set1_epi32(valid_num), index);
+}
+
+void MatMulAvx512_12x16(const float *a, const float *b, float *dst, const float *bias, ActType act_type, int deep,
+                        int row, int col, size_t stride, int out_type) {
+  int row_12 = UP_ROUND(row, C12NUM);
+  int row_end = out_type == OutType_C8 ? row_12 : row;
+  int col_end = out_type == OutType_C8 ? UP_ROUND(col, C8NUM) : col;
+  float tile[C12NUM * C16NUM] __attribute__((aligned(64)));
+  __m512 zero = _mm512_setzero_ps();
+  __m512 six = _mm512_set1_ps(6.0f);
+  for (int r = 0; r < row_end; r += C12NUM) {
+    int row_num = MSMIN(C12NUM, row_end - r);
+    const float *a_block = a + (r / C12NUM) * deep * C12NUM;
+    for (int c = 0; c < col_end; c += C16NUM) {
+      int col_num = MSMIN(C16NUM, col_end - c);
+      const float *b_low = b + (c / C8NUM) * deep * C8NUM;
+      // the second block may not exist, then its lanes are computed from the first one and never stored
+      const float *b_high = col_num > C8NUM ? b_low + deep * C8NUM : b_low;
+      __m512 acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero, acc4 = zero, acc5 = zero;
+      __m512 acc6 = zero, acc7 = zero, acc8 = zero, acc9 = zero, acc10 = zero, acc11 = zero;
+      for (int d = 0; d < deep; ++d) {
+        const float *a_value = a_block + d * C12NUM;
+        __m512 b_value = LoadTwoBlocksAvx512(b_low + d * C8NUM, b_high + d * C8NUM);
+        MATMUL_AVX512_FMA(0);
+        MATMUL_AVX512_FMA(1);
+        MATMUL_AVX512_FMA(2);
+        MATMUL_AVX512_FMA(3);
+        MATMUL_AVX512_FMA(4);
+        MATMUL_AVX512_FMA(5);
+        MATMUL_AVX512_FMA(6);
+        MATMUL_AVX512_FMA(7);
+        MATMUL_AVX512_FMA(8);
+        MATMUL_AVX512_FMA(9);
+        MATMUL_AVX512_FMA(10);
+        MATMUL_AVX512_FMA(11);
+      }
+      MATMUL_AVX512_STORE(0);
+      MATMUL_AVX512_STORE(1);
+      MATMUL_AVX512_STORE(2);
+      MATMUL_AVX512_STORE(3);
+      MATMUL_AVX512_STORE(4);
+      MATMUL_AVX512_STORE(5);
+      MATMUL_AVX512_STORE(6);
+      MATMUL_AVX512_STORE(7);
+      MATMUL_AVX512_STORE(8);
+      MATMUL_AVX512_STORE(9);
+      MATMUL_AVX512_STORE(10);
+      MATMUL_AVX512_STORE(11);
+
+      __mmask16 mask = (__mmask16)((1u << col_num) - 1);
+      __m512 bias_value = bias == NULL ? zero : _mm512_maskz_loadu_ps(mask, bias + c);
+      __m256i low_mask = ColMaskAvx512(col_num);
+      __m256i high_mask = ColMaskAvx512(col_num - C8NUM);
+      for (int i = 0; i < row_num; ++i) {
+        __m512 value = _mm512_add_ps(_mm512_load_ps(tile + i * C16NUM), bias_value);
+        if (act_type == ActType_Relu6) {
+          value = _mm512_min_ps(value, six);
+        }
+        if (act_type != ActType_No) {
+          value = _mm512_max_ps(value, zero);
+        }
+        if (out_type == OutType_Nhwc) {
+          _mm512_mask_storeu_ps(dst + (r + i) * stride + c, mask, value);
+          continue;
+        }
+        float *dst_low = NULL;
+        size_t high_offset = 0;
+        if (out_type == OutType_C8) {
+          dst_low = dst + c * row_12 + (r + i) * C8NUM;
+          high_offset = C8NUM * row_12;
+        } else {
+          dst_low = dst + (r + i) * col * stride + c * stride;
+          high_offset = C8NUM * stride;
+        }
+        _mm256_maskstore_ps(dst_low, low_mask, _mm512_castps512_ps256(value));
+        if (col_num > C8NUM) {
+          __m256 high = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value), 1));
+          _mm256_maskstore_ps(dst_low + high_offset, high_mask, high);
+        }
+      }
+    }
+  }
+}
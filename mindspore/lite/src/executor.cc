@@ -37,9 +37,13 @@ int Executor::Run(std::vector<Tensor *> &in_tensors, std::vector<Tensor *> &out_
       return RET_ERROR;
     }
   }
-  kernel::LiteKernelUtil::InitTensorRefCount(kernels);
-  for (auto out_tensor : out_tensors) {  // increase RefCount of output tensors, such that Run will not free them
-    out_tensor->SetRefCount(out_tensor->RefCount() + 1);
+  // planned tensors live in the arena for the whole run, the others are never freed by Run
+  bool use_memory_plan = memory_plan_.Bind();
+  if (!use_memory_plan) {
+    kernel::LiteKernelUtil::InitTensorRefCount(kernels);
+    for (auto out_tensor : out_tensors) {  // increase RefCount of output tensors, such that Run will not free them
+      out_tensor->SetRefCount(out_tensor->RefCount() + 1);
+    }
   }
 
   for (auto *kernel : kernels) {
@@ -63,6 +67,9 @@ int Executor::Run(std::vector<Tensor *> &in_tensors, std::vector<Tensor *> &out_
         MS_LOG(ERROR) << "run kernel after_callback failed, name: " << kernel->name();
       }
     }
+    if (use_memory_plan) {
+      continue;
+    }
     for (auto input_kernel : kernel->in_kernels()) {
       MS_ASSERT(input_kernel != nullptr);
       if (input_kernel->is_model_output()) {
@@ -19,6 +19,7 @@
 
 #include <vector>
 #include "src/runtime/allocator.h"
+#include "src/runtime/static_memory_plan.h"
 #include "src/lite_kernel.h"
 #include "include/lite_session.h"
 
@@ -34,12 +35,22 @@ class Executor {
                   std::vector<kernel::LiteKernel *> &kernels, Allocator *allocator = nullptr,
                   const session::KernelCallBack &before = nullptr, const session::KernelCallBack &after = nullptr);
 
+  // lay out the intermediate tensors of kernels in one arena, so that Run binds them instead of allocating
+  virtual int PlanMemory(const std::vector<kernel::LiteKernel *> &kernels, const std::vector<Tensor *> &out_tensors) {
+    return memory_plan_.Plan(kernels, out_tensors);
+  }
+
+  // must be called before the planned tensors are deleted
+  void ReleaseMemoryPlan() { memory_plan_.Release(); }
+
  protected:
   int TransformTensorLayoutFp32(Tensor *tensor, schema::Format dst_format, Allocator *allocator = nullptr);
 
   int TransformTensorLayoutUint8(Tensor *tensor, schema::Format dst_format, Allocator *allocator = nullptr);
 
   int TransformTensorLayout(Tensor *tensor, schema::Format dst_format, Allocator *allocator = nullptr);
+
+  StaticMemoryPlan memory_plan_;
 };
 
 }  // namespace mindspore::lite
@@ -15,10 +15,17 @@
  */
 
 #include "src/inner_context.h"
+#include <algorithm>
 #include "include/errorcode.h"
 #include "utils/log_adapter.h"
 
 namespace mindspore::lite {
+namespace {
+constexpr int kWorkStealingTaskNumPerThread = 4;
+// same as the default of DefaultAllocator, 6 is empirical value
+constexpr int kAllocatorShiftFactor = 6;
+}  // namespace
+
 int InnerContext::Init() {
   if (this->thread_pool_ == nullptr) {
     this->thread_pool_ = CreateLiteThreadPool(this->thread_num_, this->cpu_bind_mode_);
@@ -27,6 +34,10 @@ int InnerContext::Init() {
       return RET_NULL_PTR;
     }
   }
+  // kernels of concurrent branches launch on the pool at the same time, the self-scheduled launches let them share
+  // whatever threads are idle instead of queueing behind each other
+  bool concurrent_launch = this->inter_op_parallel_num_ > 1;
+  SetThreadPoolWorkStealing(this->thread_pool_, this->enable_work_stealing_ || concurrent_launch);
   if (this->allocator == nullptr) {
     this->allocator = Allocator::Create();
     if (this->allocator == nullptr) {
@@ -34,9 +45,27 @@ int InnerContext::Init() {
       return RET_NULL_PTR;
     }
   }
+  if (concurrent_launch) {
+    this->allocator->SetContext({kAllocatorShiftFactor, true});
+  }
   return RET_OK;
 }
 
+int InnerContext::GetIntraOpThreadNum() const {
+  if (this->inter_op_parallel_num_ <= 1) {
+    return this->thread_num_;
+  }
+  return std::max(1, this->thread_num_ / this->inter_op_parallel_num_);
+}
+
+int InnerContext::GetParallelTaskNum() const {
+  int thread_num = GetIntraOpThreadNum();
+  if (!this->enable_work_stealing_ || thread_num <= 1) {
+    return thread_num;
+  }
+  return thread_num * kWorkStealingTaskNumPerThread;
+}
+
 InnerContext::~InnerContext() {
   if (this->thread_pool_ != NULL) {
     DestroyThreadPool(this->thread_pool_);
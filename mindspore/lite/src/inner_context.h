@@ -20,15 +20,23 @@
 #include "include/context.h"
 #include "src/runtime/runtime_api.h"
 #include "src/runtime/allocator.h"
+#include "src/runtime/packed_weight_cache.h"
 
 namespace mindspore::lite {
 struct InnerContext : public Context {
  public:
   struct ThreadPool *thread_pool_ = nullptr;
+  std::shared_ptr<PackedWeightCache> packed_weight_cache_ = nullptr;
 
  public:
   int Init();
 
+  /// \brief number of threads a kernel splits its work into, thread_num_ is shared by inter_op_parallel_num_ kernels
+  int GetIntraOpThreadNum() const;
+
+  /// \brief number of tasks a kernel should split its work into, more than its threads when work stealing is on
+  int GetParallelTaskNum() const;
+
   virtual ~InnerContext();
 };
 }  // namespace mindspore::lite
@@ -64,7 +64,7 @@ class LiteKernel {
         primitive_(primitive),
         context_(ctx) {
     if (op_parameter_ != nullptr && ctx != nullptr) {
-      op_parameter_->thread_num_ = ctx->thread_num_;
+      op_parameter_->thread_num_ = ctx->GetIntraOpThreadNum();
     }
     this->in_kernels_.clear();
     this->out_kernels_.clear();
@@ -23,6 +23,7 @@
 #include "src/scheduler.h"
 #include "src/runtime/allocator.h"
 #include "src/executor.h"
+#include "src/runtime/parallel_executor.h"
 #include "src/common/utils.h"
 #include "src/common/graph_util.h"
 #include "src/kernel_registry.h"
@@ -87,6 +88,8 @@ int LiteSession::ConvertTensors(const lite::Model *model) {
         dstTensor->set_shape(shape);
       }
       MS_ASSERT(dstTensor->Size() == srcTensor->data()->size());
+      // only weights of packed_op, which are repacked into kernel buffers, point into the model buffer; the others
+      // are copied so that kernels writing their constant inputs never touch a buffer shared by other sessions
       if (WeightTensorNeedCopy(model, i)) {
         auto dst_data = dstTensor->MutableData();
         if (dst_data == nullptr) {
@@ -260,6 +263,10 @@ int LiteSession::CompileGraph(Model *model) {
     is_running_.store(false);
     return RET_PARAM_INVALID;
   }
+#ifndef SUPPORT_TRAIN
+  // sessions compiled from the same model keep one copy of each packed weight
+  context_->packed_weight_cache_ = PackedWeightCache::GetModelCache(model);
+#endif
 
   auto ret = ConvertTensors(model);
   if (ret != RET_OK) {
@@ -284,6 +291,14 @@ int LiteSession::CompileGraph(Model *model) {
     is_running_.store(false);
     return ret;
   }
+#ifndef SUPPORT_TRAIN
+  ret = executor->PlanMemory(this->kernels_, this->outputs_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Plan memory failed: " << ret;
+    is_running_.store(false);
+    return ret;
+  }
+#endif
   is_running_.store(false);
   return RET_OK;
 }
@@ -324,6 +339,8 @@ int LiteSession::Init(Context *context) {
   this->context_->allocator = context->allocator;
   this->context_->thread_num_ = context->thread_num_;
   this->context_->cpu_bind_mode_ = context->cpu_bind_mode_;
+  this->context_->enable_work_stealing_ = context->enable_work_stealing_;
+  this->context_->inter_op_parallel_num_ = context->inter_op_parallel_num_;
   this->context_->device_type_ = context->device_type_;
   this->context_->float16_priority = context->float16_priority;
   auto ret = this->context_->Init();
@@ -350,7 +367,11 @@ int LiteSession::Init(Context *context) {
     }
   }
 #endif
-  executor = new(std::nothrow) Executor();
+  if (this->context_->inter_op_parallel_num_ > 1) {
+    executor = new (std::nothrow) ParallelExecutor(this->context_->inter_op_parallel_num_);
+  } else {
+    executor = new (std::nothrow) Executor();
+  }
   if (nullptr == executor) {
     MS_LOG(ERROR) << "New Executor failed";
     is_running_.store(false);
@@ -373,6 +394,9 @@ LiteSession::~LiteSession() {
     MS_LOG(ERROR) << "Not support multi-threading";
     return;
   }
+  if (this->executor != nullptr) {
+    this->executor->ReleaseMemoryPlan();
+  }
   for (size_t i = 0; i < tensors_.size(); i++) {
     auto *tensor = tensors_.at(i);
     MS_ASSERT(tensor != nullptr);
@@ -492,9 +516,20 @@ int LiteSession::Resize(const std::vector<mindspore::tensor::MSTensor *> &inputs
     if (resize_ret != RET_OK) {
       MS_LOG(ERROR) << "restore kernel size fail!ret: " << resize_ret;
     }
+#ifndef SUPPORT_TRAIN
+    (void)executor->PlanMemory(this->kernels_, this->outputs_);
+#endif
     is_running_.store(false);
     return ret;
   }
+#ifndef SUPPORT_TRAIN
+  ret = executor->PlanMemory(this->kernels_, this->outputs_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Plan memory failed: " << ret;
+    is_running_.store(false);
+    return ret;
+  }
+#endif
   is_running_.store(false);
   return RET_OK;
 }
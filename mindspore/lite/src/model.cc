@@ -13,12 +13,22 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#if defined(_WIN32) || defined(SUPPORT_TRAIN)
+#include <fstream>
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "src/ops/primitive_c.h"
 #include "include/model.h"
 #include "utils/log_adapter.h"
 #include "include/errorcode.h"
 #include "src/common/graph_util.h"
 #include "include/version.h"
+#include "src/runtime/packed_weight_cache.h"
 
 namespace mindspore::lite {
 
@@ -67,6 +77,38 @@ bool ConvertTensors(const schema::MetaGraph *meta_graph, Model *model) {
   return true;
 }
 
+namespace {
+bool InitModelFromBuf(Model *model) {
+  auto meta_graph = schema::GetMetaGraph(model->buf);
+  if (meta_graph == nullptr) {
+    MS_LOG(ERROR) << "meta_graph is nullptr!";
+    return false;
+  }
+
+  if (meta_graph->name() != nullptr) {
+    model->name_ = meta_graph->name()->c_str();
+  }
+  if (meta_graph->version() != nullptr) {
+    model->version_ = meta_graph->version()->c_str();
+  }
+
+  if (model->version_ != Version()) {
+    MS_LOG(WARNING) << "model version is " << model->version_ << ", inference version is " << Version() << " not equal";
+  }
+
+  auto in_count = meta_graph->inputIndex()->size();
+  for (uint32_t i = 0; i < in_count; ++i) {
+    model->input_indices_.push_back(size_t(meta_graph->inputIndex()->GetAs<uint32_t>(i)));
+  }
+
+  auto out_count = meta_graph->outputIndex()->size();
+  for (uint32_t i = 0; i < out_count; ++i) {
+    model->output_indices_.push_back(size_t(meta_graph->outputIndex()->GetAs<uint32_t>(i)));
+  }
+  return ConvertNodes(meta_graph, model) && ConvertTensors(meta_graph, model);
+}
+}  // namespace
+
 Model *Model::Import(const char *model_buf, size_t size) {
   if (model_buf == nullptr) {
     MS_LOG(ERROR) << "The model buf is nullptr";
@@ -89,47 +131,75 @@ Model *Model::Import(const char *model_buf, size_t size) {
     return nullptr;
   }
   memcpy(model->buf, model_buf, size);
-  auto meta_graph = schema::GetMetaGraph(model->buf);
-  if (meta_graph == nullptr) {
-    MS_LOG(ERROR) << "meta_graph is nullptr!";
-    delete(model);
-    free(model->buf);
+  if (!InitModelFromBuf(model)) {
+    delete model;
     return nullptr;
   }
+  return model;
+}
 
-  if (meta_graph->name() != nullptr) {
-    model->name_ = meta_graph->name()->c_str();
+Model *Model::ImportFromFile(const char *model_path) {
+  if (model_path == nullptr) {
+    MS_LOG(ERROR) << "The model path is nullptr";
+    return nullptr;
   }
-  if (meta_graph->version() != nullptr) {
-    model->version_ = meta_graph->version()->c_str();
+  // training updates constant tensors in place, so they can not point into a read-only mapping
+#if defined(_WIN32) || defined(SUPPORT_TRAIN)
+  std::ifstream ifs(model_path, std::ifstream::in | std::ifstream::binary);
+  if (!ifs.good()) {
+    MS_LOG(ERROR) << "open model file failed: " << model_path;
+    return nullptr;
   }
-
-  if (model->version_ != Version()) {
-    MS_LOG(WARNING) << "model version is " << model->version_ << ", inference version is " << Version() << " not equal";
+  std::vector<char> model_buf((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  return Import(model_buf.data(), model_buf.size());
+#else
+  int fd = open(model_path, O_RDONLY);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "open model file failed: " << model_path;
+    return nullptr;
   }
-
-  auto in_count = meta_graph->inputIndex()->size();
-  for (uint32_t i = 0; i < in_count; ++i) {
-    model->input_indices_.push_back(size_t(meta_graph->inputIndex()->GetAs<uint32_t>(i)));
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    MS_LOG(ERROR) << "stat model file failed: " << model_path;
+    close(fd);
+    return nullptr;
   }
-
-  auto out_count = meta_graph->outputIndex()->size();
-  for (uint32_t i = 0; i < out_count; ++i) {
-    model->output_indices_.push_back(size_t(meta_graph->outputIndex()->GetAs<uint32_t>(i)));
+  auto size = static_cast<size_t>(file_stat.st_size);
+  // read-only mapping: constant tensors which kernels may write are copied per session by LiteSession
+  auto addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    MS_LOG(ERROR) << "mmap model file failed: " << model_path;
+    return nullptr;
   }
-  if (!ConvertNodes(meta_graph, model)) {
-    delete model;
+  flatbuffers::Verifier verify(reinterpret_cast<const uint8_t *>(addr), size);
+  if (!schema::VerifyMetaGraphBuffer(verify)) {
+    MS_LOG(ERROR) << "The model file is invalid and fail to create graph: " << model_path;
+    munmap(addr, size);
     return nullptr;
   }
-
-  if (!ConvertTensors(meta_graph, model)) {
+  Model *model = new (std::nothrow) Model();
+  if (model == nullptr) {
+    MS_LOG(ERROR) << "new model fail!";
+    munmap(addr, size);
+    return nullptr;
+  }
+  model->buf = reinterpret_cast<char *>(addr);
+  model->mmap_size_ = size;
+  if (!InitModelFromBuf(model)) {
     delete model;
     return nullptr;
   }
   return model;
+#endif
 }
 
 void Model::Free() {
+  // constant tensors of sessions point into a mapped buf, so it is only released by Destroy
+  if (this->mmap_size_ != 0) {
+    return;
+  }
+  PackedWeightCache::EraseModelCache(this);
   if (this->buf != nullptr) {
     free(this->buf);
     this->buf = nullptr;
@@ -138,6 +208,14 @@ void Model::Free() {
 
 void Model::Destroy() {
   Free();
+  if (this->mmap_size_ != 0) {
+    PackedWeightCache::EraseModelCache(this);
+#if !defined(_WIN32) && !defined(SUPPORT_TRAIN)
+    munmap(this->buf, this->mmap_size_);
+#endif
+    this->buf = nullptr;
+    this->mmap_size_ = 0;
+  }
   auto nodes_size = this->nodes_.size();
   for (size_t i = 0; i < nodes_size; ++i) {
     auto node = this->nodes_[i];
@@ -49,6 +49,7 @@ void *DefaultAllocator::Malloc(size_t size) {
     MS_LOG(ERROR) << "MallocData out of max_size, size: " << size;
     return nullptr;
   }
+  malloc_count_++;
   Lock();
   auto iter = freeList.lower_bound(size);
   if (iter != freeList.end() && (iter->second->size >= size) && (iter->second->size < (size << shiftFactor))) {
@@ -77,6 +78,7 @@ void DefaultAllocator::Free(void *buf) {
   if (buf == nullptr) {
     return;
   }
+  free_count_++;
   Lock();
   auto iter = allocatedList.find(buf);
   if (iter != allocatedList.end()) {
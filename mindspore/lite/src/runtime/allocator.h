@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_ALLOCATOR_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_ALLOCATOR_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -39,6 +40,9 @@ class Allocator {
   virtual void Free(void *ptr) = 0;
   virtual void SetContext(const AllocatorContext &ctx) {}
   virtual size_t GetTotalSize() { return 0; }
+  // number of Malloc and Free calls, used to check that planned runs do not allocate
+  virtual size_t GetMallocCount() { return 0; }
+  virtual size_t GetFreeCount() { return 0; }
   virtual void Clear() {}
   static std::shared_ptr<Allocator> Create();
   virtual void *Prepare(void *ptr) { return ptr; }
@@ -53,6 +57,8 @@ class DefaultAllocator : public Allocator {
   void *Malloc(size_t size) override;
   void Free(void *ptr) override;
   size_t GetTotalSize() override;
+  size_t GetMallocCount() override { return malloc_count_; }
+  size_t GetFreeCount() override { return free_count_; }
   void Clear() override;
 
  private:
@@ -70,6 +76,8 @@ class DefaultAllocator : public Allocator {
   // 6 is empirical value
   int shiftFactor = 6;
   bool lockFlag = false;
+  std::atomic<size_t> malloc_count_{0};
+  std::atomic<size_t> free_count_{0};
 };
 
 #define MAX_MALLOC_SIZE (2000 * 1024 * 1024)
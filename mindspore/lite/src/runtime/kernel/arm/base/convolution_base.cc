@@ -90,7 +90,7 @@ int ConvolutionBaseCPUKernel::Init() {
   conv_param_->output_h_ = output->Height();
   conv_param_->output_w_ = output->Width();
   conv_param_->output_channel_ = output->Channel();
-  conv_param_->thread_num_ = ctx_->thread_num_;
+  conv_param_->thread_num_ = ctx_->GetIntraOpThreadNum();
   return RET_OK;
 }
 
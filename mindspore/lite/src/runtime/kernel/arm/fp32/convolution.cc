@@ -55,13 +55,28 @@ int ConvolutionCPUKernel::InitWeightBias() {
   int pack_weight_size = oc_block_num * oc_block * ic4 * C4NUM * kernel_plane;
 
   auto origin_weight = reinterpret_cast<float *>(filter_tensor->MutableData());
-  packed_weight_ = reinterpret_cast<float *>(malloc(pack_weight_size * sizeof(float)));
-  if (packed_weight_ == nullptr) {
-    MS_LOG(ERROR) << "malloc packed weight failed.";
-    return RET_ERROR;
+  // dequantized weights live in a temporary buffer, so only float weights from the model can be shared
+  bool weight_quant = primitive_ != nullptr && primitive_->GetQuantType() == schema::QuantType_WeightQuant;
+  if (ctx_->packed_weight_cache_ != nullptr && filter_tensor->data_type() == kNumberTypeFloat32 && !weight_quant) {
+    shared_packed_weight_ = ctx_->packed_weight_cache_->GetPackedWeight(
+      origin_weight, "conv_fp32", pack_weight_size * sizeof(float), [&](void *packed) {
+        PackWeightFp32(origin_weight, conv_param_, reinterpret_cast<float *>(packed), oc_block, oc_block_num);
+        return RET_OK;
+      });
+    if (shared_packed_weight_ == nullptr) {
+      MS_LOG(ERROR) << "get shared packed weight failed.";
+      return RET_ERROR;
+    }
+    packed_weight_ = reinterpret_cast<float *>(shared_packed_weight_.get());
+  } else {
+    packed_weight_ = reinterpret_cast<float *>(malloc(pack_weight_size * sizeof(float)));
+    if (packed_weight_ == nullptr) {
+      MS_LOG(ERROR) << "malloc packed weight failed.";
+      return RET_ERROR;
+    }
+    memset(packed_weight_, 0, pack_weight_size * sizeof(float));
+    PackWeightFp32(origin_weight, conv_param_, packed_weight_, oc_block, oc_block_num);
   }
-  memset(packed_weight_, 0, pack_weight_size * sizeof(float));
-  PackWeightFp32(origin_weight, conv_param_, packed_weight_, oc_block, oc_block_num);
 
   bias_data_ = reinterpret_cast<float *>(malloc(oc_block_num * oc_block * sizeof(float)));
   if (bias_data_ == nullptr) {
@@ -150,6 +165,9 @@ int ConvolutionCPUKernel::ReSize() {
     MS_LOG(ERROR) << "ConvolutionBase init failed.";
     return RET_ERROR;
   }
+  // output tiles are strided by thread_num_, so more tasks give the work stealing pool finer chunks
+  thread_count_ = ctx_->GetParallelTaskNum();
+  conv_param_->thread_num_ = thread_count_;
   return RET_OK;
 }
 
@@ -230,7 +248,7 @@ kernel::LiteKernel *CpuConvFp32KernelCreator(const std::vector<lite::Tensor *> &
   conv_param->output_h_ = outputs.front()->Height();
   conv_param->output_w_ = outputs.front()->Width();
   conv_param->output_channel_ = outputs.front()->Channel();
-  conv_param->op_parameter_.thread_num_ = ctx->thread_num_;
+  conv_param->op_parameter_.thread_num_ = ctx->GetIntraOpThreadNum();
   bool use_winograd = false;
   int out_unit;
   if (primitive != nullptr && primitive->GetInferFlag()) {
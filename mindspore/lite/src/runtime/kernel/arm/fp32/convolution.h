@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_CONVOLUTION_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_CONVOLUTION_H_
 
+#include <memory>
 #include <vector>
 #include "src/lite_kernel.h"
 #include "nnacl/op_base.h"
@@ -31,7 +32,7 @@ class ConvolutionCPUKernel : public ConvolutionBaseCPUKernel {
                        const mindspore::lite::PrimitiveC *primitive)
       : ConvolutionBaseCPUKernel(parameter, inputs, outputs, ctx, primitive) {}
   ~ConvolutionCPUKernel() override {
-    if (packed_weight_ != nullptr) {
+    if (packed_weight_ != nullptr && shared_packed_weight_ == nullptr) {
       free(packed_weight_);
       packed_weight_ = nullptr;
     }
@@ -62,6 +63,8 @@ class ConvolutionCPUKernel : public ConvolutionBaseCPUKernel {
   }
   float *packed_input_ = nullptr;
   float *packed_weight_ = nullptr;
+  // owns packed_weight_ when it comes from the packed weight cache of the model
+  std::shared_ptr<void> shared_packed_weight_ = nullptr;
   float *tmp_output_block_ = nullptr;
   GEMM_FUNC_FP32 gemm_func_ = nullptr;
 };
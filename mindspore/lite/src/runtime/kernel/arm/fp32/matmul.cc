@@ -32,6 +32,10 @@ void MatmulCPUKernel::FreeTmpBuffer() {
     free(a_c12_ptr_);
     a_c12_ptr_ = nullptr;
   }
+  if (shared_b_r8_ != nullptr) {
+    shared_b_r8_ = nullptr;
+    b_r8_ptr_ = nullptr;
+  }
   if (b_r8_ptr_ != nullptr) {
     free(b_r8_ptr_);
     b_r8_ptr_ = nullptr;
@@ -65,7 +69,7 @@ int MatmulCPUKernel::ReSize() {
   params_->row_4_ = UP_ROUND(params_->row_, C4NUM);
   params_->row_12_ = UP_ROUND(params_->row_, C12NUM);
   params_->col_8_ = UP_ROUND(params_->col_, 8);
-  thread_count_ = MSMIN(thread_count_, UP_DIV(params_->col_8_, 8));
+  thread_count_ = MSMIN(ctx_->GetParallelTaskNum(), UP_DIV(params_->col_8_, 8));
   thread_stride_ = UP_DIV(UP_DIV(params_->col_8_, 8), thread_count_);
 
 #ifdef ENABLE_ARM32
@@ -84,21 +88,37 @@ int MatmulCPUKernel::ReSize() {
   memset(a_c12_ptr_, 0, params_->row_12_ * params_->deep_ * sizeof(float));
 #endif
 
-  b_r8_ptr_ = reinterpret_cast<float *>(malloc(params_->batch * params_->col_8_ * params_->deep_ * sizeof(float)));
-  if (b_r8_ptr_ == nullptr) {
-    FreeTmpBuffer();
-    return RET_MEMORY_FAILED;
-  }
-  memset(b_r8_ptr_, 0, params_->col_8_ * params_->deep_ * sizeof(float));
-
   params_->a_const_ = (in_tensors_[0]->data_c() != nullptr);
   params_->b_const_ = (in_tensors_[1]->data_c() != nullptr);
+  size_t b_r8_size = params_->batch * params_->col_8_ * params_->deep_ * sizeof(float);
+  if (params_->b_const_ == true && ctx_->packed_weight_cache_ != nullptr &&
+      in_tensors_[1]->category() == lite::Tensor::CONST && in_tensors_[1]->data_type() == kNumberTypeFloat32) {
+    auto b_src = reinterpret_cast<float *>(in_tensors_[1]->data_c());
+    auto layout = params_->b_transpose_ ? "matmul_fp32_col8" : "matmul_fp32_row8";
+    shared_b_r8_ = ctx_->packed_weight_cache_->GetPackedWeight(b_src, layout, b_r8_size, [&](void *packed) {
+      InitMatrixB(b_src, reinterpret_cast<float *>(packed));
+      return RET_OK;
+    });
+    if (shared_b_r8_ == nullptr) {
+      FreeTmpBuffer();
+      return RET_MEMORY_FAILED;
+    }
+    b_r8_ptr_ = reinterpret_cast<float *>(shared_b_r8_.get());
+  } else {
+    b_r8_ptr_ = reinterpret_cast<float *>(malloc(b_r8_size));
+    if (b_r8_ptr_ == nullptr) {
+      FreeTmpBuffer();
+      return RET_MEMORY_FAILED;
+    }
+    memset(b_r8_ptr_, 0, params_->col_8_ * params_->deep_ * sizeof(float));
+    if (params_->b_const_ == true) {
+      InitMatrixB(reinterpret_cast<float *>(in_tensors_[1]->data_c()), b_r8_ptr_);
+    }
+  }
+
   if (params_->a_const_ == true) {
     InitMatrixA(reinterpret_cast<float *>(in_tensors_[0]->data_c()), a_c12_ptr_);
   }
-  if (params_->b_const_ == true) {
-    InitMatrixB(reinterpret_cast<float *>(in_tensors_[1]->data_c()), b_r8_ptr_);
-  }
 
   bias_ptr_ = reinterpret_cast<float *>(malloc(params_->col_8_ * sizeof(float)));
   if (bias_ptr_ == nullptr) {
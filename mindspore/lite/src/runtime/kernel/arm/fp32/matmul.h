@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_MATMUL_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_MATMUL_H_
 
+#include <memory>
 #include <vector>
 #include "src/lite_kernel.h"
 #include "nnacl/matmul_parameter.h"
@@ -44,6 +45,8 @@ class MatmulCPUKernel : public MatmulBaseCPUKernel {
  private:
   float *a_c12_ptr_ = nullptr;
   float *b_r8_ptr_ = nullptr;
+  // owns b_r8_ptr_ when the const matrix b comes from the packed weight cache of the model
+  std::shared_ptr<void> shared_b_r8_ = nullptr;
   float *bias_ptr_ = nullptr;
   float *a_ptr_ = nullptr;
   float *b_ptr_ = nullptr;
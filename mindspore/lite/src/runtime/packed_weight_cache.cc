@@ -0,0 +1,73 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/runtime/packed_weight_cache.h"
+#include <cstdlib>
+#include <cstring>
+#include "include/errorcode.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore::lite {
+namespace {
+std::mutex model_cache_mutex;
+std::map<const Model *, std::weak_ptr<PackedWeightCache>> model_caches;
+}  // namespace
+
+std::shared_ptr<PackedWeightCache> PackedWeightCache::GetModelCache(const Model *model) {
+  MS_ASSERT(model != nullptr);
+  std::lock_guard<std::mutex> lock(model_cache_mutex);
+  auto cache = model_caches[model].lock();
+  if (cache == nullptr) {
+    cache = std::make_shared<PackedWeightCache>();
+    model_caches[model] = cache;
+  }
+  return cache;
+}
+
+void PackedWeightCache::EraseModelCache(const Model *model) {
+  std::lock_guard<std::mutex> lock(model_cache_mutex);
+  model_caches.erase(model);
+}
+
+std::shared_ptr<void> PackedWeightCache::GetPackedWeight(const void *origin, const std::string &layout, size_t size,
+                                                         const PackFunc &pack_func) {
+  MS_ASSERT(origin != nullptr);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto key = std::make_pair(origin, layout);
+  auto iter = packed_weights_.find(key);
+  if (iter != packed_weights_.end()) {
+    return iter->second;
+  }
+  auto packed = malloc(size);
+  if (packed == nullptr) {
+    MS_LOG(ERROR) << "malloc packed weight failed, size: " << size;
+    return nullptr;
+  }
+  std::shared_ptr<void> packed_weight(packed, free);
+  memset(packed, 0, size);
+  if (pack_func(packed) != RET_OK) {
+    MS_LOG(ERROR) << "pack weight failed, layout: " << layout;
+    return nullptr;
+  }
+  packed_weights_[key] = packed_weight;
+  return packed_weight;
+}
+
+size_t PackedWeightCache::packed_weight_num() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return packed_weights_.size();
+}
+}  // namespace mindspore::lite
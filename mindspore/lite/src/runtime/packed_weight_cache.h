@@ -0,0 +1,60 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_PACKED_WEIGHT_CACHE_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_PACKED_WEIGHT_CACHE_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace mindspore::lite {
+struct Model;
+
+/// \brief Packed weights shared by every session compiled from one model.
+///
+/// Weights of packed ops point into the model buffer, so the origin data address together with the packing layout
+/// identifies a packed weight across sessions. Sessions running concurrently on the same model then keep a single
+/// copy of each packed weight.
+class PackedWeightCache {
+ public:
+  using PackFunc = std::function<int(void *packed)>;
+
+  PackedWeightCache() = default;
+  ~PackedWeightCache() = default;
+
+  /// \brief get the cache of model, create it if no session holds it now
+  static std::shared_ptr<PackedWeightCache> GetModelCache(const Model *model);
+
+  /// \brief forget the cache of model once its buffer is freed, sessions holding it still keep their weights
+  static void EraseModelCache(const Model *model);
+
+  /// \brief return the weight packed from origin in layout, on a miss pack_func fills a zeroed buffer of size bytes
+  std::shared_ptr<void> GetPackedWeight(const void *origin, const std::string &layout, size_t size,
+                                        const PackFunc &pack_func);
+
+  size_t packed_weight_num();
+
+ private:
+  std::mutex mutex_;
+  std::map<std::pair<const void *, std::string>, std::shared_ptr<void>> packed_weights_;
+};
+}  // namespace mindspore::lite
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_PACKED_WEIGHT_CACHE_H_
@@ -14,15 +14,26 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <utility>
 #include "src/runtime/parallel_executor.h"
 #include "src/runtime/runtime_api.h"
 
-#define MAX_THREAD_NUM 8
 namespace mindspore::lite {
-ParallelExecutor::~ParallelExecutor() { DestroyThreadPool(thread_pool_); }
+ParallelExecutor::~ParallelExecutor() {
+  if (thread_pool_ != NULL) {
+    DestroyThreadPool(thread_pool_);
+    free(thread_pool_);
+    thread_pool_ = NULL;
+  }
+}
+
 int ParallelExecutor::Prepare(std::vector<mindspore::kernel::LiteKernel *> &kernels) {
-  thread_pool_ = CreateLiteThreadPool(MAX_THREAD_NUM, NO_BIND);
+  if (thread_pool_ != NULL) {
+    return RET_OK;
+  }
+  inter_op_thread_num_ = std::max(1, std::min(inter_op_thread_num_, MAX_INTER_OP_THREAD_NUM));
+  thread_pool_ = CreateLiteThreadPool(inter_op_thread_num_, NO_BIND);
   if (thread_pool_ == nullptr) {
     MS_LOG(ERROR) << "Memory error: fail to new ThreadPool";
     return RET_ERROR;
@@ -30,27 +41,88 @@ int ParallelExecutor::Prepare(std::vector<mindspore::kernel::LiteKernel *> &kern
   return RET_OK;
 }
 
-static int RunKernel(void *data, int index) {
-  ParallelExecutor *executor = reinterpret_cast<ParallelExecutor *>(data);
-  auto kernel = executor->GetReadyKernel(index);
+static int RunReadyKernelsTask(void *data, int index) {
+  auto executor = reinterpret_cast<ParallelExecutor *>(data);
+  executor->RunReadyKernels();
+  return RET_OK;
+}
+
+int ParallelExecutor::RunKernel(kernel::LiteKernel *kernel) {
+  MS_ASSERT(kernel != nullptr);
+  if (before_ != nullptr) {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    if (!before_(TensorVectorCast(kernel->in_tensors()), TensorVectorCast(kernel->out_tensors()),
+                 {kernel->name(), kernel->type_str()})) {
+      MS_LOG(ERROR) << "run kernel before_callback failed, name: " << kernel->name();
+    }
+  }
   auto ret = kernel->Run();
-  executor->SetResult(index, ret);
-  if (0 != ret) {
+  if (ret != RET_OK) {
     MS_LOG(ERROR) << "run kernel failed, name: " << kernel->name();
-    return 0;
+    return ret;
   }
+  if (after_ != nullptr) {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    if (!after_(TensorVectorCast(kernel->in_tensors()), TensorVectorCast(kernel->out_tensors()),
+                {kernel->name(), kernel->type_str()})) {
+      MS_LOG(ERROR) << "run kernel after_callback failed, name: " << kernel->name();
+    }
+  }
+  return RET_OK;
+}
 
-  for (auto input_kernel : kernel->in_kernels()) {
-    MS_ASSERT(input_kernel != nullptr);
-    if (input_kernel->is_model_output()) {
-      continue;
+void ParallelExecutor::RunReadyKernels() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    // nothing ready and nothing running means the rest of the kernels wait on each other
+    cond_.wait(lock, [this] { return !ready_kernels_.empty() || running_kernel_num_ == 0 || has_error_; });
+    if (ready_kernels_.empty() || has_error_) {
+      return;
     }
-    ret = input_kernel->DecOutTensorRefCount();
-    if (0 != ret) {
-      MS_LOG(WARNING) << "DecOutTensorRefCount for kernel" << kernel->name() << " failed";
+    auto kernel = ready_kernels_.front();
+    ready_kernels_.pop_front();
+    running_kernel_num_++;
+    lock.unlock();
+    auto ret = RunKernel(kernel);
+    lock.lock();
+    running_kernel_num_--;
+    if (ret != RET_OK) {
+      has_error_ = true;
+      cond_.notify_all();
+      return;
+    }
+    remaining_kernel_num_--;
+    size_t new_ready_num = 0;
+    for (auto out_kernel : kernel->out_kernels()) {
+      auto iter = pending_in_kernels_.find(out_kernel);
+      if (iter == pending_in_kernels_.end()) {
+        continue;
+      }
+      if (--(iter->second) == 0) {
+        ready_kernels_.push_back(out_kernel);
+        pending_in_kernels_.erase(iter);
+        new_ready_num++;
+      }
+    }
+    // reference counts of tensors read by kernels of several branches are only touched under the lock
+    for (auto input_kernel : kernel->in_kernels()) {
+      MS_ASSERT(input_kernel != nullptr);
+      if (input_kernel->is_model_output()) {
+        continue;
+      }
+      if (input_kernel->DecOutTensorRefCount() != RET_OK) {
+        MS_LOG(WARNING) << "DecOutTensorRefCount for kernel" << kernel->name() << " failed";
+      }
+    }
+    // this thread takes one of the new kernels itself, the others go to idle threads
+    if (ready_kernels_.empty() && running_kernel_num_ == 0) {
+      cond_.notify_all();
+    } else {
+      for (size_t i = 1; i < new_ready_num; ++i) {
+        cond_.notify_one();
+      }
     }
   }
-  return 0;
 }
 
 int ParallelExecutor::Run(std::vector<Tensor *> &in_tensors, std::vector<Tensor *> &out_tensors,
@@ -67,54 +139,50 @@ int ParallelExecutor::Run(std::vector<Tensor *> &in_tensors, std::vector<Tensor
       return RET_ERROR;
     }
   }
+  if (thread_pool_ == NULL) {
+    MS_LOG(ERROR) << "ParallelExecutor is not prepared";
+    return RET_ERROR;
+  }
   kernel::LiteKernelUtil::InitTensorRefCount(kernels);
-
-  for (auto kernel : kernels) {
-    if (kernel->in_kernels().size() == 0) {
-      readyKernels.emplace_back(kernel);
-      continue;
-    }
-    refCount[kernel] = kernel->in_kernels().size();
+  for (auto out_tensor : out_tensors) {  // increase RefCount of output tensors, such that Run will not free them
+    out_tensor->SetRefCount(out_tensor->RefCount() + 1);
   }
-  std::vector<kernel::LiteKernel *> newReadyKernels;
-  while (readyKernels.size() > 0) {
-    results.resize(readyKernels.size(), RET_OK);
-    ParallelLaunch(thread_pool_, RunKernel, this, readyKernels.size());
 
-    if (std::find_if(results.begin(), results.end(), [](const int &ret) { return (ret != 0); }) != results.end()) {
-      return RET_ERROR;
-    }
-    newReadyKernels.clear();
-    for (auto completed : readyKernels) {
-      for (auto out : completed->out_kernels()) {
-        auto iter = refCount.find(out);
-        if (iter == refCount.end()) {
-          continue;
-        }
-        (iter->second)--;
-        if (iter->second <= 0) {
-          newReadyKernels.emplace_back(iter->first);
-          refCount.erase(iter);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_in_kernels_.clear();
+    ready_kernels_.clear();
+    for (auto kernel : kernels) {
+      // in_kernels outside of kernels, e.g. of another subgraph, have finished already
+      size_t pending_num = 0;
+      for (auto in_kernel : kernel->in_kernels()) {
+        if (std::find(kernels.begin(), kernels.end(), in_kernel) != kernels.end()) {
+          pending_num++;
         }
       }
-
-      for (auto input_kernel : completed->in_kernels()) {
-        MS_ASSERT(input_kernel != nullptr);
-        if (input_kernel->is_model_output()) {
-          continue;
-        }
-        auto ret = input_kernel->DecOutTensorRefCount();
-        if (0 != ret) {
-          MS_LOG(WARNING) << "DecOutTensorRefCount for kernel" << completed->name() << " failed";
-          return -1;
-        }
+      if (pending_num == 0) {
+        ready_kernels_.push_back(kernel);
+      } else {
+        pending_in_kernels_[kernel] = pending_num;
       }
     }
-    readyKernels.clear();
-    readyKernels = std::move(newReadyKernels);
+    remaining_kernel_num_ = kernels.size();
+    running_kernel_num_ = 0;
+    has_error_ = false;
+    before_ = before;
+    after_ = after;
+  }
+  auto ret = ParallelLaunch(thread_pool_, RunReadyKernelsTask, this, inter_op_thread_num_);
+  std::lock_guard<std::mutex> lock(mutex_);
+  before_ = nullptr;
+  after_ = nullptr;
+  if (ret != RET_OK || has_error_) {
+    return RET_ERROR;
+  }
+  if (remaining_kernel_num_ != 0) {
+    MS_LOG(ERROR) << remaining_kernel_num_ << " kernels never became ready, the kernel graph has a cycle";
+    return RET_ERROR;
   }
-
   return RET_OK;
 }
-
 }  // namespace mindspore::lite
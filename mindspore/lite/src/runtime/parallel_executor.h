@@ -17,32 +17,57 @@
 #ifndef MINDSPORE_LITE_PARALLEL_EXECUTOR_H_
 #define MINDSPORE_LITE_PARALLEL_EXECUTOR_H_
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
 #include "src/runtime/allocator.h"
 #include "src/lite_kernel.h"
 #include "include/lite_session.h"
 #include "src/executor.h"
+#include "include/errorcode.h"
 
+#define MAX_INTER_OP_THREAD_NUM 8
 namespace mindspore::lite {
+// Dataflow executor: a kernel becomes ready once all its in_kernels finished, and up to inter_op_thread_num_ ready
+// kernels run at the same time. Each kernel still splits its own work over the context thread pool.
 class ParallelExecutor : public Executor {
  public:
   ParallelExecutor() = default;
+  explicit ParallelExecutor(int inter_op_thread_num) : inter_op_thread_num_(inter_op_thread_num) {}
   virtual ~ParallelExecutor();
 
   int Prepare(std::vector<kernel::LiteKernel *> &kernels) override;
 
+  // kernels run out of order, so tensor lifetimes are not known statically
+  int PlanMemory(const std::vector<kernel::LiteKernel *> &kernels, const std::vector<Tensor *> &out_tensors) override {
+    return RET_OK;
+  }
+
   int Run(std::vector<Tensor *> &in_tensors, std::vector<Tensor *> &out_tensors,
           std::vector<kernel::LiteKernel *> &kernels, Allocator *allocator = nullptr,
           const session::KernelCallBack &before = nullptr, const session::KernelCallBack &after = nullptr) override;
-  inline kernel::LiteKernel *GetReadyKernel(const int index) { return readyKernels.at(index); }
-  inline void SetResult(const int index, const int result) { results.at(index) = result; }
+
+  // take ready kernels until every kernel finished or one failed, called by each inter-op thread
+  void RunReadyKernels();
 
  private:
-  std::unordered_map<kernel::LiteKernel *, size_t> refCount;
-  std::vector<kernel::LiteKernel *> readyKernels;
-  std::vector<int> results;
+  int RunKernel(kernel::LiteKernel *kernel);
+
+  int inter_op_thread_num_ = MAX_INTER_OP_THREAD_NUM;
   struct ThreadPool *thread_pool_ = NULL;
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  // number of unfinished in_kernels of the kernels not ready yet
+  std::unordered_map<kernel::LiteKernel *, size_t> pending_in_kernels_;
+  std::deque<kernel::LiteKernel *> ready_kernels_;
+  size_t remaining_kernel_num_ = 0;
+  size_t running_kernel_num_ = 0;
+  bool has_error_ = false;
+  std::mutex callback_mutex_;
+  session::KernelCallBack before_ = nullptr;
+  session::KernelCallBack after_ = nullptr;
 };
 
 }  // namespace mindspore::lite
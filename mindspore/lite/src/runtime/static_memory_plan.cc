@@ -0,0 +1,134 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/runtime/static_memory_plan.h"
+#include <unordered_map>
+#include <utility>
+#include "backend/optimizer/mem_reuse/mem_offset_plan.h"
+#include "include/errorcode.h"
+#include "src/common/utils.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore::lite {
+StaticMemoryPlan::~StaticMemoryPlan() {
+  // the tensors may be gone already, only the arena is owned here
+  if (arena_ != nullptr) {
+    free(arena_);
+    arena_ = nullptr;
+  }
+}
+
+size_t StaticMemoryPlan::AssignBlockOffsets(std::vector<MemoryBlock> *blocks) {
+  MS_ASSERT(blocks != nullptr);
+  return memreuse::AssignBestFitOffsets(blocks);
+}
+
+int StaticMemoryPlan::Plan(const std::vector<kernel::LiteKernel *> &kernels, const std::vector<Tensor *> &outputs) {
+  Release();
+  for (auto kernel : kernels) {
+    MS_ASSERT(kernel != nullptr);
+    // subgraphs of other devices own their tensors, and unknown shapes leave nothing to plan
+    if (kernel->desc().arch != kernel::KERNEL_ARCH::kCPU || !kernel->InferShapeDone()) {
+      MS_LOG(INFO) << "Kernel " << kernel->name() << " can not be planned statically, use dynamic allocation.";
+      return RET_OK;
+    }
+  }
+
+  std::vector<MemoryBlock> blocks;
+  std::unordered_map<Tensor *, size_t> block_index;
+  for (size_t index = 0; index < kernels.size(); ++index) {
+    auto kernel = kernels[index];
+    for (auto tensor : kernel->in_tensors()) {
+      auto iter = block_index.find(tensor);
+      if (iter != block_index.end()) {
+        blocks[iter->second].last_use_ = index;
+      }
+    }
+    // the executor never frees the outputs of model output kernels, keep them out of the arena as well
+    if (kernel->is_model_output()) {
+      continue;
+    }
+    for (auto tensor : kernel->out_tensors()) {
+      MS_ASSERT(tensor != nullptr);
+      if (tensor->category() == Tensor::Category::CONST || IsContain(outputs, tensor) ||
+          block_index.find(tensor) != block_index.end()) {
+        continue;
+      }
+      auto size = tensor->Size();
+      if (size == 0) {
+        MS_LOG(INFO) << "Output of kernel " << kernel->name() << " has no size yet, use dynamic allocation.";
+        return RET_OK;
+      }
+      block_index[tensor] = blocks.size();
+      blocks.push_back({tensor, size, index, index, 0});
+    }
+  }
+  if (blocks.empty()) {
+    return RET_OK;
+  }
+
+  size_t arena_size = AssignBlockOffsets(&blocks);
+  arena_ = malloc(arena_size);
+  if (arena_ == nullptr) {
+    MS_LOG(ERROR) << "Malloc memory plan arena failed, size: " << arena_size;
+    return RET_MEMORY_FAILED;
+  }
+  // buffers left from a dynamically allocated run go back to their allocator
+  for (auto &block : blocks) {
+    block.tensor_->FreeData();
+  }
+  blocks_ = std::move(blocks);
+  arena_size_ = arena_size;
+  size_t naive_size = 0;
+  for (const auto &block : blocks_) {
+    naive_size += block.size_;
+  }
+  MS_LOG(INFO) << "Static memory plan: " << blocks_.size() << " tensors, naive size " << naive_size
+               << " bytes, arena size " << arena_size_ << " bytes.";
+  return RET_OK;
+}
+
+bool StaticMemoryPlan::Bind() {
+  if (arena_ == nullptr) {
+    return false;
+  }
+  for (const auto &block : blocks_) {
+    if (block.tensor_->Size() > block.size_) {
+      MS_LOG(WARNING) << "Tensor outgrew its planned size " << block.size_ << ", use dynamic allocation.";
+      Release();
+      return false;
+    }
+    block.tensor_->SetData(reinterpret_cast<char *>(arena_) + block.offset_);
+  }
+  return true;
+}
+
+void StaticMemoryPlan::Release() {
+  auto arena_begin = reinterpret_cast<char *>(arena_);
+  for (const auto &block : blocks_) {
+    auto data = reinterpret_cast<char *>(block.tensor_->data_c());
+    if (data >= arena_begin && data < arena_begin + arena_size_) {
+      block.tensor_->SetData(nullptr);
+    }
+  }
+  blocks_.clear();
+  if (arena_ != nullptr) {
+    free(arena_);
+    arena_ = nullptr;
+  }
+  arena_size_ = 0;
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_STATIC_MEMORY_PLAN_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_STATIC_MEMORY_PLAN_H_
+
+#include <vector>
+#include "src/lite_kernel.h"
+#include "src/tensor.h"
+
+namespace mindspore::lite {
+/// \brief A tensor buffer living from kernel first_use_ to kernel last_use_ in execution order.
+struct MemoryBlock {
+  Tensor *tensor_ = nullptr;
+  size_t size_ = 0;
+  size_t first_use_ = 0;
+  size_t last_use_ = 0;
+  size_t offset_ = 0;
+};
+
+/// \brief Static layout of the intermediate tensors of a graph in one arena.
+///
+/// Tensors whose lifetimes do not overlap share memory. The layout is computed once the output shapes are known,
+/// so each run only points the tensors into the arena instead of allocating and freeing them by reference count.
+/// Graph outputs are not planned, they keep their own buffers across runs.
+class StaticMemoryPlan {
+ public:
+  StaticMemoryPlan() = default;
+  ~StaticMemoryPlan();
+
+  /// \brief plan the tensors of kernels, return RET_OK without planning when a shape is only known at run time
+  int Plan(const std::vector<kernel::LiteKernel *> &kernels, const std::vector<Tensor *> &outputs);
+
+  /// \brief point every planned tensor into the arena, drop the plan if a tensor outgrew its block
+  bool Bind();
+
+  /// \brief detach the planned tensors from the arena and free it
+  void Release();
+
+  bool planned() const { return arena_ != nullptr; }
+  size_t arena_size() const { return arena_size_; }
+  size_t planned_tensor_num() const { return blocks_.size(); }
+
+  /// \brief place blocks with overlapping lifetimes at disjoint offsets, return the arena size
+  static size_t AssignBlockOffsets(std::vector<MemoryBlock> *blocks);
+
+ private:
+  std::vector<MemoryBlock> blocks_;
+  void *arena_ = nullptr;
+  size_t arena_size_ = 0;
+};
+}  // namespace mindspore::lite
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_STATIC_MEMORY_PLAN_H_
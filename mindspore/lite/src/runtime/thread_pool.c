@@ -79,8 +79,36 @@ typedef struct ThreadPool {
   int thread_num;
   BindMode mode;
   atomic_bool is_alive;
+  atomic_bool work_stealing;
+  // serializes the queue pushes of masters launching concurrently, e.g. kernels of parallel branches
+  pthread_mutex_t launch_lock;
+  atomic_uint next_thread;
 } ThreadPool;
 
+// the task ids [next, end) not yet claimed from one participant's share
+typedef struct {
+  atomic_int next;
+  int end;
+} TaskRange;
+
+// A launch whose task ids are self-scheduled: every participant claims ids from its own range first and then steals
+// the rest from the others, so a slow thread only delays the ids it has already claimed. It is freed by whichever
+// participant drops the last reference, so a thread that picks it up late never touches freed memory.
+typedef struct {
+  Task task;
+  int (*func)(void *arg, int);
+  void *content;
+  int task_num;
+  int range_num;
+  TaskRange *ranges;
+  atomic_int finished;
+  atomic_int ref_count;
+  atomic_bool has_error;
+  bool done;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+} ChunkedTask;
+
 Thread *GetThread(struct ThreadPool *thread_pool, int thread_id) {
   if (thread_pool == NULL) {
     LOG_ERROR("get thread pool instane failed, thread_id: %d", thread_id);
@@ -473,6 +501,7 @@ int DistributeTask(struct ThreadPool *thread_pool, Task *task, int task_num) {
   }
   bool k_success_flag = false;
   int size = thread_pool->thread_num < task_num ? thread_pool->thread_num : task_num;
+  pthread_mutex_lock(&thread_pool->launch_lock);
   for (int i = 0; i < size - 1; ++i) {
     do {
       k_success_flag = true;
@@ -481,6 +510,7 @@ int DistributeTask(struct ThreadPool *thread_pool, Task *task, int task_num) {
       }
     } while (!k_success_flag);
   }
+  pthread_mutex_unlock(&thread_pool->launch_lock);
   // master thread
   if (task->func == NULL) {
     LOG_ERROR("task->func is nullptr");
@@ -492,6 +522,109 @@ int DistributeTask(struct ThreadPool *thread_pool, Task *task, int task_num) {
   return RET_TP_OK;
 }
 
+void ReleaseChunkedTask(ChunkedTask *chunked_task) {
+  if (atomic_fetch_sub_explicit(&chunked_task->ref_count, 1, memory_order_acq_rel) != 1) {
+    return;
+  }
+  pthread_cond_destroy(&chunked_task->cond);
+  pthread_mutex_destroy(&chunked_task->lock);
+  free(chunked_task->ranges);
+  free(chunked_task);
+}
+
+bool RunOneChunk(ChunkedTask *chunked_task, TaskRange *range) {
+  int task_id = atomic_fetch_add_explicit(&range->next, 1, memory_order_relaxed);
+  if (task_id >= range->end) {
+    return false;
+  }
+  if (chunked_task->func(chunked_task->content, task_id) != 0) {
+    chunked_task->has_error = true;
+  }
+  if (atomic_fetch_add_explicit(&chunked_task->finished, 1, memory_order_acq_rel) + 1 == chunked_task->task_num) {
+    pthread_mutex_lock(&chunked_task->lock);
+    chunked_task->done = true;
+    pthread_cond_broadcast(&chunked_task->cond);
+    pthread_mutex_unlock(&chunked_task->lock);
+  }
+  return true;
+}
+
+int RunChunkedTask(void *content, int thread_id) {
+  ChunkedTask *chunked_task = (ChunkedTask *)content;
+  int range_num = chunked_task->range_num;
+  // own range first, then steal from the others starting with the next participant
+  for (int i = 0; i < range_num; ++i) {
+    TaskRange *range = &chunked_task->ranges[(thread_id + i) % range_num];
+    while (RunOneChunk(chunked_task, range)) {
+    }
+  }
+  ReleaseChunkedTask(chunked_task);
+  return RET_TP_OK;
+}
+
+int DistributeChunkedTask(struct ThreadPool *thread_pool, int func(void *, int), void *content, int task_num) {
+  int size = thread_pool->thread_num < task_num ? thread_pool->thread_num : task_num;
+  ChunkedTask *chunked_task = (ChunkedTask *)malloc(sizeof(ChunkedTask));
+  if (chunked_task == NULL) {
+    LOG_ERROR("malloc chunked task failed");
+    return RET_TP_ERROR;
+  }
+  chunked_task->ranges = (TaskRange *)malloc(size * sizeof(TaskRange));
+  if (chunked_task->ranges == NULL) {
+    LOG_ERROR("malloc task ranges failed");
+    free(chunked_task);
+    return RET_TP_ERROR;
+  }
+  int base = task_num / size;
+  int remain = task_num % size;
+  int begin = 0;
+  for (int i = 0; i < size; ++i) {
+    int end = begin + base + (i < remain ? 1 : 0);
+    atomic_init(&chunked_task->ranges[i].next, begin);
+    chunked_task->ranges[i].end = end;
+    begin = end;
+  }
+  chunked_task->task.func = RunChunkedTask;
+  chunked_task->task.content = chunked_task;
+  chunked_task->func = func;
+  chunked_task->content = content;
+  chunked_task->task_num = task_num;
+  chunked_task->range_num = size;
+  atomic_init(&chunked_task->finished, 0);
+  atomic_init(&chunked_task->ref_count, size);
+  atomic_init(&chunked_task->has_error, false);
+  chunked_task->done = false;
+  pthread_mutex_init(&chunked_task->lock, NULL);
+  pthread_cond_init(&chunked_task->cond, NULL);
+
+  // start after the threads of the previous launch, and leave a thread whose queue is still full to the others:
+  // its range gets stolen, so concurrent launches spread over the pool instead of waiting for the same threads
+  int worker_num = thread_pool->thread_num - 1;
+  int first_thread =
+    (int)(atomic_fetch_add_explicit(&thread_pool->next_thread, size - 1, memory_order_relaxed) % (unsigned)worker_num);
+  pthread_mutex_lock(&thread_pool->launch_lock);
+  for (int i = 0; i < size - 1; ++i) {
+    if (!PushTaskToQueue(thread_pool, (first_thread + i) % worker_num, &chunked_task->task)) {
+      ReleaseChunkedTask(chunked_task);
+    }
+  }
+  pthread_mutex_unlock(&thread_pool->launch_lock);
+  // master thread takes the last range, then sleeps until every task id has finished
+  for (int i = 0; i < size; ++i) {
+    TaskRange *range = &chunked_task->ranges[(size - 1 + i) % size];
+    while (RunOneChunk(chunked_task, range)) {
+    }
+  }
+  pthread_mutex_lock(&chunked_task->lock);
+  while (!chunked_task->done) {
+    pthread_cond_wait(&chunked_task->cond, &chunked_task->lock);
+  }
+  pthread_mutex_unlock(&chunked_task->lock);
+  int ret = chunked_task->has_error ? RET_TP_ERROR : RET_TP_OK;
+  ReleaseChunkedTask(chunked_task);
+  return ret;
+}
+
 int AddTask(struct ThreadPool *thread_pool, int func(void *, int), void *content, int task_num) {
   if (thread_pool == NULL) {
     LOG_ERROR("get thread pool instane failed");
@@ -504,6 +637,9 @@ int AddTask(struct ThreadPool *thread_pool, int func(void *, int), void *content
     }
     return RET_TP_OK;
   }
+  if (thread_pool->work_stealing) {
+    return DistributeChunkedTask(thread_pool, func, content, task_num);
+  }
   Task task;
   task.func = func;
   task.content = content;
@@ -653,6 +789,9 @@ ThreadPool *CreateThreadPool(int thread_num, int mode) {
   ThreadPool *thread_pool = (struct ThreadPool *)(malloc(sizeof(ThreadPool)));
   thread_pool->thread_num = thread_num > MAX_THREAD_NUM ? MAX_THREAD_NUM : thread_num;
   thread_pool->is_alive = ATOMIC_VAR_INIT(true);
+  thread_pool->work_stealing = ATOMIC_VAR_INIT(false);
+  pthread_mutex_init(&thread_pool->launch_lock, NULL);
+  atomic_init(&thread_pool->next_thread, 0);
   thread_pool->mode = mode;
   thread_pool->thread_list = NULL;
   if (thread_num > 1) {
@@ -730,6 +869,7 @@ void DestroyThreadPool(struct ThreadPool *thread_pool) {
     LOG_ERROR("get thread pool instane failed");
     return;
   }
+  pthread_mutex_destroy(&thread_pool->launch_lock);
   if (thread_pool->thread_list == NULL) {
     LOG_ERROR("thread pool's list is null");
     return;
@@ -748,6 +888,14 @@ void DestroyThreadPool(struct ThreadPool *thread_pool) {
   LOG_INFO("destroy thread pool success");
 }
 
+void SetThreadPoolWorkStealing(struct ThreadPool *thread_pool, bool enable) {
+  if (thread_pool == NULL) {
+    LOG_ERROR("get thread pool instane failed");
+    return;
+  }
+  thread_pool->work_stealing = enable;
+}
+
 int GetCurrentThreadNum(struct ThreadPool *thread_pool) {
   if (thread_pool == NULL) {
     LOG_ERROR("get thread pool instane failed");
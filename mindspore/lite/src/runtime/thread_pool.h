@@ -56,6 +56,13 @@ int ConfigThreadPool(struct ThreadPool *thread_pool, int thread_num, int mode);
  */
 int ParallelLaunch(struct ThreadPool *thread_pool, int (*job)(void *, int), void *content, int task_num);
 
+/**
+ * let ParallelLaunch accept more tasks than threads, idle threads steal the task ids not yet claimed by others
+ * and the master thread sleeps on a condition variable instead of spinning
+ * @param enable
+ */
+void SetThreadPoolWorkStealing(struct ThreadPool *thread_pool, bool enable);
+
 /**
  * bind each thread to specified cpu core
  * @param is_bind
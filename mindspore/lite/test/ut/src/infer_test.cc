@@ -15,7 +15,11 @@
  */
 
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <string>
+#include <vector>
 #include "mindspore/lite/schema/inner/model_generated.h"
 #include "mindspore/lite/include/model.h"
 #include "common/common_test.h"
@@ -234,6 +238,385 @@ TEST_F(InferTest, TestAddNode) {
   MS_LOG(INFO) << "Passed";
 }
 
+TEST_F(InferTest, TestImportFromFile) {
+  auto meta_graph = std::make_shared<schema::MetaGraphT>();
+  meta_graph->name = "graph";
+
+  auto node = std::make_unique<schema::CNodeT>();
+  node->inputIndex = {0, 1};
+  node->outputIndex = {2};
+  node->primitive = std::make_unique<schema::PrimitiveT>();
+  node->primitive->value.type = schema::PrimitiveType_Add;
+  auto primitive = new schema::AddT;
+  node->primitive->value.value = primitive;
+  node->name = "Add";
+  meta_graph->nodes.emplace_back(std::move(node));
+  meta_graph->inputIndex = {0};
+  meta_graph->outputIndex = {2};
+
+  auto input0 = std::make_unique<schema::TensorT>();
+  input0->nodeType = schema::NodeType::NodeType_ValueNode;
+  input0->format = schema::Format_NHWC;
+  input0->dataType = TypeId::kNumberTypeFloat32;
+  input0->dims = {1, 2, 2, 3};
+  input0->offset = -1;
+  meta_graph->allTensors.emplace_back(std::move(input0));
+
+  const int element_num = 12;
+  auto weight = std::make_unique<schema::TensorT>();
+  weight->nodeType = schema::NodeType::NodeType_ValueNode;
+  weight->format = schema::Format_NHWC;
+  weight->dataType = TypeId::kNumberTypeFloat32;
+  weight->dims = {1, 2, 2, 3};
+  weight->data.resize(sizeof(float) * element_num);
+  auto weight_data = reinterpret_cast<float *>(weight->data.data());
+  for (int i = 0; i < element_num; ++i) {
+    weight_data[i] = i * 0.5f;
+  }
+  weight->offset = -1;
+  meta_graph->allTensors.emplace_back(std::move(weight));
+
+  auto output = std::make_unique<schema::TensorT>();
+  output->nodeType = schema::NodeType::NodeType_Parameter;
+  output->format = schema::Format_NHWC;
+  output->dataType = TypeId::kNumberTypeFloat32;
+  output->offset = -1;
+  meta_graph->allTensors.emplace_back(std::move(output));
+
+  flatbuffers::FlatBufferBuilder builder(1024);
+  auto offset = schema::MetaGraph::Pack(builder, meta_graph.get());
+  builder.Finish(offset);
+  size_t size = builder.GetSize();
+  std::string model_path = "./test_import_from_file.ms";
+  std::ofstream ofs(model_path, std::ofstream::binary);
+  ofs.write(reinterpret_cast<char *>(builder.GetBufferPointer()), size);
+  ofs.close();
+
+  auto model = lite::Model::ImportFromFile(model_path.c_str());
+  ASSERT_NE(nullptr, model);
+  ASSERT_EQ(size, model->mmap_size_);
+  auto context = new lite::InnerContext;
+  context->cpu_bind_mode_ = lite::NO_BIND;
+  context->device_type_ = lite::DT_CPU;
+  context->thread_num_ = 2;
+  ASSERT_EQ(lite::RET_OK, context->Init());
+  auto session = session::LiteSession::CreateSession(context);
+  ASSERT_NE(nullptr, session);
+  ASSERT_EQ(lite::RET_OK, session->CompileGraph(model));
+  // the mapping stays valid for the constant tensors after Free
+  model->Free();
+  ASSERT_NE(nullptr, model->buf);
+
+  auto inputs = session->GetInputs();
+  ASSERT_EQ(inputs.size(), 1);
+  auto in_data = reinterpret_cast<float *>(inputs.front()->MutableData());
+  ASSERT_NE(nullptr, in_data);
+  for (int i = 0; i < element_num; ++i) {
+    in_data[i] = 1.0f;
+  }
+  ASSERT_EQ(lite::RET_OK, session->RunGraph());
+  auto outputs = session->GetOutputs();
+  ASSERT_EQ(outputs.size(), 1);
+  auto out_data = reinterpret_cast<float *>(outputs.begin()->second->MutableData());
+  ASSERT_NE(nullptr, out_data);
+  for (int i = 0; i < element_num; ++i) {
+    ASSERT_LE(std::fabs(out_data[i] - (1.0f + i * 0.5f)), 0.0001);
+  }
+  delete session;
+  delete model;
+  std::remove(model_path.c_str());
+}
+
+TEST_F(InferTest, TestStaticMemoryPlan) {
+  auto meta_graph = std::make_shared<schema::MetaGraphT>();
+  meta_graph->name = "graph";
+  // input(0) + weight(1) -> tensor(2), tensor(2) + weight(1) -> output(3)
+  for (uint32_t i = 0; i < 2; ++i) {
+    auto node = std::make_unique<schema::CNodeT>();
+    node->inputIndex = {i == 0 ? 0u : 2u, 1};
+    node->outputIndex = {i == 0 ? 2u : 3u};
+    node->primitive = std::make_unique<schema::PrimitiveT>();
+    node->primitive->value.type = schema::PrimitiveType_Add;
+    node->primitive->value.value = new schema::AddT;
+    node->name = "Add" + std::to_string(i);
+    meta_graph->nodes.emplace_back(std::move(node));
+  }
+  meta_graph->inputIndex = {0};
+  meta_graph->outputIndex = {3};
+
+  const int element_num = 12;
+  for (int i = 0; i < 4; ++i) {
+    auto tensor = std::make_unique<schema::TensorT>();
+    tensor->nodeType = i < 2 ? schema::NodeType::NodeType_ValueNode : schema::NodeType::NodeType_Parameter;
+    tensor->format = schema::Format_NHWC;
+    tensor->dataType = TypeId::kNumberTypeFloat32;
+    tensor->dims = {1, 2, 2, 3};
+    if (i == 1) {
+      tensor->data.resize(sizeof(float) * element_num);
+      auto weight_data = reinterpret_cast<float *>(tensor->data.data());
+      for (int j = 0; j < element_num; ++j) {
+        weight_data[j] = j;
+      }
+    }
+    tensor->offset = -1;
+    meta_graph->allTensors.emplace_back(std::move(tensor));
+  }
+
+  flatbuffers::FlatBufferBuilder builder(1024);
+  auto offset = schema::MetaGraph::Pack(builder, meta_graph.get());
+  builder.Finish(offset);
+  auto model = lite::Model::Import(reinterpret_cast<char *>(builder.GetBufferPointer()), builder.GetSize());
+  ASSERT_NE(nullptr, model);
+  auto context = new lite::InnerContext;
+  context->cpu_bind_mode_ = lite::NO_BIND;
+  context->device_type_ = lite::DT_CPU;
+  context->thread_num_ = 2;
+  ASSERT_EQ(lite::RET_OK, context->Init());
+  auto allocator = context->allocator;
+  auto session = session::LiteSession::CreateSession(context);
+  ASSERT_NE(nullptr, session);
+  ASSERT_EQ(lite::RET_OK, session->CompileGraph(model));
+
+  auto inputs = session->GetInputs();
+  ASSERT_EQ(inputs.size(), 1);
+  auto in_data = reinterpret_cast<float *>(inputs.front()->MutableData());
+  ASSERT_NE(nullptr, in_data);
+  for (int i = 0; i < element_num; ++i) {
+    in_data[i] = 1.0f;
+  }
+  // the first run allocates the graph output, later runs only bind the planned tensors
+  ASSERT_EQ(lite::RET_OK, session->RunGraph());
+  auto malloc_count = allocator->GetMallocCount();
+  auto free_count = allocator->GetFreeCount();
+  for (int run = 0; run < 3; ++run) {
+    ASSERT_EQ(lite::RET_OK, session->RunGraph());
+  }
+  EXPECT_EQ(malloc_count, allocator->GetMallocCount());
+  EXPECT_EQ(free_count, allocator->GetFreeCount());
+
+  auto outputs = session->GetOutputs();
+  ASSERT_EQ(outputs.size(), 1);
+  auto out_data = reinterpret_cast<float *>(outputs.begin()->second->MutableData());
+  ASSERT_NE(nullptr, out_data);
+  for (int i = 0; i < element_num; ++i) {
+    ASSERT_LE(std::fabs(out_data[i] - (1.0f + 2.0f * i)), 0.0001);
+  }
+  delete session;
+  delete model;
+}
+
+TEST_F(InferTest, TestInterOpParallel) {
+  auto meta_graph = std::make_shared<schema::MetaGraphT>();
+  meta_graph->name = "graph";
+  // two independent branches input(0) + weight(1) -> 2 and 3, joined by 2 + 3 -> output(4)
+  std::vector<std::vector<uint32_t>> node_inputs{{0, 1}, {0, 1}, {2, 3}};
+  for (uint32_t i = 0; i < node_inputs.size(); ++i) {
+    auto node = std::make_unique<schema::CNodeT>();
+    node->inputIndex = node_inputs[i];
+    node->outputIndex = {i + 2};
+    node->primitive = std::make_unique<schema::PrimitiveT>();
+    node->primitive->value.type = schema::PrimitiveType_Add;
+    node->primitive->value.value = new schema::AddT;
+    node->name = "Add" + std::to_string(i);
+    meta_graph->nodes.emplace_back(std::move(node));
+  }
+  meta_graph->inputIndex = {0};
+  meta_graph->outputIndex = {4};
+
+  const int element_num = 1 * 16 * 16 * 8;
+  for (int i = 0; i < 5; ++i) {
+    auto tensor = std::make_unique<schema::TensorT>();
+    tensor->nodeType = i < 2 ? schema::NodeType::NodeType_ValueNode : schema::NodeType::NodeType_Parameter;
+    tensor->format = schema::Format_NHWC;
+    tensor->dataType = TypeId::kNumberTypeFloat32;
+    tensor->dims = {1, 16, 16, 8};
+    if (i == 1) {
+      tensor->data.resize(sizeof(float) * element_num);
+      auto weight_data = reinterpret_cast<float *>(tensor->data.data());
+      for (int j = 0; j < element_num; ++j) {
+        weight_data[j] = j % 7;
+      }
+    }
+    tensor->offset = -1;
+    meta_graph->allTensors.emplace_back(std::move(tensor));
+  }
+
+  flatbuffers::FlatBufferBuilder builder(1024);
+  auto offset = schema::MetaGraph::Pack(builder, meta_graph.get());
+  builder.Finish(offset);
+  auto model = lite::Model::Import(reinterpret_cast<char *>(builder.GetBufferPointer()), builder.GetSize());
+  ASSERT_NE(nullptr, model);
+  lite::Context context;
+  context.cpu_bind_mode_ = lite::NO_BIND;
+  context.device_type_ = lite::DT_CPU;
+  context.thread_num_ = 4;
+  context.inter_op_parallel_num_ = 2;
+  auto session = session::LiteSession::CreateSession(&context);
+  ASSERT_NE(nullptr, session);
+  ASSERT_EQ(lite::RET_OK, session->CompileGraph(model));
+
+  auto inputs = session->GetInputs();
+  ASSERT_EQ(inputs.size(), 1);
+  auto in_data = reinterpret_cast<float *>(inputs.front()->MutableData());
+  ASSERT_NE(nullptr, in_data);
+  for (int i = 0; i < element_num; ++i) {
+    in_data[i] = 1.0f;
+  }
+  for (int run = 0; run < 3; ++run) {
+    ASSERT_EQ(lite::RET_OK, session->RunGraph());
+    auto outputs = session->GetOutputs();
+    ASSERT_EQ(outputs.size(), 1);
+    auto out_data = reinterpret_cast<float *>(outputs.begin()->second->MutableData());
+    ASSERT_NE(nullptr, out_data);
+    for (int i = 0; i < element_num; ++i) {
+      ASSERT_LE(std::fabs(out_data[i] - 2.0f * (1.0f + i % 7)), 0.0001);
+    }
+  }
+  delete session;
+  delete model;
+}
+
+TEST_F(InferTest, TestImportFromFileTwoSessions) {
+  auto meta_graph = std::make_shared<schema::MetaGraphT>();
+  meta_graph->name = "graph";
+
+  // conv weight 1 is repacked and stays in the mapping, add operand 3 is copied by each session
+  auto conv = std::make_unique<schema::CNodeT>();
+  conv->inputIndex = {0, 1};
+  conv->outputIndex = {2};
+  conv->primitive = std::make_unique<schema::PrimitiveT>();
+  conv->primitive->value.type = schema::PrimitiveType_Conv2D;
+  auto conv_primitive = new schema::Conv2DT;
+  conv_primitive->padMode = schema::PadMode_SAME_UPPER;
+  conv_primitive->channelIn = 3;
+  conv_primitive->channelOut = 4;
+  conv_primitive->format = schema::Format_NHWC;
+  conv_primitive->strideH = 1;
+  conv_primitive->strideW = 1;
+  conv_primitive->kernelH = 3;
+  conv_primitive->kernelW = 3;
+  conv_primitive->dilateH = 1;
+  conv_primitive->dilateW = 1;
+  conv->primitive->value.value = conv_primitive;
+  conv->name = "Conv2D";
+  meta_graph->nodes.emplace_back(std::move(conv));
+
+  auto add = std::make_unique<schema::CNodeT>();
+  add->inputIndex = {2, 3};
+  add->outputIndex = {4};
+  add->primitive = std::make_unique<schema::PrimitiveT>();
+  add->primitive->value.type = schema::PrimitiveType_Add;
+  add->primitive->value.value = new schema::AddT;
+  add->name = "Add";
+  meta_graph->nodes.emplace_back(std::move(add));
+  meta_graph->inputIndex = {0};
+  meta_graph->outputIndex = {4};
+
+  auto input0 = std::make_unique<schema::TensorT>();
+  input0->nodeType = schema::NodeType::NodeType_ValueNode;
+  input0->format = schema::Format_NHWC;
+  input0->dataType = TypeId::kNumberTypeFloat32;
+  input0->dims = {1, 8, 8, 3};
+  input0->offset = -1;
+  meta_graph->allTensors.emplace_back(std::move(input0));
+
+  const int weight_num = 4 * 3 * 3 * 3;
+  auto weight = std::make_unique<schema::TensorT>();
+  weight->nodeType = schema::NodeType::NodeType_ValueNode;
+  weight->format = schema::Format_KHWC;
+  weight->dataType = TypeId::kNumberTypeFloat32;
+  weight->dims = {4, 3, 3, 3};
+  weight->data.resize(sizeof(float) * weight_num);
+  auto weight_data = reinterpret_cast<float *>(weight->data.data());
+  for (int i = 0; i < weight_num; ++i) {
+    weight_data[i] = (i % 7 - 3) * 0.25f;
+  }
+  weight->offset = -1;
+  meta_graph->allTensors.emplace_back(std::move(weight));
+
+  auto conv_out = std::make_unique<schema::TensorT>();
+  conv_out->nodeType = schema::NodeType::NodeType_Parameter;
+  conv_out->format = schema::Format_NHWC;
+  conv_out->dataType = TypeId::kNumberTypeFloat32;
+  conv_out->offset = -1;
+  meta_graph->allTensors.emplace_back(std::move(conv_out));
+
+  const int out_num = 8 * 8 * 4;
+  auto addend = std::make_unique<schema::TensorT>();
+  addend->nodeType = schema::NodeType::NodeType_ValueNode;
+  addend->format = schema::Format_NHWC;
+  addend->dataType = TypeId::kNumberTypeFloat32;
+  addend->dims = {1, 8, 8, 4};
+  addend->data.resize(sizeof(float) * out_num);
+  auto addend_data = reinterpret_cast<float *>(addend->data.data());
+  for (int i = 0; i < out_num; ++i) {
+    addend_data[i] = i * 0.125f;
+  }
+  addend->offset = -1;
+  meta_graph->allTensors.emplace_back(std::move(addend));
+
+  auto output = std::make_unique<schema::TensorT>();
+  output->nodeType = schema::NodeType::NodeType_Parameter;
+  output->format = schema::Format_NHWC;
+  output->dataType = TypeId::kNumberTypeFloat32;
+  output->offset = -1;
+  meta_graph->allTensors.emplace_back(std::move(output));
+
+  flatbuffers::FlatBufferBuilder builder(1024);
+  auto offset = schema::MetaGraph::Pack(builder, meta_graph.get());
+  builder.Finish(offset);
+  size_t size = builder.GetSize();
+  std::string model_path = "./test_import_from_file_two_sessions.ms";
+  std::ofstream ofs(model_path, std::ofstream::binary);
+  ofs.write(reinterpret_cast<char *>(builder.GetBufferPointer()), size);
+  ofs.close();
+
+  auto model = lite::Model::ImportFromFile(model_path.c_str());
+  ASSERT_NE(nullptr, model);
+  session::LiteSession *sessions[2];
+  for (auto &session : sessions) {
+    auto context = new lite::InnerContext;
+    context->cpu_bind_mode_ = lite::NO_BIND;
+    context->device_type_ = lite::DT_CPU;
+    context->thread_num_ = 2;
+    ASSERT_EQ(lite::RET_OK, context->Init());
+    session = session::LiteSession::CreateSession(context);
+    ASSERT_NE(nullptr, session);
+    ASSERT_EQ(lite::RET_OK, session->CompileGraph(model));
+  }
+  model->Free();
+
+  // run the first session twice, so the second one starts after every kernel of the first has run
+  std::vector<float> outs[3];
+  session::LiteSession *runs[3] = {sessions[0], sessions[0], sessions[1]};
+  for (int run = 0; run < 3; ++run) {
+    auto inputs = runs[run]->GetInputs();
+    ASSERT_EQ(inputs.size(), 1);
+    auto in_data = reinterpret_cast<float *>(inputs.front()->MutableData());
+    ASSERT_NE(nullptr, in_data);
+    for (int i = 0; i < inputs.front()->ElementsNum(); ++i) {
+      in_data[i] = (i % 5) * 0.5f;
+    }
+    ASSERT_EQ(lite::RET_OK, runs[run]->RunGraph());
+    auto outputs = runs[run]->GetOutputs();
+    ASSERT_EQ(outputs.size(), 1);
+    auto out_tensor = outputs.begin()->second;
+    ASSERT_EQ(out_num, out_tensor->ElementsNum());
+    auto out_data = reinterpret_cast<float *>(out_tensor->MutableData());
+    ASSERT_NE(nullptr, out_data);
+    outs[run].assign(out_data, out_data + out_num);
+  }
+  for (int i = 0; i < out_num; ++i) {
+    ASSERT_EQ(outs[0][i], outs[1][i]);
+    ASSERT_EQ(outs[0][i], outs[2][i]);
+  }
+  for (auto session : sessions) {
+    delete session;
+  }
+  delete model;
+  std::remove(model_path.c_str());
+}
+
 class SessionWithParallelExecutor : public lite::LiteSession {
  public:
   int Init(lite::InnerContext *context) {
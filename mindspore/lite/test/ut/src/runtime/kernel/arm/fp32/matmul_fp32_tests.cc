@@ -14,10 +14,14 @@
  * limitations under the License.
  */
 #include <iostream>
+#include <vector>
 #include "mindspore/core/utils/log_adapter.h"
 #include "common/common_test.h"
 #include "mindspore/lite/src/runtime/kernel/arm/fp32/matmul.h"
 #include "mindspore/lite/nnacl/fp32/matmul.h"
+#ifdef ENABLE_AVX
+#include "mindspore/lite/nnacl/x86_64/matmul_avx.h"
+#endif
 #include "src/kernel_registry.h"
 #include "src/lite_kernel.h"
 
@@ -350,4 +354,41 @@ TEST_F(TestMatMulFp32, batch) {
   for (auto t : inputs_) delete t;
   for (auto t : outputs_) delete t;
 }
+
+#ifdef ENABLE_AVX
+TEST_F(TestMatMulFp32, avx_kernels) {
+  if (!X86SupportAvx2()) {
+    return;
+  }
+  const int row = 13, col = 17, deep = 9;
+  int row_12 = UP_ROUND(row, C12NUM);
+  int col_8 = UP_ROUND(col, C8NUM);
+  std::vector<float> a(row_12 * deep);
+  std::vector<float> b(col_8 * deep);
+  std::vector<float> bias(col_8);
+  for (size_t i = 0; i < a.size(); ++i) a[i] = (i % 7) * 0.1f - 0.3f;
+  for (size_t i = 0; i < b.size(); ++i) b[i] = (i % 5) * 0.2f - 0.4f;
+  for (size_t i = 0; i < bias.size(); ++i) bias[i] = (i % 3) * 0.5f - 0.5f;
+  std::vector<float> correct(row * col);
+  for (int r = 0; r < row; ++r) {
+    for (int c = 0; c < col; ++c) {
+      float value = bias[c];
+      for (int d = 0; d < deep; ++d) {
+        value += a[(r / C12NUM) * deep * C12NUM + d * C12NUM + r % C12NUM] *
+                 b[(c / C8NUM) * deep * C8NUM + d * C8NUM + c % C8NUM];
+      }
+      correct[r * col + c] = value > 0 ? value : 0;
+    }
+  }
+  std::vector<float> out(row * col);
+  MatMulAvx2_12x8(a.data(), b.data(), out.data(), bias.data(), ActType_Relu, deep, row, col, col, OutType_Nhwc);
+  CompareOutputData(out.data(), correct.data(), row * col, 0.0001);
+  if (X86SupportAvx512()) {
+    std::vector<float> out512(row * col);
+    MatMulAvx512_12x16(a.data(), b.data(), out512.data(), bias.data(), ActType_Relu, deep, row, col, col,
+                       OutType_Nhwc);
+    CompareOutputData(out512.data(), correct.data(), row * col, 0.0001);
+  }
+}
+#endif
 }  // namespace mindspore
@@ -0,0 +1,68 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "include/model.h"
+#include "mindspore/lite/src/runtime/packed_weight_cache.h"
+
+namespace mindspore {
+class PackedWeightCacheTest : public mindspore::CommonTest {
+ public:
+  PackedWeightCacheTest() {}
+};
+
+TEST_F(PackedWeightCacheTest, PackOncePerLayout) {
+  lite::PackedWeightCache cache;
+  std::vector<float> origin{1, 2, 3, 4};
+  int pack_count = 0;
+  auto pack_func = [&](void *packed) {
+    auto dst = reinterpret_cast<float *>(packed);
+    for (size_t i = 0; i < origin.size(); ++i) {
+      dst[i] = origin[i] * 2;
+    }
+    pack_count++;
+    return lite::RET_OK;
+  };
+  auto weight0 = cache.GetPackedWeight(origin.data(), "layout0", 8 * sizeof(float), pack_func);
+  auto weight1 = cache.GetPackedWeight(origin.data(), "layout0", 8 * sizeof(float), pack_func);
+  ASSERT_NE(weight0, nullptr);
+  EXPECT_EQ(weight0.get(), weight1.get());
+  EXPECT_EQ(pack_count, 1);
+  auto packed = reinterpret_cast<float *>(weight0.get());
+  EXPECT_EQ(packed[3], 8);
+  EXPECT_EQ(packed[7], 0);
+
+  auto weight2 = cache.GetPackedWeight(origin.data(), "layout1", 8 * sizeof(float), pack_func);
+  EXPECT_NE(weight0.get(), weight2.get());
+  EXPECT_EQ(pack_count, 2);
+  EXPECT_EQ(cache.packed_weight_num(), 2);
+}
+
+TEST_F(PackedWeightCacheTest, ModelCacheSharedBySessions) {
+  lite::Model model;
+  model.buf = nullptr;
+  auto cache0 = lite::PackedWeightCache::GetModelCache(&model);
+  auto cache1 = lite::PackedWeightCache::GetModelCache(&model);
+  EXPECT_EQ(cache0.get(), cache1.get());
+  lite::PackedWeightCache::EraseModelCache(&model);
+  auto cache2 = lite::PackedWeightCache::GetModelCache(&model);
+  EXPECT_NE(cache0.get(), cache2.get());
+  lite::PackedWeightCache::EraseModelCache(&model);
+}
+}  // namespace mindspore
@@ -0,0 +1,104 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "mindspore/lite/src/runtime/static_memory_plan.h"
+
+namespace mindspore {
+class StaticMemoryPlanTest : public mindspore::CommonTest {
+ public:
+  StaticMemoryPlanTest() {}
+};
+
+namespace {
+void SetCpuDesc(kernel::LiteKernel *kernel) {
+  kernel->set_desc({kernel::KERNEL_ARCH::kCPU, kNumberTypeFloat32, schema::PrimitiveType_Activation});
+}
+}  // namespace
+
+// The offsets come from memreuse::AssignBestFitOffsets, which is tested with the cpu device planner. These tests
+// cover which tensors StaticMemoryPlan puts in the arena and how it binds and releases them.
+TEST_F(StaticMemoryPlanTest, PlanBindRelease) {
+  // input -> k0 -> t0 -> k1(weight) -> t1 -> k2 -> t2, side_output -> k3 -> output
+  std::vector<int> shape{1, 16, 16, 4};
+  lite::Tensor input(kNumberTypeFloat32, shape);
+  lite::Tensor weight(kNumberTypeFloat32, shape, schema::Format::Format_NHWC, lite::Tensor::Category::CONST);
+  lite::Tensor t0(kNumberTypeFloat32, shape);
+  lite::Tensor t1(kNumberTypeFloat32, shape);
+  lite::Tensor t2(kNumberTypeFloat32, shape);
+  lite::Tensor side_output(kNumberTypeFloat32, shape);
+  lite::Tensor output(kNumberTypeFloat32, shape);
+  ASSERT_EQ(input.MallocData(), lite::RET_OK);
+  ASSERT_EQ(weight.MallocData(), lite::RET_OK);
+
+  kernel::LiteKernel k0(nullptr, {&input}, {&t0}, nullptr, nullptr);
+  kernel::LiteKernel k1(nullptr, {&t0, &weight}, {&t1}, nullptr, nullptr);
+  kernel::LiteKernel k2(nullptr, {&t1}, {&t2, &side_output}, nullptr, nullptr);
+  kernel::LiteKernel k3(nullptr, {&t2}, {&output}, nullptr, nullptr);
+  std::vector<kernel::LiteKernel *> kernels{&k0, &k1, &k2, &k3};
+  for (auto kernel : kernels) {
+    SetCpuDesc(kernel);
+  }
+  k3.set_is_model_output(true);
+
+  // graph inputs, constants and graph outputs keep their own buffers
+  lite::StaticMemoryPlan plan;
+  ASSERT_EQ(plan.Plan(kernels, {&side_output}), lite::RET_OK);
+  ASSERT_TRUE(plan.planned());
+  EXPECT_EQ(plan.planned_tensor_num(), 3u);
+  EXPECT_EQ(plan.arena_size(), 2 * t0.Size());
+
+  auto input_data = input.data_c();
+  auto weight_data = weight.data_c();
+  ASSERT_TRUE(plan.Bind());
+  // t0 and t2 share a block, t1 takes the other one of the arena
+  auto t0_data = reinterpret_cast<char *>(t0.data_c());
+  auto t1_data = reinterpret_cast<char *>(t1.data_c());
+  ASSERT_NE(t0_data, nullptr);
+  ASSERT_NE(t1_data, nullptr);
+  EXPECT_EQ(t2.data_c(), t0.data_c());
+  EXPECT_EQ(static_cast<size_t>(t0_data < t1_data ? t1_data - t0_data : t0_data - t1_data), t0.Size());
+  EXPECT_EQ(input.data_c(), input_data);
+  EXPECT_EQ(weight.data_c(), weight_data);
+  EXPECT_EQ(side_output.data_c(), nullptr);
+  EXPECT_EQ(output.data_c(), nullptr);
+
+  // release detaches the tensors still in the arena, a tensor pointed elsewhere keeps its buffer
+  void *own_data = malloc(t1.Size());
+  ASSERT_NE(own_data, nullptr);
+  t1.SetData(own_data);
+  plan.Release();
+  EXPECT_FALSE(plan.planned());
+  EXPECT_EQ(plan.arena_size(), 0u);
+  EXPECT_EQ(plan.planned_tensor_num(), 0u);
+  EXPECT_EQ(t0.data_c(), nullptr);
+  EXPECT_EQ(t1.data_c(), own_data);
+  EXPECT_EQ(t2.data_c(), nullptr);
+  EXPECT_EQ(input.data_c(), input_data);
+  t1.FreeData();
+
+  // a tensor which outgrew its block drops the plan
+  ASSERT_EQ(plan.Plan(kernels, {&side_output}), lite::RET_OK);
+  ASSERT_TRUE(plan.planned());
+  t1.set_shape({1, 32, 32, 4});
+  EXPECT_FALSE(plan.Bind());
+  EXPECT_FALSE(plan.planned());
+  EXPECT_EQ(t0.data_c(), nullptr);
+}
+}  // namespace mindspore
@@ -0,0 +1,238 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "core/batch_scheduler.h"
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+#include "include/infer_log.h"
+#include "core/serving_tensor.h"
+
+namespace mindspore {
+namespace serving {
+namespace {
+const std::vector<uint64_t> kBatchSizeBounds = {1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024};
+
+size_t RowBytes(const inference::InferTensorBase &tensor) {
+  auto shape = tensor.shape();
+  size_t row_bytes = tensor.GetTypeSize(tensor.data_type());
+  for (size_t i = 1; i < shape.size(); ++i) {
+    row_bytes *= static_cast<size_t>(shape[i]);
+  }
+  return row_bytes;
+}
+}  // namespace
+
+BatchScheduler::BatchScheduler() : batch_size_histogram_(kBatchSizeBounds) {}
+
+BatchScheduler::~BatchScheduler() { Stop(); }
+
+Status BatchScheduler::Start(const std::vector<inference::InferTensor> &model_inputs, uint32_t max_batch_size,
+                             uint32_t timeout_us, ExecuteFunc execute) {
+  Stop();
+  if (max_batch_size <= 1 || model_inputs.empty() || execute == nullptr) {
+    return FAILED;
+  }
+  for (size_t i = 0; i < model_inputs.size(); ++i) {
+    auto &input = model_inputs[i];
+    auto shape = input.shape();
+    if (shape.empty() || shape[0] != static_cast<int64_t>(max_batch_size) ||
+        input.GetTypeSize(input.data_type()) == 0) {
+      MSI_LOG_WARNING << "model input " << i << " does not hold batch size "
+                      << max_batch_size << " on dim 0";
+      return FAILED;
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  model_inputs_ = model_inputs;
+  max_batch_size_ = max_batch_size;
+  timeout_ = std::chrono::microseconds(timeout_us);
+  execute_ = std::move(execute);
+  stop_ = false;
+  running_ = true;
+  worker_ = std::thread(&BatchScheduler::WorkLoop, this);
+  MSI_LOG_INFO << "dynamic batching started, max batch size " << max_batch_size << ", timeout " << timeout_us << " us";
+  return SUCCESS;
+}
+
+void BatchScheduler::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+    stop_ = true;
+  }
+  cond_.notify_all();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  running_ = false;
+}
+
+bool BatchScheduler::running() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return running_ && !stop_;
+}
+
+bool BatchScheduler::CanBatch(const PredictRequest &request) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!running_ || stop_) {
+    return false;
+  }
+  if (request.images_size() > 0 || static_cast<size_t>(request.data_size()) != model_inputs_.size()) {
+    return false;
+  }
+  ServingRequest serving_request(request);
+  for (size_t i = 0; i < model_inputs_.size(); ++i) {
+    auto tensor = serving_request[i];
+    if (tensor == nullptr || tensor->data_type() != model_inputs_[i].data_type()) {
+      return false;
+    }
+    auto shape = tensor->shape();
+    auto model_shape = model_inputs_[i].shape();
+    if (shape.size() != model_shape.size() || shape[0] < 1 || shape[0] >= static_cast<int64_t>(max_batch_size_)) {
+      return false;
+    }
+    if (!std::equal(shape.begin() + 1, shape.end(), model_shape.begin() + 1)) {
+      return false;
+    }
+    if (tensor->data_size() != RowBytes(*tensor) * static_cast<size_t>(shape[0])) {
+      return false;
+    }
+  }
+  // every input must agree on the batch size of the request
+  auto batch_size = request.data(0).tensor_shape().dims(0);
+  for (auto &tensor : request.data()) {
+    if (tensor.tensor_shape().dims(0) != batch_size) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Status BatchScheduler::Predict(const PredictRequest &request, PredictReply &reply) {
+  auto task = std::make_shared<BatchTask>();
+  task->request = &request;
+  task->reply = &reply;
+  task->batch_size = static_cast<uint32_t>(request.data(0).tensor_shape().dims(0));
+  task->enqueue_time = std::chrono::steady_clock::now();
+  auto result = task->promise.get_future();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_ || stop_) {
+      MSI_LOG_ERROR << "the batch scheduler has been stopped";
+      return FAILED;
+    }
+    tasks_.push_back(task);
+    queued_batch_size_ += task->batch_size;
+  }
+  cond_.notify_one();
+  return result.get();
+}
+
+void BatchScheduler::WorkLoop() {
+  while (true) {
+    std::vector<BatchTaskPtr> tasks;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cond_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      // the oldest request decides how long the batch may wait for more requests
+      auto deadline = tasks_.front()->enqueue_time + timeout_;
+      cond_.wait_until(lock, deadline, [this] { return stop_ || queued_batch_size_ >= max_batch_size_; });
+      uint32_t batch_size = 0;
+      while (!tasks_.empty() && batch_size + tasks_.front()->batch_size <= max_batch_size_) {
+        batch_size += tasks_.front()->batch_size;
+        tasks.push_back(tasks_.front());
+        tasks_.pop_front();
+      }
+      queued_batch_size_ -= batch_size;
+    }
+    RunBatch(tasks);
+  }
+}
+
+void BatchScheduler::RunBatch(const std::vector<BatchTaskPtr> &tasks) {
+  Status status(SUCCESS);
+  try {
+    PredictRequest request;
+    PredictReply reply;
+    MergeRequests(tasks, &request);
+    status = execute_(request, reply);
+    if (status == SUCCESS) {
+      status = SplitReply(reply, tasks);
+    }
+  } catch (const std::exception &ex) {
+    MSI_LOG_ERROR << "Serving Error: run batch failed: " << ex.what();
+    status = FAILED;
+  }
+  batch_size_histogram_.Observe(tasks.size());
+  for (auto &task : tasks) {
+    task->promise.set_value(status);
+  }
+}
+
+void BatchScheduler::MergeRequests(const std::vector<BatchTaskPtr> &tasks, PredictRequest *request) const {
+  for (size_t i = 0; i < model_inputs_.size(); ++i) {
+    auto &model_input = model_inputs_[i];
+    auto tensor = request->add_data();
+    tensor->set_tensor_type(tasks.front()->request->data(i).tensor_type());
+    for (auto dim : model_input.shape()) {
+      tensor->mutable_tensor_shape()->add_dims(dim);
+    }
+    auto data = tensor->mutable_data();
+    data->reserve(RowBytes(model_input) * max_batch_size_);
+    for (auto &task : tasks) {
+      data->append(task->request->data(i).data());
+    }
+    // the rows no request filled are padded with zero
+    data->resize(RowBytes(model_input) * max_batch_size_, '\0');
+  }
+}
+
+Status BatchScheduler::SplitReply(const PredictReply &reply, const std::vector<BatchTaskPtr> &tasks) const {
+  for (auto &task : tasks) {
+    task->reply->clear_result();
+  }
+  for (auto &result : reply.result()) {
+    auto &dims = result.tensor_shape().dims();
+    if (dims.empty() || dims[0] != static_cast<int64_t>(max_batch_size_) ||
+        result.data().size() % max_batch_size_ != 0) {
+      MSI_LOG_ERROR << "Serving Error: model output can not be split by batch size " << max_batch_size_;
+      return FAILED;
+    }
+    size_t row_bytes = result.data().size() / max_batch_size_;
+    size_t offset = 0;
+    for (auto &task : tasks) {
+      auto tensor = task->reply->add_result();
+      tensor->set_tensor_type(result.tensor_type());
+      tensor->mutable_tensor_shape()->add_dims(task->batch_size);
+      for (int i = 1; i < dims.size(); ++i) {
+        tensor->mutable_tensor_shape()->add_dims(dims[i]);
+      }
+      tensor->set_data(result.data().substr(offset, row_bytes * task->batch_size));
+      offset += row_bytes * task->batch_size;
+    }
+  }
+  return SUCCESS;
+}
+}  // namespace serving
+}  // namespace mindspore
@@ -0,0 +1,92 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_SERVING_BATCH_SCHEDULER_H_
+#define MINDSPORE_SERVING_BATCH_SCHEDULER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "util/status.h"
+#include "util/histogram.h"
+#include "include/infer_tensor.h"
+#include "serving/ms_service.pb.h"
+
+namespace mindspore {
+namespace serving {
+using ms_serving::PredictReply;
+using ms_serving::PredictRequest;
+
+// Coalesces the data requests of concurrent callers into one request of the model batch size, runs it once and
+// scatters the outputs back to the callers. The model must take the batch on dim 0 of every input and output.
+class BatchScheduler {
+ public:
+  using ExecuteFunc = std::function<Status(const PredictRequest &request, PredictReply &reply)>;
+
+  BatchScheduler();
+  ~BatchScheduler();
+
+  // model_inputs describes the inputs of a model compiled with max_batch_size on dim 0.
+  Status Start(const std::vector<inference::InferTensor> &model_inputs, uint32_t max_batch_size, uint32_t timeout_us,
+               ExecuteFunc execute);
+  // Pending requests are still executed before the worker exits.
+  void Stop();
+  bool running() const;
+  // Only requests whose tensors match the model inputs except for a smaller dim 0 can be batched.
+  bool CanBatch(const PredictRequest &request) const;
+  // Block until the batch holding the request has been executed.
+  Status Predict(const PredictRequest &request, PredictReply &reply);
+  // The number of requests merged into each execution.
+  const Histogram &batch_size_histogram() const { return batch_size_histogram_; }
+
+ private:
+  struct BatchTask {
+    const PredictRequest *request = nullptr;
+    PredictReply *reply = nullptr;
+    uint32_t batch_size = 0;
+    std::chrono::steady_clock::time_point enqueue_time;
+    std::promise<Status> promise;
+  };
+  using BatchTaskPtr = std::shared_ptr<BatchTask>;
+
+  void WorkLoop();
+  void RunBatch(const std::vector<BatchTaskPtr> &tasks);
+  void MergeRequests(const std::vector<BatchTaskPtr> &tasks, PredictRequest *request) const;
+  Status SplitReply(const PredictReply &reply, const std::vector<BatchTaskPtr> &tasks) const;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cond_;
+  std::deque<BatchTaskPtr> tasks_;
+  uint32_t queued_batch_size_ = 0;
+  bool running_ = false;
+  bool stop_ = false;
+  std::thread worker_;
+
+  std::vector<inference::InferTensor> model_inputs_;
+  uint32_t max_batch_size_ = 1;
+  std::chrono::microseconds timeout_{0};
+  ExecuteFunc execute_;
+  Histogram batch_size_histogram_;
+};
+}  // namespace serving
+}  // namespace mindspore
+
+#endif  // MINDSPORE_SERVING_BATCH_SCHEDULER_H_
@@ -538,6 +538,30 @@ Status HttpHandleMsgDetail(struct evhttp_request *const req, void *const arg, st
   return SUCCESS;
 }
 
+json HistogramToJson(const Histogram &histogram) {
+  json js;
+  js["bounds"] = histogram.bounds();
+  js["counts"] = histogram.counts();
+  js["count"] = histogram.count();
+  js["sum"] = histogram.sum();
+  return js;
+}
+
+void http_handler_metrics(struct evhttp_request *const req, void *const arg) {
+  struct evbuffer *retbuff = evbuffer_new();
+  if (retbuff == nullptr) {
+    MSI_LOG_ERROR << "Create event buffer failed";
+    return;
+  }
+  json metrics;
+  metrics["latency_us"] = HistogramToJson(Session::Instance().latency_histogram());
+  metrics["batch_size"] = HistogramToJson(Session::Instance().batch_size_histogram());
+  const std::string &out_str = metrics.dump();
+  evbuffer_add(retbuff, out_str.data(), out_str.size());
+  evhttp_send_reply(req, HTTP_OK, "Client", retbuff);
+  evbuffer_free(retbuff);
+}
+
 void http_handler_msg(struct evhttp_request *const req, void *const arg) {
   MSI_TIME_STAMP_START(TotalRestfulPredict)
   struct evbuffer *retbuff = evbuffer_new();
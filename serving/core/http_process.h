@@ -24,6 +24,8 @@
 namespace mindspore {
 namespace serving {
 void http_handler_msg(struct evhttp_request *req, void *arg);
+// reply the latency and batch size histograms of the session as json
+void http_handler_metrics(struct evhttp_request *req, void *arg);
 }  // namespace serving
 }  // namespace mindspore
 #endif  // MINDSPORE_SERVER_H
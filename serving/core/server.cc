@@ -211,6 +211,7 @@ Status Server::BuildAndStart() {
 
   evhttp_set_timeout(http_server, 60);
   evhttp_set_gencb(http_server, http_handler_msg, nullptr);
+  evhttp_set_cb(http_server, "/metrics", http_handler_metrics, nullptr);
 
   // grpc server
   MSServiceImpl ms_service;
@@ -35,6 +35,13 @@ using ms_serving::PredictRequest;
 
 namespace mindspore {
 namespace serving {
+namespace {
+const std::vector<uint64_t> kLatencyBoundsUs = {100,   200,    500,    1000,   2000,   5000,    10000,
+                                                20000, 50000,  100000, 200000, 500000, 1000000, 2000000};
+}  // namespace
+
+Session::Session() : latency_histogram_(kLatencyBoundsUs) {}
+
 Status Session::CreatDeviceSession(const std::string &device, uint32_t device_id) {
   session_ = inference::InferSession::CreateSession(device, device_id);
   if (session_ == nullptr) {
@@ -52,7 +59,10 @@ Session &Session::Instance() {
 
 Status Session::Predict(const PredictRequest &request, PredictReply &reply) {
   try {
+    auto start = std::chrono::steady_clock::now();
     auto status = PredictInner(request, reply);
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    latency_histogram_.Observe(static_cast<uint64_t>(cost.count()));
     return status;
   } catch (const std::bad_alloc &ex) {
     MSI_LOG(ERROR) << "Serving Error: malloc memory failed";
@@ -79,6 +89,13 @@ Status Session::PredictInner(const PredictRequest &request, PredictReply &reply)
     MSI_LOG(ERROR) << "the inference session has not be initialized";
     return FAILED;
   }
+  if (batch_scheduler_.CanBatch(request)) {
+    return batch_scheduler_.Predict(request, reply);
+  }
+  return ExecuteRequest(request, reply);
+}
+
+Status Session::ExecuteRequest(const PredictRequest &request, PredictReply &reply) {
   std::lock_guard<std::mutex> lock(mutex_);
   MSI_LOG(INFO) << "run Predict";
 
@@ -110,7 +127,9 @@ Status Session::Warmup(const MindSporeModelPtr model) {
     MSI_LOG(ERROR) << "The CreatDeviceSession should be called, before warmup";
     return FAILED;
   }
-  std::lock_guard<std::mutex> lock(mutex_);
+  // the scheduler runs batches under mutex_, so it must be stopped before the lock is taken
+  batch_scheduler_.Stop();
+  std::unique_lock<std::mutex> lock(mutex_);
   std::string file_name = model->GetModelPath() + '/' + model->GetModelName();
   model_loaded_ = false;
   MSI_TIME_STAMP_START(LoadModelFromFile)
@@ -121,11 +140,32 @@ Status Session::Warmup(const MindSporeModelPtr model) {
     return ret;
   }
   model_loaded_ = true;
+  lock.unlock();
+  StartBatchScheduler();
   MSI_LOG(INFO) << "Session Warmup finished";
   return SUCCESS;
 }
 
+void Session::StartBatchScheduler() {
+  auto option_args = Options::Instance().GetArgs();
+  if (option_args->max_batch_size <= 1) {
+    return;
+  }
+  std::vector<inference::InferTensor> model_inputs;
+  if (GetModelInputsInfo(model_inputs) != SUCCESS) {
+    MSI_LOG(WARNING) << "get model inputs info failed, dynamic batching is disabled";
+    return;
+  }
+  auto execute = [this](const PredictRequest &request, PredictReply &reply) { return ExecuteRequest(request, reply); };
+  auto ret = batch_scheduler_.Start(model_inputs, option_args->max_batch_size, option_args->batch_timeout_us, execute);
+  if (ret != SUCCESS) {
+    MSI_LOG(WARNING) << "the model does not support batch size " << option_args->max_batch_size
+                     << ", dynamic batching is disabled";
+  }
+}
+
 Status Session::Clear() {
+  batch_scheduler_.Stop();
   if (session_ != nullptr) {
     session_->UnloadModel(graph_id_);
     session_->FinalizeEnv();
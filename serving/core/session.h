@@ -21,6 +21,8 @@
 #include <vector>
 #include <memory>
 #include "util/status.h"
+#include "util/histogram.h"
+#include "core/batch_scheduler.h"
 #include "version_control/model.h"
 #include "include/inference.h"
 #include "serving/ms_service.pb.h"
@@ -43,9 +45,13 @@ class Session {
   Status Warmup(const MindSporeModelPtr model);
   Status Clear();
   Status GetModelInputsInfo(std::vector<inference::InferTensor> &tensor_list);
+  // latency of every Predict call in microseconds
+  const Histogram &latency_histogram() const { return latency_histogram_; }
+  // number of requests merged into one model execution when dynamic batching is enabled
+  const Histogram &batch_size_histogram() const { return batch_scheduler_.batch_size_histogram(); }
 
  private:
-  Session() = default;
+  Session();
   ~Session() = default;
   int sesseion_id_{0};
   std::shared_ptr<inference::InferSession> session_{nullptr};
@@ -53,8 +59,12 @@ class Session {
   uint32_t graph_id_{0};
   std::mutex mutex_;
   std::string device_type_;
+  BatchScheduler batch_scheduler_;
+  Histogram latency_histogram_;
 
   Status PredictInner(const PredictRequest &request, PredictReply &reply);
+  Status ExecuteRequest(const PredictRequest &request, PredictReply &reply);
+  void StartBatchScheduler();
 };
 }  // namespace serving
 }  // namespace mindspore
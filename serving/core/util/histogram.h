@@ -0,0 +1,49 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_SERVING_HISTOGRAM_H_
+#define MINDSPORE_SERVING_HISTOGRAM_H_
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace mindspore {
+namespace serving {
+// Histogram with fixed bucket upper bounds, values bigger than the last bound are counted in an extra bucket.
+class Histogram {
+ public:
+  explicit Histogram(const std::vector<uint64_t> &bounds);
+  ~Histogram() = default;
+
+  void Observe(uint64_t value);
+  void Reset();
+  std::vector<uint64_t> bounds() const { return bounds_; }
+  // bucket i counts the values in (bounds[i - 1], bounds[i]], the last bucket counts the values above all bounds
+  std::vector<uint64_t> counts() const;
+  uint64_t count() const;
+  uint64_t sum() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<uint64_t> bounds_;
+  std::vector<uint64_t> counts_;
+  uint64_t count_ = 0;
+  uint64_t sum_ = 0;
+};
+}  // namespace serving
+}  // namespace mindspore
+
+#endif  // MINDSPORE_SERVING_HISTOGRAM_H_
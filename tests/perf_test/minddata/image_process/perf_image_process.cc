@@ -0,0 +1,119 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Time of resize + normalize + HWC to CHW of an image to 224x224, with the lite_cv kernels and with the opencv
+// based ops of image_utils.cc which the dataset pipeline runs.
+// Usage: de_perf_image_process [image] [loops], run from the install test directory by default.
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+#include <opencv2/imgproc/types_c.h>
+
+#include "minddata/dataset/core/cv_tensor.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/kernels/image/lite_cv/image_process.h"
+#include "minddata/dataset/kernels/image/lite_cv/lite_mat.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+const int kDstSize = 224;
+const std::vector<float> kMeans = {0.485, 0.456, 0.406};
+const std::vector<float> kStds = {0.229, 0.224, 0.225};
+const double kScale = 1.0 / 255;
+
+template <typename F>
+double MicrosecondsPerLoop(int loops, F &&func) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < loops; i++) {
+    if (!func()) {
+      return -1;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / loops;
+}
+
+// ResizeBilinear, ConvertTo and SubStractMeanNormalize, the separate lite_cv ops which give HWC
+bool LiteSeparate(const LiteMat &src) {
+  LiteMat resize_mat, float_mat, norm_mat;
+  return ResizeBilinear(src, resize_mat, kDstSize, kDstSize) && ConvertTo(resize_mat, float_mat, kScale) &&
+         SubStractMeanNormalize(float_mat, norm_mat, kMeans, kStds);
+}
+
+bool LiteFused(const LiteMat &src) {
+  LiteMat chw_mat;
+  return ResizeNormalizeCHW(src, chw_mat, kDstSize, kDstSize, kMeans, kStds, kScale);
+}
+
+// Resize, Normalize and HwcToChw of image_utils.cc, as c_transforms Resize, Normalize and HWC2CHW
+bool ImageUtils(const std::shared_ptr<Tensor> &src) {
+  std::shared_ptr<Tensor> mean_tensor, std_tensor, resize_tensor, norm_tensor, chw_tensor;
+  std::vector<float> means, stds;
+  for (size_t c = 0; c < kMeans.size(); c++) {
+    means.push_back(kMeans[c] / kScale);
+    stds.push_back(kStds[c] / kScale);
+  }
+  Status rc = Tensor::CreateFromVector(means, &mean_tensor);
+  rc = rc.IsOk() ? Tensor::CreateFromVector(stds, &std_tensor) : rc;
+  rc = rc.IsOk() ? Resize(src, &resize_tensor, kDstSize, kDstSize) : rc;
+  rc = rc.IsOk() ? Normalize(resize_tensor, &norm_tensor, mean_tensor, std_tensor) : rc;
+  rc = rc.IsOk() ? HwcToChw(norm_tensor, &chw_tensor) : rc;
+  return rc.IsOk();
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::string filename = argc > 1 ? argv[1] : "data/dataset/apple.jpg";
+  int loops = argc > 2 ? std::atoi(argv[2]) : 200;
+  cv::Mat image = cv::imread(filename, cv::ImreadModes::IMREAD_COLOR);
+  if (image.empty() || loops <= 0) {
+    std::cerr << "Usage: " << argv[0] << " [image] [loops], failed to read " << filename << std::endl;
+    return 1;
+  }
+
+  cv::Mat rgba_mat;
+  cv::cvtColor(image, rgba_mat, CV_BGR2RGBA);
+  LiteMat lite_mat;
+  InitFromPixel(rgba_mat.data, LPixelType::RGBA2BGR, LDataType::UINT8, rgba_mat.cols, rgba_mat.rows, lite_mat);
+  std::shared_ptr<CVTensor> cv_tensor;
+  if (CVTensor::CreateFromMat(image, &cv_tensor).IsError()) {
+    std::cerr << "Failed to create the input tensor." << std::endl;
+    return 1;
+  }
+  std::shared_ptr<Tensor> tensor = cv_tensor;
+
+  double lite_separate = MicrosecondsPerLoop(loops, [&lite_mat] { return LiteSeparate(lite_mat); });
+  double lite_fused = MicrosecondsPerLoop(loops, [&lite_mat] { return LiteFused(lite_mat); });
+  double image_utils = MicrosecondsPerLoop(loops, [&tensor] { return ImageUtils(tensor); });
+  if (lite_separate < 0 || lite_fused < 0 || image_utils < 0) {
+    std::cerr << "Failed to process the image." << std::endl;
+    return 1;
+  }
+  std::cout << "Resize + normalize of " << image.cols << "x" << image.rows << " to " << kDstSize << "x" << kDstSize
+            << ", " << loops << " loops" << std::endl;
+  std::cout << "lite_cv separate ops (HWC): " << lite_separate << "us" << std::endl;
+  std::cout << "lite_cv ResizeNormalizeCHW: " << lite_fused << "us" << std::endl;
+  std::cout << "image_utils Resize + Normalize + HwcToChw: " << image_utils << "us" << std::endl;
+  return 0;
+}
@@ -0,0 +1,97 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""test performance of reading label columns of mindrecord with and without label pages"""
+import os
+import time
+
+import numpy as np
+
+import mindspore.dataset as ds
+from mindspore.mindrecord import FileReader, FileWriter
+
+num_rows = 1000000
+write_step = 100000
+columns_list = ["label", "score", "weight"]
+
+
+def remove_file(file_name):
+    for name in [file_name, file_name + ".db"]:
+        if os.path.exists(name):
+            os.remove(name)
+
+
+def write_mindrecord(file_name, label_pages):
+    """label pages are written by write_raw_data, but not when parallel_writer is set"""
+    remove_file(file_name)
+    writer = FileWriter(file_name=file_name, shard_num=1)
+    schema = {"id": {"type": "int64"}, "label": {"type": "int32"}, "score": {"type": "float64"},
+              "weight": {"type": "float32"}, "data": {"type": "bytes"}}
+    writer.add_schema(schema, "label page schema")
+    # label columns are not index fields, so that they are read from the file
+    writer.add_index(["id"])
+    for start in range(0, num_rows, write_step):
+        rows = [{"id": i, "label": i % 1000, "score": i * 0.25, "weight": (i % 7) * 0.5,
+                 "data": np.int32(i).tobytes()} for i in range(start, start + write_step)]
+        writer.write_raw_data(rows, parallel_writer=not label_pages)
+    writer.commit()
+
+
+def use_filereader(mindrecord):
+    start = time.time()
+    reader = FileReader(file_name=mindrecord,
+                        num_consumer=4,
+                        columns=columns_list)
+    num_iter = 0
+    for _, _ in enumerate(reader.get_next()):
+        num_iter += 1
+    reader.close()
+    end = time.time()
+    print("Read by FileReader - total rows: {}, cost time: {}s, rows/s: {}".format(
+        num_iter, end - start, num_iter / (end - start)))
+    return end - start
+
+
+def use_minddataset(mindrecord):
+    start = time.time()
+    data_set = ds.MindDataset(dataset_file=mindrecord,
+                              columns_list=columns_list,
+                              num_parallel_workers=4,
+                              shuffle=False)
+    num_iter = 0
+    for _ in data_set.create_dict_iterator():
+        num_iter += 1
+    end = time.time()
+    print("Read by MindDataset - total rows: {}, cost time: {}s, rows/s: {}".format(
+        num_iter, end - start, num_iter / (end - start)))
+    return end - start
+
+
+if __name__ == '__main__':
+    label_page_file = './label_page.mindrecord'
+    raw_page_file = './raw_page.mindrecord'
+    write_mindrecord(label_page_file, True)
+    write_mindrecord(raw_page_file, False)
+
+    print("With label pages:")
+    label_page_cost = use_minddataset(label_page_file)
+    label_page_reader_cost = use_filereader(label_page_file)
+    print("Without label pages:")
+    raw_page_cost = use_minddataset(raw_page_file)
+    raw_page_reader_cost = use_filereader(raw_page_file)
+    print("Speedup of label pages, MindDataset: {}x, FileReader: {}x".format(
+        raw_page_cost / label_page_cost, raw_page_reader_cost / label_page_reader_cost))
+
+    remove_file(label_page_file)
+    remove_file(raw_page_file)
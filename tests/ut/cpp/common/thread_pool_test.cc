@@ -0,0 +1,73 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "common/common_test.h"
+#include "common/thread_pool.h"
+
+namespace mindspore {
+namespace common {
+class ThreadPoolTest : public UT::Common {
+ public:
+  ThreadPoolTest() = default;
+};
+
+TEST_F(ThreadPoolTest, ParallelForCoversRange) {
+  std::vector<int> data(100000, 0);
+  ThreadPool::GetInstance().ParallelFor(0, data.size(), 1, [&data](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      data[i] += 1;
+    }
+  });
+  for (size_t i = 0; i < data.size(); ++i) {
+    EXPECT_EQ(data[i], 1);
+  }
+}
+
+TEST_F(ThreadPoolTest, SmallRangeRunsInline) {
+  std::atomic<size_t> call_count{0};
+  ThreadPool::GetInstance().ParallelFor(10, 20, 64, [&call_count](size_t start, size_t end) {
+    EXPECT_EQ(start, 10);
+    EXPECT_EQ(end, 20);
+    call_count++;
+  });
+  EXPECT_EQ(call_count, 1);
+  ThreadPool::GetInstance().ParallelFor(5, 5, 1, [&call_count](size_t, size_t) { call_count++; });
+  EXPECT_EQ(call_count, 1);
+}
+
+TEST_F(ThreadPoolTest, NestedParallelFor) {
+  std::atomic<size_t> sum{0};
+  ThreadPool::GetInstance().ParallelFor(0, 16, 1, [&sum](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      ThreadPool::GetInstance().ParallelFor(0, 100, 1, [&sum](size_t s, size_t e) { sum += e - s; });
+    }
+  });
+  EXPECT_EQ(sum, 1600);
+}
+
+TEST_F(ThreadPoolTest, ExceptionIsRethrown) {
+  auto task = [](size_t start, size_t) {
+    if (start == 0) {
+      throw std::runtime_error("test");
+    }
+  };
+  EXPECT_THROW(ThreadPool::GetInstance().ParallelFor(0, 1000, 1, task), std::runtime_error);
+}
+}  // namespace common
+}  // namespace mindspore
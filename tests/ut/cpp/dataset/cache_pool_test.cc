@@ -0,0 +1,124 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+#include "minddata/dataset/util/arena.h"
+#include "minddata/dataset/util/cache_pool.h"
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestCachePool : public UT::Common {
+ public:
+  MindDataTestCachePool() {}
+
+  // Every byte of row i is i
+  static void CheckRow(const std::shared_ptr<CachePool> &cp, CachePool::key_type key, int i, size_t row_sz) {
+    std::vector<uint8_t> row(row_sz);
+    WritableSlice dest(row.data(), row.size());
+    size_t bytes_read = 0;
+    ASSERT_TRUE(cp->Read(key, &dest, &bytes_read).IsOk());
+    ASSERT_EQ(bytes_read, row_sz);
+    ASSERT_EQ(row, std::vector<uint8_t>(row_sz, static_cast<uint8_t>(i)));
+  }
+};
+
+TEST_F(MindDataTestCachePool, TestPromoteAndEvict) {
+  // 1MB of memory holds about 15 rows, the rest is spilled to disk.
+  std::shared_ptr<Arena> arena;
+  ASSERT_TRUE(Arena::CreateArena(&arena, 1).IsOk());
+  auto cp = std::make_shared<CachePool>(CachePool::value_allocator(arena), "/tmp");
+  ASSERT_TRUE(cp->ServiceStart().IsOk());
+  const int num_rows = 40;
+  const size_t row_sz = 64 * 1024;
+  std::vector<CachePool::key_type> keys;
+  for (int i = 0; i < num_rows; ++i) {
+    std::vector<uint8_t> row(row_sz, static_cast<uint8_t>(i));
+    CachePool::key_type key;
+    ASSERT_TRUE(cp->Insert({ReadableSlice(row.data(), row.size())}, &key).IsOk());
+    keys.push_back(key);
+  }
+  auto stat = cp->GetStat();
+  ASSERT_EQ(stat.num_mem_cached + stat.num_disk_cached, num_rows);
+  ASSERT_GE(stat.num_disk_cached, 20);
+
+  // Each read is served by the tier holding the row.
+  for (int i = 0; i < num_rows; ++i) {
+    CheckRow(cp, keys[i], i, row_sz);
+  }
+  stat = cp->GetStat();
+  ASSERT_EQ(stat.num_mem_hit, stat.num_mem_cached);
+  ASSERT_EQ(stat.num_disk_hit, stat.num_disk_cached);
+
+  // Read ahead the last rows, which were spilled. The rows read least recently are evicted to make room.
+  const int num_prefetch = 10;
+  for (int i = num_rows - num_prefetch; i < num_rows; ++i) {
+    ASSERT_TRUE(cp->Promote(keys[i]).IsOk());
+  }
+  auto promoted = cp->GetStat();
+  ASSERT_EQ(promoted.num_promoted, num_prefetch);
+  ASSERT_GE(promoted.num_evicted, num_prefetch);
+  ASSERT_EQ(promoted.num_mem_cached + promoted.num_disk_cached, num_rows);
+  for (int i = num_rows - num_prefetch; i < num_rows; ++i) {
+    CheckRow(cp, keys[i], i, row_sz);
+  }
+  stat = cp->GetStat();
+  ASSERT_EQ(stat.num_mem_hit, promoted.num_mem_hit + num_prefetch);
+  ASSERT_EQ(stat.num_disk_hit, promoted.num_disk_hit);
+
+  // Evicted rows are still there, on disk.
+  for (int i = 0; i < num_rows; ++i) {
+    CheckRow(cp, keys[i], i, row_sz);
+  }
+  ASSERT_TRUE(cp->ServiceStop().IsOk());
+}
+
+TEST_F(MindDataTestCachePool, TestMemoryOnly) {
+  // Without a spill directory every row stays in memory and there is nothing to evict.
+  std::shared_ptr<Arena> arena;
+  ASSERT_TRUE(Arena::CreateArena(&arena, 1).IsOk());
+  auto cp = std::make_shared<CachePool>(CachePool::value_allocator(arena));
+  ASSERT_TRUE(cp->ServiceStart().IsOk());
+  const int num_rows = 8;
+  const size_t row_sz = 64 * 1024;
+  std::vector<CachePool::key_type> keys;
+  for (int i = 0; i < num_rows; ++i) {
+    std::vector<uint8_t> row(row_sz, static_cast<uint8_t>(i));
+    CachePool::key_type key;
+    ASSERT_TRUE(cp->Insert({ReadableSlice(row.data(), row.size())}, &key).IsOk());
+    keys.push_back(key);
+  }
+  for (int i = 0; i < num_rows; ++i) {
+    ASSERT_TRUE(cp->Promote(keys[i]).IsOk());
+    CheckRow(cp, keys[i], i, row_sz);
+  }
+  auto stat = cp->GetStat();
+  ASSERT_EQ(stat.num_mem_cached, num_rows);
+  ASSERT_EQ(stat.num_disk_cached, 0);
+  ASSERT_EQ(stat.num_mem_hit, num_rows);
+  ASSERT_EQ(stat.num_promoted, 0);
+  ASSERT_EQ(stat.num_evicted, 0);
+
+  // A row which doesn't fit is refused rather than evicting another one.
+  std::vector<uint8_t> big_row(2 * 1024 * 1024, 0);
+  CachePool::key_type key;
+  Status rc = cp->Insert({ReadableSlice(big_row.data(), big_row.size())}, &key);
+  ASSERT_EQ(rc.get_code(), StatusCode::kOutOfMemory);
+  ASSERT_TRUE(cp->ServiceStop().IsOk());
+}
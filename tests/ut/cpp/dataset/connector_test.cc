@@ -24,6 +24,7 @@
 
 #include "common/common.h"
 #include "minddata/dataset/engine/connector.h"
+#include "minddata/dataset/engine/db_connector.h"
 #include "minddata/dataset/util/task_manager.h"
 #include "utils/log_adapter.h"
 
@@ -122,7 +123,61 @@ TEST_F(MindDataTestConnector, Test2) {
   ASSERT_TRUE(rc.IsOk());
 }
 
+// Test3: the round robin of a DbConnector switches from 3 to 2 producers after the first eoe.
+TEST_F(MindDataTestConnector, Test3) {
+  MS_LOG(INFO) << "MindDataTestConnector Test3: switch the active producers at an eoe.";
+  DbConnector conn(4, 1, 4);
+  conn.SetActiveProducers(3);
+  ASSERT_TRUE(conn.SwitchActiveProducers(1, 2).IsOk());
+  ASSERT_TRUE(conn.Add(0, std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.Add(1, std::make_unique<DataBuffer>(1, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.Add(2, std::make_unique<DataBuffer>(2, DataBuffer::kDeBFlagEOE)).IsOk());
+  ASSERT_TRUE(conn.Add(0, std::make_unique<DataBuffer>(3, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.Add(1, std::make_unique<DataBuffer>(4, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.Add(0, std::make_unique<DataBuffer>(5, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.Add(1, std::make_unique<DataBuffer>(6, DataBuffer::kDeBFlagEOE)).IsOk());
+  for (int32_t i = 0; i < 7; i++) {
+    std::unique_ptr<DataBuffer> buf;
+    ASSERT_TRUE(conn.PopWithRetry(0, &buf).IsOk());
+    ASSERT_EQ(buf->id(), i);
+  }
+  // A switch after an eoe that has already been popped is an error.
+  ASSERT_TRUE(conn.SwitchActiveProducers(2, 3).IsError());
+}
 
+// Test4: an unordered DbConnector pops whichever producer has data, but holds the eoe back until all have sent it.
+TEST_F(MindDataTestConnector, Test4) {
+  MS_LOG(INFO) << "MindDataTestConnector Test4: unordered pop.";
+  DbConnector conn(3, 1, 4);
+  conn.SetUnordered();
+  std::unique_ptr<DataBuffer> buf;
+  // Producer 0 is slow, the others do not wait for it.
+  ASSERT_TRUE(conn.Add(1, std::make_unique<DataBuffer>(1, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.Add(1, std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOE)).IsOk());
+  ASSERT_TRUE(conn.Add(1, std::make_unique<DataBuffer>(4, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.Add(2, std::make_unique<DataBuffer>(2, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.PopWithRetry(0, &buf).IsOk());
+  ASSERT_EQ(buf->id(), 1);
+  ASSERT_TRUE(conn.PopWithRetry(0, &buf).IsOk());
+  ASSERT_EQ(buf->id(), 2);
+  ASSERT_TRUE(conn.Add(0, std::make_unique<DataBuffer>(3, DataBuffer::kDeBFlagNone)).IsOk());
+  ASSERT_TRUE(conn.Add(0, std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOE)).IsOk());
+  ASSERT_TRUE(conn.Add(2, std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOE)).IsOk());
+  ASSERT_TRUE(conn.PopWithRetry(0, &buf).IsOk());
+  ASSERT_EQ(buf->id(), 3);
+  // Row 4 of the next epoch comes after the single eoe.
+  ASSERT_TRUE(conn.PopWithRetry(0, &buf).IsOk());
+  ASSERT_TRUE(buf->eoe());
+  ASSERT_TRUE(conn.PopWithRetry(0, &buf).IsOk());
+  ASSERT_EQ(buf->id(), 4);
+  for (int32_t i = 0; i < 3; i++) {
+    ASSERT_TRUE(conn.Add(i, std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOF)).IsOk());
+  }
+  ASSERT_TRUE(conn.PopWithRetry(0, &buf).IsOk());
+  ASSERT_TRUE(buf->eof());
+  ASSERT_TRUE(conn.PopWithRetry(0, &buf).IsOk());
+  ASSERT_TRUE(buf->eof());
+}
 
 // Implementation of MindDataTestConnector class and the helper functions.
 MindDataTestConnector::MindDataTestConnector() : tg_(new TaskGroup()) {
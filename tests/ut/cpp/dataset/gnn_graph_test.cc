@@ -16,12 +16,17 @@
 #include <algorithm>
 #include <string>
 #include <memory>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include "common/common.h"
 #include "gtest/gtest.h"
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/engine/gnn/node.h"
+#include "minddata/dataset/engine/gnn/graph_csr.h"
 #include "minddata/dataset/engine/gnn/graph_data_impl.h"
 #include "minddata/dataset/engine/gnn/graph_loader.h"
 
@@ -266,3 +271,124 @@ TEST_F(MindDataTestGNNGraph, TestRandomWalkDefaults) {
   EXPECT_TRUE(s.IsOk());
   EXPECT_TRUE(walk_path->shape().ToString() == "<33,60>");
 }
+
+TEST_F(MindDataTestGNNGraph, TestGraphCsr) {
+  // Nodes 10, 20, 30 of type 1 and 40, 50 of type 2, ids not consecutive
+  GraphCsr csr;
+  Status s = csr.Build({{40, 2}, {10, 1}, {30, 1}, {50, 2}, {20, 1}},
+                       {{10, 50}, {10, 30}, {10, 40}, {10, 20}, {20, 10}, {40, 10}, {50, 10}, {50, 20}});
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_EQ(csr.NumNodes(), 5);
+  EXPECT_EQ(csr.GetIndex(10), 0);
+  EXPECT_EQ(csr.GetIndex(50), 4);
+  EXPECT_EQ(csr.GetIndex(35), -1);
+
+  GraphCsr::NeighborRange range = csr.GetNeighbors(csr.GetIndex(10), 1);
+  EXPECT_EQ(std::vector<NodeIdType>(range.first, range.second), std::vector<NodeIdType>({20, 30}));
+  range = csr.GetNeighbors(csr.GetIndex(10), 2);
+  EXPECT_EQ(std::vector<NodeIdType>(range.first, range.second), std::vector<NodeIdType>({40, 50}));
+  range = csr.GetNeighbors(csr.GetIndex(30), 1);
+  EXPECT_TRUE(range.first == range.second);
+  range = csr.GetNeighbors(csr.GetIndex(10), 3);
+  EXPECT_TRUE(range.first == range.second);
+  EXPECT_FALSE(csr.Build({{10, 1}}, {{10, 20}}).IsOk());
+
+  // Distinct neighbors while there are enough, then repeated, kDefaultNodeId without neighbors
+  s = csr.Build({{0, 1}, {1, 1}, {2, 1}, {3, 1}, {4, 1}}, {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 0}});
+  EXPECT_TRUE(s.IsOk());
+  std::mt19937 rnd(0);
+  std::vector<NodeIdType> samples;
+  s = csr.SampleNeighbors({0, 1, 2, kDefaultNodeId}, 1, 3, &rnd, &samples);
+  EXPECT_TRUE(s.IsOk());
+  ASSERT_EQ(samples.size(), 12);
+  EXPECT_EQ(std::unordered_set<NodeIdType>(samples.begin(), samples.begin() + 3).size(), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NE(samples[i], 0);
+    EXPECT_EQ(samples[3 + i], 0);
+    EXPECT_EQ(samples[6 + i], kDefaultNodeId);
+    EXPECT_EQ(samples[9 + i], kDefaultNodeId);
+  }
+  EXPECT_FALSE(csr.SampleNeighbors({7}, 1, 3, &rnd, &samples).IsOk());
+
+  // Feature rows of the nodes, zero for the nodes without the feature
+  std::shared_ptr<Tensor> value;
+  s = Tensor::CreateFromVector(std::vector<int32_t>({1, 2}), &value);
+  EXPECT_TRUE(s.IsOk());
+  s = csr.UpdateNodeFeature(3, std::make_shared<Feature>(1, value));
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_TRUE(csr.HasNodeFeature(1));
+  EXPECT_FALSE(csr.HasNodeFeature(2));
+  std::shared_ptr<Tensor> short_value;
+  s = Tensor::CreateFromVector(std::vector<int32_t>({1}), &short_value);
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_FALSE(csr.UpdateNodeFeature(2, std::make_shared<Feature>(1, short_value)).IsOk());
+
+  std::shared_ptr<Tensor> nodes;
+  s = Tensor::CreateFromVector(std::vector<NodeIdType>({3, 0, kDefaultNodeId}), &nodes);
+  EXPECT_TRUE(s.IsOk());
+  std::shared_ptr<Tensor> features;
+  s = csr.GetNodeFeature(nodes, 1, &features);
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_EQ(features->ToString(), "Tensor (shape: <3,2>, Type: int32)\n[[1,2],[0,0],[0,0]]");
+}
+
+TEST_F(MindDataTestGNNGraph, TestParallelSampling) {
+  // Samples only depend on the seed, not on the number of workers
+  uint32_t original_seed = GlobalContext::config_manager()->seed();
+  GlobalContext::config_manager()->set_seed(135);
+  std::string path = "data/mindrecord/testGraphData/sns";
+  GraphDataImpl graph(path, 1);
+  GraphDataImpl parallel_graph(path, 4);
+  Status s = graph.Init();
+  EXPECT_TRUE(s.IsOk());
+  s = parallel_graph.Init();
+  EXPECT_TRUE(s.IsOk());
+
+  MetaInfo meta_info;
+  s = graph.GetMetaInfo(&meta_info);
+  EXPECT_TRUE(s.IsOk());
+  std::shared_ptr<Tensor> nodes;
+  s = graph.GetAllNodes(meta_info.node_type[0], &nodes);
+  EXPECT_TRUE(s.IsOk());
+  // Several blocks of nodes
+  std::vector<NodeIdType> node_list;
+  for (int i = 0; i < 20; ++i) {
+    node_list.insert(node_list.end(), nodes->begin<NodeIdType>(), nodes->end<NodeIdType>());
+  }
+
+  std::shared_ptr<Tensor> neighbors;
+  std::shared_ptr<Tensor> parallel_neighbors;
+  s = graph.GetSampledNeighbors(node_list, {3, 2}, {meta_info.node_type[0], meta_info.node_type[0]}, &neighbors);
+  EXPECT_TRUE(s.IsOk());
+  s = parallel_graph.GetSampledNeighbors(node_list, {3, 2}, {meta_info.node_type[0], meta_info.node_type[0]},
+                                         &parallel_neighbors);
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_TRUE(neighbors->shape().ToString() == "<660,10>");
+  EXPECT_EQ(neighbors->ToString(), parallel_neighbors->ToString());
+
+  std::vector<NodeType> meta_path(10, meta_info.node_type[0]);
+  std::shared_ptr<Tensor> walk_path;
+  std::shared_ptr<Tensor> parallel_walk_path;
+  s = graph.RandomWalk(node_list, meta_path, 2.0, 0.5, -1, &walk_path);
+  EXPECT_TRUE(s.IsOk());
+  s = parallel_graph.RandomWalk(node_list, meta_path, 2.0, 0.5, -1, &parallel_walk_path);
+  EXPECT_TRUE(s.IsOk());
+  EXPECT_TRUE(walk_path->shape().ToString() == "<660,11>");
+  EXPECT_EQ(walk_path->ToString(), parallel_walk_path->ToString());
+
+  // Concurrent requests, as served by the graph server, share the sample workers of the graph
+  std::vector<std::thread> requests;
+  for (int i = 0; i < 4; ++i) {
+    requests.emplace_back([&]() {
+      std::shared_ptr<Tensor> out;
+      Status rc = parallel_graph.GetSampledNeighbors(node_list, {3, 2},
+                                                     {meta_info.node_type[0], meta_info.node_type[0]}, &out);
+      EXPECT_TRUE(rc.IsOk());
+      EXPECT_TRUE(out->shape().ToString() == "<660,10>");
+    });
+  }
+  for (auto &request : requests) {
+    request.join();
+  }
+  GlobalContext::config_manager()->set_seed(original_seed);
+}
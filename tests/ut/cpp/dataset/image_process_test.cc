@@ -334,3 +334,43 @@ TEST_F(MindDataImageProcess, TestAffine) {
     }
   }
 }
+
+TEST_F(MindDataImageProcess, TestResizeNormalizeCHW) {
+  std::string filename = "data/dataset/apple.jpg";
+  cv::Mat image = cv::imread(filename, cv::ImreadModes::IMREAD_COLOR);
+  cv::Mat rgba_mat;
+  cv::cvtColor(image, rgba_mat, CV_BGR2RGBA);
+  LiteMat lite_mat_bgr;
+  InitFromPixel(rgba_mat.data, LPixelType::RGBA2BGR, LDataType::UINT8, rgba_mat.cols, rgba_mat.rows, lite_mat_bgr);
+
+  std::vector<float> means = {0.485, 0.456, 0.406};
+  std::vector<float> stds = {0.229, 0.224, 0.225};
+  double scale = 1.0 / 255;
+
+  // the fused op gives the values of the separate ops, in CHW order
+  LiteMat lite_mat_resize, lite_mat_convert_float, lite_norm_mat;
+  ASSERT_TRUE(ResizeBilinear(lite_mat_bgr, lite_mat_resize, 224, 224));
+  ASSERT_TRUE(ConvertTo(lite_mat_resize, lite_mat_convert_float, scale));
+  ASSERT_TRUE(SubStractMeanNormalize(lite_mat_convert_float, lite_norm_mat, means, stds));
+  LiteMat lite_chw;
+  ASSERT_TRUE(ResizeNormalizeCHW(lite_mat_bgr, lite_chw, 224, 224, means, stds, scale));
+  ASSERT_EQ(lite_chw.width_, 224);
+  ASSERT_EQ(lite_chw.height_, 224);
+  ASSERT_EQ(lite_chw.channel_, 3);
+  const float *hwc = lite_norm_mat;
+  const float *chw = lite_chw;
+  int plane_size = 224 * 224;
+  for (int i = 0; i < plane_size; i++) {
+    for (int c = 0; c < 3; c++) {
+      ASSERT_EQ(chw[c * plane_size + i], hwc[i * 3 + c]);
+    }
+  }
+
+  // an empty mean or std is skipped, a std of 0 is rejected
+  LiteMat lite_scaled;
+  ASSERT_TRUE(ResizeNormalizeCHW(lite_mat_bgr, lite_scaled, 224, 224, {}, {}, scale));
+  EXPECT_EQ(static_cast<const float *>(lite_scaled)[plane_size + 1],
+            static_cast<const float *>(lite_mat_convert_float)[4]);
+  EXPECT_FALSE(ResizeNormalizeCHW(lite_mat_bgr, lite_scaled, 224, 224, means, {0.229, 0.0, 0.225}, scale));
+  EXPECT_FALSE(ResizeNormalizeCHW(lite_mat_bgr, lite_scaled, 224, 224, {0.485}, stds, scale));
+}
@@ -177,3 +177,34 @@ TEST_F(MindDataTestQueue, Test6) {
   MS_LOG(INFO) << "Popped value " << *pepped_value << " from queue index " << chosen_queue_index;
   ASSERT_EQ(*pepped_value, 99);
 }
+
+TEST_F(MindDataTestQueue, Test7) {
+  // Resize a queue whose elements wrap around the end of the array and check the order is kept.
+  Queue<int> que(3);
+  int v;
+  for (int i = 0; i < 3; i++) {
+    ASSERT_TRUE(que.Add(i).IsOk());
+  }
+  ASSERT_TRUE(que.PopFront(&v).IsOk());
+  ASSERT_TRUE(que.Add(3).IsOk());
+  ASSERT_TRUE(que.Resize(6).IsOk());
+  ASSERT_EQ(que.capacity(), 6);
+  ASSERT_EQ(que.size(), 3);
+  for (int i = 4; i < 7; i++) {
+    ASSERT_TRUE(que.Add(i).IsOk());
+  }
+  // Shrink below the current size. Elements are kept and the queue is over its capacity until popped.
+  ASSERT_TRUE(que.Resize(2).IsOk());
+  ASSERT_EQ(que.capacity(), 2);
+  for (int i = 1; i < 6; i++) {
+    ASSERT_TRUE(que.PopFront(&v).IsOk());
+    ASSERT_EQ(v, i);
+  }
+  ASSERT_TRUE(que.Add(7).IsOk());
+  ASSERT_EQ(que.size(), 2);
+  ASSERT_TRUE(que.PopFront(&v).IsOk());
+  ASSERT_EQ(v, 6);
+  ASSERT_TRUE(que.PopFront(&v).IsOk());
+  ASSERT_EQ(v, 7);
+  ASSERT_TRUE(que.Resize(0).IsError());
+}
@@ -0,0 +1,140 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <memory>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/util/size_class_pool.h"
+#include "minddata/dataset/util/task_manager.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestSizeClassPool : public UT::Common {
+ public:
+  MindDataTestSizeClassPool() {}
+};
+
+TEST_F(MindDataTestSizeClassPool, TestSizeClass) {
+  EXPECT_EQ(SizeClassPool::SizeClass(1), 0);
+  EXPECT_EQ(SizeClassPool::SizeClass(64), 0);
+  EXPECT_EQ(SizeClassPool::ClassSize(0), 64);
+  EXPECT_EQ(SizeClassPool::ClassSize(SizeClassPool::SizeClass(65)), 80);
+  EXPECT_EQ(SizeClassPool::ClassSize(SizeClassPool::SizeClass(128)), 128);
+  EXPECT_EQ(SizeClassPool::ClassSize(SizeClassPool::SizeClass(129)), 160);
+  EXPECT_EQ(SizeClassPool::ClassSize(SizeClassPool::SizeClass(224 * 224 * 3)), 163840);
+  EXPECT_EQ(SizeClassPool::ClassSize(SizeClassPool::SizeClass(SizeClassPool::kMaxClassSize)),
+            SizeClassPool::kMaxClassSize);
+  // Every request fits its class, and wastes at most a quarter of it.
+  for (size_t n = 1; n < 100000; n += 7) {
+    size_t size = SizeClassPool::ClassSize(SizeClassPool::SizeClass(n));
+    ASSERT_GE(size, n);
+    ASSERT_LT(size, n * 5 / 4 + SizeClassPool::kMinClassSize);
+  }
+}
+
+TEST_F(MindDataTestSizeClassPool, TestReuse) {
+  SizeClassPool pool;
+  void *p = nullptr;
+  ASSERT_TRUE(pool.Allocate(1000, &p).IsOk());
+  ASSERT_NE(p, nullptr);
+  memset(p, 1, 1000);
+  pool.Deallocate(p);
+  void *q = nullptr;
+  ASSERT_TRUE(pool.Allocate(990, &q).IsOk());
+  EXPECT_EQ(p, q);
+  SizeClassPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocs, 2);
+  EXPECT_EQ(stats.num_cache_hits, 1);
+  EXPECT_EQ(stats.num_system_allocs, 1);
+  EXPECT_EQ(stats.bytes_in_use, SizeClassPool::ClassSize(SizeClassPool::SizeClass(1000)));
+  EXPECT_EQ(stats.bytes_cached, 0);
+
+  // Growing within the class keeps the block, growing past it moves the data.
+  ASSERT_TRUE(pool.Reallocate(&q, 990, 1024).IsOk());
+  EXPECT_EQ(p, q);
+  memset(q, 7, 1024);
+  ASSERT_TRUE(pool.Reallocate(&q, 1024, 4096).IsOk());
+  EXPECT_EQ(static_cast<uint8_t *>(q)[1023], 7);
+  pool.Deallocate(q);
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.bytes_in_use, 0);
+  EXPECT_GT(stats.bytes_cached, 0);
+  pool.Trim();
+  EXPECT_EQ(pool.GetStats().bytes_cached, 0);
+}
+
+TEST_F(MindDataTestSizeClassPool, TestCacheLimit) {
+  SizeClassPool pool(4096);
+  void *small = nullptr;
+  void *big = nullptr;
+  void *large = nullptr;
+  ASSERT_TRUE(pool.Allocate(4096, &small).IsOk());
+  ASSERT_TRUE(pool.Allocate(8192, &big).IsOk());
+  ASSERT_TRUE(pool.Allocate(SizeClassPool::kMaxClassSize + 1, &large).IsOk());
+  pool.Deallocate(small);
+  pool.Deallocate(big);
+  pool.Deallocate(large);
+  SizeClassPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.bytes_cached, 4096);
+  EXPECT_EQ(stats.num_system_frees, 2);
+  EXPECT_EQ(stats.peak_bytes_in_use, 4096 + 8192 + SizeClassPool::kMaxClassSize + 1);
+
+  pool.set_max_cache_size(0);
+  ASSERT_TRUE(pool.Allocate(4096, &small).IsOk());
+  pool.Deallocate(small);
+  EXPECT_EQ(pool.GetStats().bytes_cached, 0);
+}
+
+TEST_F(MindDataTestSizeClassPool, TestMultiThread) {
+  SizeClassPool pool;
+  TaskGroup vg;
+  const int32_t num_threads = 4;
+  const int32_t num_iterations = 2000;
+  for (int32_t i = 0; i < num_threads; i++) {
+    Status rc = vg.CreateAsyncTask("TestMem", [&pool, i]() -> Status {
+      TaskManager::FindMe()->Post();
+      std::vector<uint8_t *> blocks;
+      for (int32_t j = 0; j < num_iterations; j++) {
+        size_t sz = 100 + (j % 50) * 1000;
+        void *p = nullptr;
+        RETURN_IF_NOT_OK(pool.Allocate(sz, &p));
+        memset(p, i, sz);
+        blocks.push_back(static_cast<uint8_t *>(p));
+        // Keep a few blocks alive so that the caches fill up and spill.
+        if (blocks.size() > 100) {
+          for (auto block : blocks) {
+            if (block[0] != i) {
+              RETURN_STATUS_UNEXPECTED("Block is shared by two threads");
+            }
+            pool.Deallocate(block);
+          }
+          blocks.clear();
+        }
+      }
+      for (auto block : blocks) {
+        pool.Deallocate(block);
+      }
+      return Status::OK();
+    });
+    ASSERT_TRUE(rc.IsOk());
+  }
+  vg.join_all();
+  ASSERT_TRUE(vg.GetTaskErrorIfAny().IsOk());
+  SizeClassPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocs, num_threads * num_iterations);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+  EXPECT_GT(stats.num_cache_hits, 0);
+}
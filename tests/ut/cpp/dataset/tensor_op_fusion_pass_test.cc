@@ -21,8 +21,12 @@
 #include "gtest/gtest.h"
 #include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
 #include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/crop_flip_op.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_hwc_to_chw_op.h"
 #include "minddata/dataset/engine/datasetops/source/image_folder_op.h"
 #include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 
 
 using namespace mindspore::dataset;
@@ -102,4 +106,109 @@ TEST_F(MindDataTestTensorOpFusionPass, RandomCropDecodeResize_fusion_enabled) {
   auto func_it = tfuncs.begin();
   EXPECT_EQ((*func_it)->Name(), kRandomCropDecodeResizeOp);
   EXPECT_EQ(++func_it, tfuncs.end());
-}
\ No newline at end of file
+}
+
+TEST_F(MindDataTestTensorOpFusionPass, FusionRules) {
+  MS_LOG(INFO) << "Doing FusionRules";
+  std::vector<std::shared_ptr<TensorOp>> func_list;
+  func_list.push_back(std::make_shared<CropOp>(0, 0, 8, 8));
+  func_list.push_back(std::make_shared<RandomHorizontalFlipOp>());
+  func_list.push_back(std::make_shared<RescaleOp>(1.0 / 255, 0.0));
+  func_list.push_back(std::make_shared<NormalizeOp>(0.5, 0.5, 0.5, 0.2, 0.2, 0.2));
+  func_list.push_back(std::make_shared<HwcToChwOp>());
+  std::shared_ptr<MapOp> map_op;
+  MapOp::Builder map_builder;
+  map_builder.SetInColNames({}).SetOutColNames({}).SetTensorFuncs(func_list).SetNumWorkers(4);
+  Status rc = map_builder.Build(&map_op);
+  EXPECT_TRUE(rc.IsOk());
+
+  TensorOpFusionPass pass;
+  bool modified = false;
+  rc = pass.RunOnNode(map_op, &modified);
+  EXPECT_TRUE(rc.IsOk());
+  EXPECT_TRUE(modified);
+  auto tfuncs = map_op->TFuncs();
+  ASSERT_EQ(tfuncs.size(), 2);
+  EXPECT_EQ(tfuncs[0]->Name(), kCropFlipOp);
+  EXPECT_EQ(tfuncs[1]->Name(), kNormalizeHwcToChwOp);
+  auto fired = pass.FusionsFired();
+  EXPECT_EQ(fired[kCropFlipOp], 1);
+  EXPECT_EQ(fired[kRescaleNormalizeOp], 1);
+  EXPECT_EQ(fired[kNormalizeHwcToChwOp], 1);
+
+  // Nothing left to fuse.
+  modified = false;
+  rc = pass.RunOnNode(map_op, &modified);
+  EXPECT_TRUE(rc.IsOk());
+  EXPECT_FALSE(modified);
+}
+
+TEST_F(MindDataTestTensorOpFusionPass, FusedOpsMatch) {
+  MS_LOG(INFO) << "Doing FusedOpsMatch";
+  std::vector<uint8_t> pixels(4 * 6 * 3);
+  for (size_t i = 0; i < pixels.size(); i++) {
+    pixels[i] = static_cast<uint8_t>(i * 7 % 256);
+  }
+  std::shared_ptr<Tensor> image;
+  EXPECT_TRUE(Tensor::CreateFromVector(pixels, TensorShape({4, 6, 3}), &image).IsOk());
+
+  // RescaleOp, NormalizeOp and HwcToChwOp
+  RescaleOp rescale(1.0 / 255, 0.0);
+  NormalizeOp normalize(0.485, 0.456, 0.406, 0.229, 0.224, 0.225);
+  HwcToChwOp hwc_to_chw;
+  std::shared_ptr<Tensor> rescaled;
+  std::shared_ptr<Tensor> normalized;
+  std::shared_ptr<Tensor> expected;
+  EXPECT_TRUE(rescale.Compute(image, &rescaled).IsOk());
+  EXPECT_TRUE(normalize.Compute(rescaled, &normalized).IsOk());
+  EXPECT_TRUE(hwc_to_chw.Compute(normalized, &expected).IsOk());
+  std::shared_ptr<Tensor> output;
+  NormalizeHwcToChwOp fused{RescaleNormalizeOp(rescale, normalize)};
+  EXPECT_TRUE(fused.Compute(image, &output).IsOk());
+  ASSERT_EQ(output->shape(), expected->shape());
+  ASSERT_EQ(output->type(), expected->type());
+  for (auto out = output->begin<float>(), exp = expected->begin<float>(); out != output->end<float>(); ++out, ++exp) {
+    EXPECT_NEAR(*out, *exp, 1e-5);
+  }
+
+  // CropOp and RandomHorizontalFlipOp which always flips
+  CropOp crop(1, 1, 3, 3);
+  RandomHorizontalFlipOp flip(1.0);
+  std::shared_ptr<Tensor> cropped;
+  EXPECT_TRUE(crop.Compute(image, &cropped).IsOk());
+  EXPECT_TRUE(flip.Compute(cropped, &expected).IsOk());
+  CropFlipOp crop_flip(crop, flip);
+  EXPECT_TRUE(crop_flip.Compute(image, &output).IsOk());
+  ASSERT_EQ(output->shape(), expected->shape());
+  for (auto out = output->begin<uint8_t>(), exp = expected->begin<uint8_t>(); out != output->end<uint8_t>();
+       ++out, ++exp) {
+    EXPECT_EQ(*out, *exp);
+  }
+}
+
+namespace {
+// NormalizeOp whose mean tensor can not be read as float
+class IntMeanNormalizeOp : public NormalizeOp {
+ public:
+  IntMeanNormalizeOp() : NormalizeOp(0.0, 0.0, 0.0, 1.0, 1.0, 1.0) {
+    EXPECT_TRUE(Tensor::CreateFromVector<int32_t>({0, 0, 0}, &mean_).IsOk());
+  }
+};
+}  // namespace
+
+TEST_F(MindDataTestTensorOpFusionPass, FusedOpsBadMeanStd) {
+  MS_LOG(INFO) << "Doing FusedOpsBadMeanStd";
+  std::vector<uint8_t> pixels(4 * 6 * 3, 1);
+  std::shared_ptr<Tensor> image;
+  EXPECT_TRUE(Tensor::CreateFromVector(pixels, TensorShape({4, 6, 3}), &image).IsOk());
+  std::shared_ptr<Tensor> output;
+
+  RescaleNormalizeOp rescale_normalize(RescaleOp(1.0 / 255, 0.0), IntMeanNormalizeOp());
+  EXPECT_TRUE(rescale_normalize.Compute(image, &output).IsError());
+  NormalizeHwcToChwOp normalize_hwc_to_chw{IntMeanNormalizeOp()};
+  EXPECT_TRUE(normalize_hwc_to_chw.Compute(image, &output).IsError());
+
+  // std of 0 is rejected instead of producing inf
+  NormalizeHwcToChwOp zero_std{NormalizeOp(0.0, 0.0, 0.0, 1.0, 0.0, 1.0)};
+  EXPECT_TRUE(zero_std.Compute(image, &output).IsError());
+}
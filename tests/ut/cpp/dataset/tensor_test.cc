@@ -537,3 +537,28 @@ TEST_F(MindDataTestTensorDE, TensorEmpty) {
   t2->Invalidate();
   ASSERT_TRUE(!t2->HasData());
 }
+
+TEST_F(MindDataTestTensorDE, TensorCreateFromTensors) {
+  std::shared_ptr<Tensor> t1, t2, t3;
+  Tensor::CreateFromVector(std::vector<int32_t>{1, 2, 3, 4}, TensorShape({2, 2}), &t1);
+  Tensor::CreateFromVector(std::vector<int32_t>{5, 6, 7, 8}, TensorShape({2, 2}), &t2);
+  std::shared_ptr<Tensor> out;
+  ASSERT_TRUE(Tensor::CreateFromTensors({t1, t2}, &out).IsOk());
+  std::shared_ptr<Tensor> expected;
+  Tensor::CreateFromVector(std::vector<int32_t>{1, 2, 3, 4, 5, 6, 7, 8}, TensorShape({2, 2, 2}), &expected);
+  ASSERT_EQ(*out, *expected);
+
+  // Tensors of different shapes cannot be stacked
+  Tensor::CreateFromVector(std::vector<int32_t>{1, 2, 3, 4}, TensorShape({4}), &t3);
+  ASSERT_TRUE(Tensor::CreateFromTensors({t1, t3}, &out).IsError());
+
+  std::vector<std::string> strings1 = {"abc", "", "de"};
+  std::vector<std::string> strings2 = {"f", "ghij", "k"};
+  Tensor::CreateFromVector(strings1, &t1);
+  Tensor::CreateFromVector(strings2, &t2);
+  ASSERT_TRUE(Tensor::CreateFromTensors({t1, t2}, &out).IsOk());
+  std::vector<std::string> all_strings = {"abc", "", "de", "f", "ghij", "k"};
+  Tensor::CreateFromVector(all_strings, TensorShape({2, 3}), &expected);
+  ASSERT_EQ(*out, *expected);
+  ASSERT_EQ(out->SizeInBytes(), expected->SizeInBytes());
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <string>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_parser.h"
+#include "utils/system/crc32c.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+// Minimal protobuf encoders to build serialized Examples by hand
+void PutVarint(uint64_t value, std::string *out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void PutBytes(uint32_t field, const std::string &bytes, std::string *out) {
+  PutVarint((field << 3) | WireReader::kLengthDelimited, out);
+  PutVarint(bytes.size(), out);
+  out->append(bytes);
+}
+
+std::string Int64Feature(const std::vector<int64_t> &values) {
+  std::string packed;
+  for (auto v : values) PutVarint(static_cast<uint64_t>(v), &packed);
+  std::string list;
+  PutBytes(1, packed, &list);
+  std::string feature;
+  PutBytes(TFExampleParser::kInt64List, list, &feature);
+  return feature;
+}
+
+std::string FloatFeature(const std::vector<float> &values) {
+  std::string packed(values.size() * sizeof(float), '\0');
+  (void)memcpy(&packed[0], values.data(), packed.size());
+  std::string list;
+  PutBytes(1, packed, &list);
+  std::string feature;
+  PutBytes(TFExampleParser::kFloatList, list, &feature);
+  return feature;
+}
+
+std::string BytesFeature(const std::vector<std::string> &values) {
+  std::string list;
+  for (const auto &v : values) PutBytes(1, v, &list);
+  std::string feature;
+  PutBytes(TFExampleParser::kBytesList, list, &feature);
+  return feature;
+}
+
+void PutEntry(const std::string &key, const std::string &feature, std::string *features) {
+  std::string entry;
+  PutBytes(1, key, &entry);
+  PutBytes(2, feature, &entry);
+  PutBytes(1, entry, features);
+}
+
+std::string MakeExample() {
+  std::string features;
+  PutEntry("label", Int64Feature({3, -1, 300}), &features);
+  PutEntry("skipped", BytesFeature({"not", "decoded"}), &features);
+  PutEntry("score", FloatFeature({0.5f, 2.0f}), &features);
+  PutEntry("name", BytesFeature({"ab", "cde"}), &features);
+  std::string example;
+  PutBytes(1, features, &example);
+  return example;
+}
+}  // namespace
+
+class MindDataTestTFExampleParser : public UT::Common {
+ public:
+  MindDataTestTFExampleParser() {}
+};
+
+TEST_F(MindDataTestTFExampleParser, TestSelectedColumns) {
+  TFExampleParser parser({"score", "label", "name", "missing"});
+  std::vector<TFExampleParser::Feature> features;
+  // the features point into the example, which must outlive them
+  std::string example = MakeExample();
+  ASSERT_TRUE(parser.Parse(example, &features).IsOk());
+  ASSERT_EQ(features.size(), 4);
+  EXPECT_EQ(features[0].kind, TFExampleParser::kFloatList);
+  EXPECT_EQ(features[1].kind, TFExampleParser::kInt64List);
+  EXPECT_EQ(features[2].kind, TFExampleParser::kBytesList);
+  EXPECT_FALSE(features[3].found);
+
+  int64_t count = 0;
+  ASSERT_TRUE(TFExampleParser::CountValues(features[0], &count).IsOk());
+  ASSERT_EQ(count, 2);
+  std::vector<float> floats(count);
+  ASSERT_TRUE(TFExampleParser::ReadFloatList(features[0], floats.data(), count).IsOk());
+  EXPECT_EQ(floats[0], 0.5f);
+  EXPECT_EQ(floats[1], 2.0f);
+  // a buffer too small for the values is an error instead of an overflow
+  EXPECT_FALSE(TFExampleParser::ReadFloatList(features[0], floats.data(), count - 1).IsOk());
+
+  ASSERT_TRUE(TFExampleParser::CountValues(features[1], &count).IsOk());
+  ASSERT_EQ(count, 3);
+  std::vector<int32_t> ints(count);
+  ASSERT_TRUE(TFExampleParser::ReadInt64List<int32_t>(features[1], ints.data()).IsOk());
+  EXPECT_EQ(ints[0], 3);
+  EXPECT_EQ(ints[1], -1);
+  EXPECT_EQ(ints[2], 300);
+
+  std::vector<WireSpan> bytes;
+  ASSERT_TRUE(TFExampleParser::ReadBytesList(features[2], &bytes).IsOk());
+  ASSERT_EQ(bytes.size(), 2);
+  EXPECT_EQ(std::string(reinterpret_cast<const char *>(bytes[1].data), bytes[1].size), "cde");
+}
+
+TEST_F(MindDataTestTFExampleParser, TestTruncated) {
+  TFExampleParser parser({"label"});
+  std::string example = MakeExample();
+  example.resize(example.size() - 3);
+  std::vector<TFExampleParser::Feature> features;
+  EXPECT_FALSE(parser.Parse(example, &features).IsOk());
+}
+
+TEST_F(MindDataTestTFExampleParser, TestCrc32c) {
+  // The check value of crc32c
+  const std::string data = "123456789";
+  EXPECT_EQ(mindspore::system::Crc32c::MakeCrc32c(0, data.data(), data.size()), 0xE3069283u);
+  // Unaligned tails go through the byte loop
+  std::string longer = data + data + "x";
+  uint32_t whole = mindspore::system::Crc32c::MakeCrc32c(0, longer.data(), longer.size());
+  uint32_t split = mindspore::system::Crc32c::MakeCrc32c(
+    mindspore::system::Crc32c::MakeCrc32c(0, longer.data(), 5), longer.data() + 5, longer.size() - 5);
+  EXPECT_EQ(whole, split);
+}
@@ -26,6 +26,8 @@
 #include "minddata/dataset/text/kernels/unicode_char_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/unicode_script_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/whitespace_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/wordpiece_tokenizer_op.h"
+#include "minddata/dataset/text/vocab_trie.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
 
@@ -358,4 +360,32 @@ std::shared_ptr<Tensor> input;
   TensorRow output;
   Status s = basic_tokenizer->Compute(TensorRow(0, {input}), &output);
   EXPECT_TRUE(s.IsOk());
-}
\ No newline at end of file
+}
+
+TEST_F(MindDataTestTokenizerOp, TestWordpieceTokenizer) {
+  MS_LOG(INFO) << "Doing TestWordpieceTokenizer.";
+  std::vector<std::string> words = {"my", "favor", "##ite", "book", "is", "love", "dur", "##ing", "the",
+                                    "cat", "##s", "我", "喜欢", "##欢", "[UNK]"};
+  std::shared_ptr<Vocab> vocab;
+  Status s = Vocab::BuildFromVector(words, {}, true, &vocab);
+  EXPECT_TRUE(s.IsOk());
+
+  VocabTrie trie(vocab, "##");
+  EXPECT_EQ(trie.GetWordId(trie.Step(trie.Root(false), "favor")), 1);
+  EXPECT_EQ(trie.GetWordId(trie.Step(trie.Root(false), "fav")), Vocab::kNoTokenExists);
+  EXPECT_EQ(trie.GetWordId(trie.Step(trie.Root(true), "ite")), 2);
+  EXPECT_EQ(trie.GetWordId(trie.Step(trie.Root(false), "##ite")), 2);
+  EXPECT_EQ(trie.Step(trie.Root(true), "favor"), VocabTrie::kNoNode);
+
+  std::unique_ptr<WordpieceTokenizerOp> op(new WordpieceTokenizerOp(vocab));
+  std::shared_ptr<Tensor> input;
+  Tensor::CreateFromVector(std::vector<std::string>{"my", "favorite", "cats", "during", "喜欢", "unaffable"}, &input);
+  TensorRow output;
+  s = op->Compute(TensorRow(0, {input}), &output);
+  EXPECT_TRUE(s.IsOk());
+  std::vector<std::string> expect = {"my", "favor", "##ite", "cat", "##s", "dur", "##ing", "喜欢", "[UNK]"};
+  EXPECT_EQ(output[0]->Size(), static_cast<dsize_t>(expect.size()));
+  for (size_t i = 0; i < expect.size(); ++i) {
+    CheckEqual(output[0], {static_cast<dsize_t>(i)}, expect[i]);
+  }
+}
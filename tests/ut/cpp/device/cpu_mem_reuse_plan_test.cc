@@ -0,0 +1,84 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include "common/common_test.h"
+#include "runtime/device/cpu/cpu_mem_reuse_plan.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+class CPUMemReusePlanTest : public UT::Common {
+ public:
+  CPUMemReusePlanTest() = default;
+};
+
+namespace {
+CPUMemBlock MakeBlock(size_t size, size_t first_use, size_t last_use) {
+  CPUMemBlock block;
+  block.size_ = size;
+  block.first_use_ = first_use;
+  block.last_use_ = last_use;
+  return block;
+}
+
+bool IsOverlap(const CPUMemBlock &lhs, const CPUMemBlock &rhs) {
+  bool time_overlap = lhs.first_use_ <= rhs.last_use_ && rhs.first_use_ <= lhs.last_use_;
+  bool space_overlap = lhs.offset_ < rhs.offset_ + rhs.size_ && rhs.offset_ < lhs.offset_ + lhs.size_;
+  return time_overlap && space_overlap;
+}
+}  // namespace
+
+TEST_F(CPUMemReusePlanTest, ChainReusesMemory) {
+  // a -> b -> c -> d, every tensor is only used by the next kernel.
+  std::vector<CPUMemBlock> blocks{MakeBlock(1024, 0, 1), MakeBlock(1024, 1, 2), MakeBlock(1024, 2, 3),
+                                  MakeBlock(1024, 3, 4)};
+  size_t total_size = CPUMemReusePlan::AssignBlockOffsets(&blocks);
+  EXPECT_EQ(total_size, 2048);
+  EXPECT_EQ(blocks[0].offset_, blocks[2].offset_);
+  EXPECT_EQ(blocks[1].offset_, blocks[3].offset_);
+}
+
+TEST_F(CPUMemReusePlanTest, LiveBlocksNeverOverlap) {
+  std::vector<CPUMemBlock> blocks{MakeBlock(4096, 0, 5), MakeBlock(100, 1, 2), MakeBlock(2000, 2, 3),
+                                  MakeBlock(64, 3, 6),   MakeBlock(3000, 4, 6), MakeBlock(1, 0, 0),
+                                  MakeBlock(0, 1, 1)};
+  size_t naive_size = 0;
+  for (const auto &block : blocks) {
+    naive_size += block.size_;
+  }
+  size_t total_size = CPUMemReusePlan::AssignBlockOffsets(&blocks);
+  EXPECT_LT(total_size, naive_size + blocks.size() * 64);
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    EXPECT_EQ(blocks[i].offset_ % 64, 0);
+    EXPECT_LE(blocks[i].offset_ + blocks[i].size_, total_size);
+    for (size_t j = i + 1; j < blocks.size(); ++j) {
+      EXPECT_FALSE(IsOverlap(blocks[i], blocks[j]));
+    }
+  }
+}
+
+TEST_F(CPUMemReusePlanTest, BestFitGap) {
+  // Block 2 sits between the long living blocks 0 and 1, block 3 takes its place once it is released.
+  std::vector<CPUMemBlock> blocks{MakeBlock(4096, 0, 9), MakeBlock(2048, 0, 9), MakeBlock(3072, 0, 1),
+                                  MakeBlock(1024, 2, 3)};
+  size_t total_size = CPUMemReusePlan::AssignBlockOffsets(&blocks);
+  EXPECT_EQ(total_size, 4096 + 3072 + 2048);
+  EXPECT_EQ(blocks[3].offset_, blocks[2].offset_);
+}
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,228 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/ms_utils.h"
+#include "gtest/gtest.h"
+#include "utils/log_adapter.h"
+#include "minddata/mindrecord/include/shard_index_generator.h"
+#include "minddata/mindrecord/include/shard_label_page.h"
+#include "minddata/mindrecord/include/shard_reader.h"
+#include "minddata/mindrecord/include/shard_writer.h"
+#include "ut_common.h"
+
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::INFO;
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+const char kLabelFile[] = "./label_page.mindrecord";
+const int kNumRows = 20000;
+
+json LabelSchema() {
+  return R"({"id": {"type": "int64"}, "label": {"type": "int32"}, "score": {"type": "float64"},
+             "data": {"type": "bytes"}})"_json;
+}
+
+json LabelRow(int i) { return json{{"id", i * 3}, {"label", i % 1000 - 500}, {"score", i * 0.25}}; }
+
+// Reader which can ignore the label pages, to read labels as in files written without them
+class LabelPageReader : public ShardReader {
+ public:
+  void DisableLabelPages() {
+    label_columns_ = std::make_shared<ShardLabelColumns>(std::vector<std::shared_ptr<Schema>>{});
+  }
+};
+}  // namespace
+
+class TestShardLabelPage : public UT::Common {
+ public:
+  TestShardLabelPage() {}
+
+  void TearDown() override {
+    remove(kLabelFile);
+    remove((std::string(kLabelFile) + ".db").c_str());
+  }
+
+  void WriteLabelFile() {
+    ShardHeader header_data;
+    int schema_id = header_data.AddSchema(Schema::Build("label", LabelSchema()));
+    ASSERT_EQ(schema_id, 0);
+    // "label" and "score" are not index fields, so that they are read from the file
+    ASSERT_EQ(header_data.AddIndexFields(std::vector<std::pair<uint64_t, std::string>>{{schema_id, "id"}}), SUCCESS);
+
+    ShardWriter writer;
+    ASSERT_EQ(writer.Open({kLabelFile}), SUCCESS);
+    ASSERT_EQ(writer.SetShardHeader(std::make_shared<ShardHeader>(header_data)), SUCCESS);
+    // Write in two calls, label pages hold the rows of both
+    for (int start = 0; start < kNumRows; start += kNumRows / 2) {
+      std::map<uint64_t, std::vector<json>> raw_data;
+      std::vector<std::vector<uint8_t>> blob_data;
+      for (int i = start; i < start + kNumRows / 2; ++i) {
+        raw_data[schema_id].push_back(LabelRow(i));
+        blob_data.push_back(std::vector<uint8_t>{static_cast<uint8_t>(i)});
+      }
+      ASSERT_EQ(writer.WriteRawData(raw_data, blob_data), SUCCESS);
+    }
+    ASSERT_EQ(writer.Commit(), SUCCESS);
+
+    ShardIndexGenerator sg{kLabelFile};
+    ASSERT_EQ(sg.Build(), SUCCESS);
+    ASSERT_EQ(sg.WriteToDatabase(), SUCCESS);
+  }
+
+  std::vector<json> ReadLabels(bool label_pages) {
+    std::vector<json> labels;
+    LabelPageReader reader;
+    if (reader.Open({kLabelFile}, true, 4, {"label", "score"}) != SUCCESS) {
+      return labels;
+    }
+    if (!label_pages) {
+      reader.DisableLabelPages();
+    }
+    (void)reader.Launch();
+    while (true) {
+      auto rows = reader.GetNext();
+      if (rows.empty()) break;
+      for (auto &row : rows) {
+        labels.push_back(std::get<1>(row));
+      }
+    }
+    reader.Close();
+    return labels;
+  }
+};
+
+TEST_F(TestShardLabelPage, TestBuildAndDecodePage) {
+  ShardLabelColumns label_columns({Schema::Build("label", LabelSchema())});
+  ASSERT_EQ(label_columns.GetColumnNames(), (std::vector<std::string>{"id", "label", "score"}));
+  ASSERT_EQ(label_columns.GetRowWidth(), 20u);
+  ASSERT_TRUE(label_columns.IsAllRawFields());
+
+  std::vector<uint8_t> rows;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(label_columns.AppendRow(LabelRow(i), &rows), SUCCESS);
+  }
+  ASSERT_EQ(label_columns.AppendRow(json{{"id", 1}, {"label", 1.5}, {"score", 0.0}}, &rows), FAILED);
+  ASSERT_EQ(label_columns.AppendRow(json{{"id", 1}, {"label", 1LL << 40}, {"score", 0.0}}, &rows), FAILED);
+  ASSERT_EQ(label_columns.AppendRow(json{{"id", 1}, {"score", 0.0}}, &rows), FAILED);
+
+  auto page = label_columns.BuildPage(rows, 2, 7);
+  ASSERT_EQ(page.size(), 5u * 20);
+  std::vector<json> values;
+  ASSERT_EQ(label_columns.DecodePage(page.data(), page.size(), 5, {"score", "label"}, &values), SUCCESS);
+  ASSERT_EQ(values.size(), 5u);
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_EQ(values[i], (json{{"label", (i + 2) % 1000 - 500}, {"score", (i + 2) * 0.25}}));
+  }
+  ASSERT_EQ(label_columns.DecodePage(page.data(), page.size() - 1, 5, {}, &values), FAILED);
+
+  std::vector<uint8_t> array;
+  ASSERT_EQ(label_columns.GetValueSize("label"), sizeof(int32_t));
+  ASSERT_EQ(label_columns.GetValueSize("data"), 0u);
+  ASSERT_EQ(label_columns.DecodeColumn(page.data(), page.size(), 5, "label", &array), SUCCESS);
+  ASSERT_EQ(array.size(), 5 * sizeof(int32_t));
+  for (int i = 0; i < 5; ++i) {
+    int32_t label = 0;
+    memcpy(&label, array.data() + i * sizeof(int32_t), sizeof(int32_t));
+    ASSERT_EQ(label, (i + 2) % 1000 - 500);
+  }
+  ASSERT_EQ(label_columns.DecodeColumn(page.data(), page.size(), 5, "data", &array), FAILED);
+
+  json float_schema = R"({"weight": {"type": "float32"}})"_json;
+  ShardLabelColumns float_columns({Schema::Build("label", float_schema)});
+  std::vector<uint8_t> float_rows;
+  ASSERT_EQ(float_columns.AppendRow(json{{"weight", 1.5}}, &float_rows), SUCCESS);
+  ASSERT_EQ(float_columns.AppendRow(json{{"weight", -2}}, &float_rows), SUCCESS);
+  auto float_page = float_columns.BuildPage(float_rows, 0, 2);
+  array.clear();
+  ASSERT_EQ(float_columns.GetValueSize("weight"), sizeof(float));
+  ASSERT_EQ(float_columns.DecodeColumn(float_page.data(), float_page.size(), 2, "weight", &array), SUCCESS);
+  float weights[2] = {0, 0};
+  ASSERT_EQ(array.size(), sizeof(weights));
+  memcpy(weights, array.data(), sizeof(weights));
+  ASSERT_EQ(weights[0], 1.5f);
+  ASSERT_EQ(weights[1], -2.0f);
+
+  json string_schema = R"({"name": {"type": "string"}, "label": {"type": "int32"}})"_json;
+  ShardLabelColumns string_columns({Schema::Build("label", string_schema)});
+  ASSERT_EQ(string_columns.GetColumnNames(), std::vector<std::string>{"label"});
+  ASSERT_FALSE(string_columns.IsAllRawFields());
+}
+
+TEST_F(TestShardLabelPage, TestReadLabelPages) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test read labels from label pages"));
+  WriteLabelFile();
+
+  int label_pages = 0;
+  ShardHeader header;
+  ASSERT_EQ(header.BuildDataset({kLabelFile}), SUCCESS);
+  for (int64_t page_id = 0; page_id <= header.GetLastPageId(0); ++page_id) {
+    label_pages += header.GetPage(0, page_id).first->GetPageType() == kPageTypeLabel ? 1 : 0;
+  }
+  ASSERT_EQ(label_pages, 1);
+
+  auto labels = ReadLabels(true);
+  auto raw_labels = ReadLabels(false);
+
+  ASSERT_EQ(labels.size(), static_cast<size_t>(kNumRows));
+  ASSERT_EQ(labels, raw_labels);
+  for (int i = 0; i < kNumRows; ++i) {
+    ASSERT_EQ(labels[i], (json{{"label", i % 1000 - 500}, {"score", i * 0.25}}));
+  }
+}
+
+TEST_F(TestShardLabelPage, TestGetLabelsById) {
+  MS_LOG(INFO) << common::SafeCStr(FormatInfo("Test read typed labels by id"));
+  WriteLabelFile();
+
+  ShardReader reader;
+  ASSERT_EQ(reader.Open({kLabelFile}, true, 4, {"label", "score"}), SUCCESS);
+  reader.SetTypedLabels(true);
+  ASSERT_EQ(reader.Launch(true), SUCCESS);
+  ASSERT_EQ(reader.GetNumRows(), kNumRows);
+
+  std::vector<std::pair<const uint8_t *, uint64_t>> values;
+  for (int i = 0; i < kNumRows; ++i) {
+    ASSERT_EQ(reader.GetLabelsById(i, {"label", "score"}, &values), SUCCESS);
+    ASSERT_EQ(values.size(), 2u);
+    ASSERT_EQ(values[0].second, sizeof(int32_t));
+    ASSERT_EQ(values[1].second, sizeof(double));
+    int32_t label = 0;
+    double score = 0;
+    memcpy(&label, values[0].first, sizeof(label));
+    memcpy(&score, values[1].first, sizeof(score));
+    ASSERT_EQ(label, LabelRow(i)["label"].get<int32_t>());
+    ASSERT_EQ(score, LabelRow(i)["score"].get<double>());
+  }
+  ASSERT_EQ(reader.GetLabelsById(kNumRows, {"label"}, &values), FAILED);
+  ASSERT_EQ(reader.GetLabelsById(0, {"id"}, &values), FAILED);
+
+  // the rows carry no json when their labels are typed
+  auto row = reader.GetNextById(0, 0);
+  ASSERT_EQ(row.second.size(), 1u);
+  ASSERT_TRUE(std::get<1>(row.second[0]).empty());
+  reader.Close();
+}
+}  // namespace mindrecord
+}  // namespace mindspore
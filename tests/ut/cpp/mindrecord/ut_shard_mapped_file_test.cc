@@ -0,0 +1,76 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/log_adapter.h"
+#include "minddata/mindrecord/include/shard_mapped_file.h"
+#include "ut_common.h"
+
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::INFO;
+
+namespace mindspore {
+namespace mindrecord {
+class TestShardMappedFile : public UT::Common {
+ public:
+  TestShardMappedFile() {}
+  void SetUp() override {
+    std::ofstream out(kFileName, std::ios::out | std::ios::binary);
+    for (int i = 0; i < kFileSize; ++i) {
+      out.put(static_cast<char>(i % 251));
+    }
+  }
+
+  void TearDown() override { remove(kFileName); }
+
+  const char *kFileName = "./mapped_file_test.bin";
+  const int kFileSize = 10000;
+};
+
+TEST_F(TestShardMappedFile, TestSlice) {
+  MS_LOG(INFO) << FormatInfo("Test ShardMappedFile Slice");
+  ShardMappedFile mapped_file;
+  ASSERT_EQ(mapped_file.Open(kFileName), SUCCESS);
+  ASSERT_EQ(mapped_file.GetSize(), static_cast<uint64_t>(kFileSize));
+
+  const uint8_t *slice = mapped_file.Slice(5000, 16);
+  ASSERT_NE(slice, nullptr);
+  for (int i = 0; i < 16; ++i) {
+    ASSERT_EQ(slice[i], (5000 + i) % 251);
+  }
+  mapped_file.Prefetch(4097, 100);
+
+  // Slices beyond the end of the file are rejected
+  ASSERT_EQ(mapped_file.Slice(kFileSize - 5, 6), nullptr);
+  ASSERT_EQ(mapped_file.Slice(kFileSize + 1, 0), nullptr);
+
+  mapped_file.Close();
+  ASSERT_EQ(mapped_file.Slice(0, 1), nullptr);
+}
+
+TEST_F(TestShardMappedFile, TestMissingFile) {
+  MS_LOG(INFO) << FormatInfo("Test ShardMappedFile with a missing file");
+  ShardMappedFile mapped_file;
+  ASSERT_EQ(mapped_file.Open("./no_such_file.bin"), FAILED);
+}
+}  // namespace mindrecord
+}  // namespace mindspore
@@ -92,6 +92,30 @@ TEST_F(TestShardSegment, TestShardSegment) {
   MS_LOG(INFO) << "category id: 1, images count: " << images5.size();
 }
 
+TEST_F(TestShardSegment, TestReadAtPageByIdMapped) {
+  MS_LOG(INFO) << FormatInfo("Test ReadAtPageById through the mapped shard file");
+  std::string file_name = "./imagenet.shard01";
+
+  ShardSegment dataset;
+  ASSERT_EQ(dataset.Open({file_name}, true, 4), SUCCESS);
+  ASSERT_EQ(dataset.SetCategoryField("label"), SUCCESS);
+
+  auto ret = dataset.ReadAtPageById(1, 0, 10);
+  ASSERT_EQ(ret.first, SUCCESS);
+  ASSERT_FALSE(ret.second.empty());
+  auto ret_all = dataset.ReadAllAtPageById(1, 0, 10);
+  ASSERT_EQ(ret_all.first, SUCCESS);
+  ASSERT_EQ(ret_all.second.size(), ret.second.size());
+  for (size_t i = 0; i < ret.second.size(); ++i) {
+    // the blobs are the jpeg files written by ShardWriterImageNet
+    const auto &image = ret.second[i];
+    ASSERT_GT(image.size(), 2);
+    ASSERT_EQ(image[0], 0xFF);
+    ASSERT_EQ(image[1], 0xD8);
+    ASSERT_EQ(std::get<0>(ret_all.second[i]), image);
+  }
+}
+
 TEST_F(TestShardSegment, TestReadAtPageByNameOfCategoryName) {
   MS_LOG(INFO) << FormatInfo("Test ReadAtPageByName of error category_name and category_field");
   std::string file_name = "./imagenet.shard01";
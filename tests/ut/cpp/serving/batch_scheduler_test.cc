@@ -0,0 +1,183 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "serving/core/batch_scheduler.h"
+
+namespace mindspore {
+namespace serving {
+class BatchSchedulerTest : public testing::Test {
+ public:
+  BatchSchedulerTest() = default;
+  void SetUp() override {
+    model_inputs_.resize(1);
+    model_inputs_[0].set_data_type(inference::kMSI_Float32);
+    model_inputs_[0].set_shape({kMaxBatchSize, 2});
+  }
+
+  // the fake model doubles its only input
+  BatchScheduler::ExecuteFunc DoubleModel() {
+    return [this](const PredictRequest &request, PredictReply &reply) {
+      execute_count_++;
+      last_request_ = request;
+      auto &input = request.data(0);
+      auto output = reply.add_result();
+      *output->mutable_tensor_shape() = input.tensor_shape();
+      output->set_tensor_type(input.tensor_type());
+      std::string data = input.data();
+      auto values = reinterpret_cast<float *>(&data[0]);
+      for (size_t i = 0; i < data.size() / sizeof(float); i++) {
+        values[i] *= 2;
+      }
+      output->set_data(data);
+      return Status(SUCCESS);
+    };
+  }
+
+  void CreateRequest(PredictRequest *request, int64_t batch_size, float value) {
+    auto tensor = request->add_data();
+    tensor->set_tensor_type(ms_serving::MS_FLOAT32);
+    tensor->mutable_tensor_shape()->add_dims(batch_size);
+    tensor->mutable_tensor_shape()->add_dims(2);
+    std::vector<float> values(batch_size * 2, value);
+    tensor->set_data(values.data(), values.size() * sizeof(float));
+  }
+
+  void CheckReply(const PredictReply &reply, int64_t batch_size, float value) {
+    ASSERT_EQ(reply.result_size(), 1);
+    auto &result = reply.result(0);
+    ASSERT_EQ(result.tensor_shape().dims_size(), 2);
+    EXPECT_EQ(result.tensor_shape().dims(0), batch_size);
+    EXPECT_EQ(result.tensor_shape().dims(1), 2);
+    ASSERT_EQ(result.data().size(), batch_size * 2 * sizeof(float));
+    auto values = reinterpret_cast<const float *>(result.data().data());
+    for (int64_t i = 0; i < batch_size * 2; i++) {
+      EXPECT_EQ(values[i], value * 2);
+    }
+  }
+
+  static constexpr int64_t kMaxBatchSize = 4;
+  std::vector<inference::InferTensor> model_inputs_;
+  std::atomic<int> execute_count_{0};
+  PredictRequest last_request_;
+};
+
+TEST_F(BatchSchedulerTest, ConcurrentRequestsShareOneExecution) {
+  BatchScheduler scheduler;
+  // a long timeout makes sure the batch is executed because it is full
+  ASSERT_EQ(scheduler.Start(model_inputs_, kMaxBatchSize, 10000000, DoubleModel()), SUCCESS);
+  std::vector<PredictRequest> requests(3);
+  std::vector<PredictReply> replies(3);
+  CreateRequest(&requests[0], 1, 1);
+  CreateRequest(&requests[1], 2, 2);
+  CreateRequest(&requests[2], 1, 3);
+  std::vector<std::thread> threads;
+  std::vector<Status> status(3);
+  for (size_t i = 0; i < requests.size(); i++) {
+    ASSERT_TRUE(scheduler.CanBatch(requests[i]));
+    threads.emplace_back([&, i]() { status[i] = scheduler.Predict(requests[i], replies[i]); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(execute_count_, 1);
+  CheckReply(replies[0], 1, 1);
+  CheckReply(replies[1], 2, 2);
+  CheckReply(replies[2], 1, 3);
+  for (auto &item : status) {
+    EXPECT_EQ(item, SUCCESS);
+  }
+  EXPECT_EQ(scheduler.batch_size_histogram().count(), 1);
+  EXPECT_EQ(scheduler.batch_size_histogram().sum(), 3);
+}
+
+TEST_F(BatchSchedulerTest, TimeoutRunsPaddedBatch) {
+  BatchScheduler scheduler;
+  ASSERT_EQ(scheduler.Start(model_inputs_, kMaxBatchSize, 1000, DoubleModel()), SUCCESS);
+  PredictRequest request;
+  PredictReply reply;
+  CreateRequest(&request, 1, 5);
+  EXPECT_EQ(scheduler.Predict(request, reply), SUCCESS);
+  CheckReply(reply, 1, 5);
+  EXPECT_EQ(execute_count_, 1);
+  // the model always sees its full batch, the rows no request filled are zero
+  auto &merged = last_request_.data(0);
+  EXPECT_EQ(merged.tensor_shape().dims(0), kMaxBatchSize);
+  ASSERT_EQ(merged.data().size(), kMaxBatchSize * 2 * sizeof(float));
+  auto values = reinterpret_cast<const float *>(merged.data().data());
+  EXPECT_EQ(values[1], 5);
+  EXPECT_EQ(values[2], 0);
+  EXPECT_EQ(values[kMaxBatchSize * 2 - 1], 0);
+}
+
+TEST_F(BatchSchedulerTest, IncompatibleRequestsAreNotBatched) {
+  BatchScheduler scheduler;
+  PredictRequest request;
+  CreateRequest(&request, 1, 1);
+  EXPECT_FALSE(scheduler.CanBatch(request));
+  ASSERT_EQ(scheduler.Start(model_inputs_, kMaxBatchSize, 1000, DoubleModel()), SUCCESS);
+  EXPECT_TRUE(scheduler.CanBatch(request));
+
+  PredictRequest full_request;
+  CreateRequest(&full_request, kMaxBatchSize, 1);
+  EXPECT_FALSE(scheduler.CanBatch(full_request));
+
+  PredictRequest type_request;
+  CreateRequest(&type_request, 1, 1);
+  type_request.mutable_data(0)->set_tensor_type(ms_serving::MS_INT32);
+  EXPECT_FALSE(scheduler.CanBatch(type_request));
+
+  PredictRequest shape_request;
+  CreateRequest(&shape_request, 1, 1);
+  shape_request.mutable_data(0)->mutable_tensor_shape()->set_dims(1, 1);
+  EXPECT_FALSE(scheduler.CanBatch(shape_request));
+
+  PredictRequest images_request;
+  CreateRequest(&images_request, 1, 1);
+  images_request.add_images()->add_images("jpeg");
+  EXPECT_FALSE(scheduler.CanBatch(images_request));
+
+  scheduler.Stop();
+  EXPECT_FALSE(scheduler.CanBatch(request));
+}
+
+TEST_F(BatchSchedulerTest, ModelWithoutBatchDimIsRejected) {
+  BatchScheduler scheduler;
+  model_inputs_[0].set_shape({1, 2});
+  EXPECT_NE(scheduler.Start(model_inputs_, kMaxBatchSize, 1000, DoubleModel()), SUCCESS);
+  EXPECT_FALSE(scheduler.running());
+}
+
+TEST_F(BatchSchedulerTest, ExecuteFailureReachesEveryRequest) {
+  BatchScheduler scheduler;
+  auto failed_model = [](const PredictRequest &, PredictReply &) { return Status(FAILED); };
+  ASSERT_EQ(scheduler.Start(model_inputs_, kMaxBatchSize, 10000000, failed_model), SUCCESS);
+  std::vector<PredictRequest> requests(2);
+  std::vector<PredictReply> replies(2);
+  CreateRequest(&requests[0], 2, 1);
+  CreateRequest(&requests[1], 2, 1);
+  std::vector<Status> status(2, Status(SUCCESS));
+  std::thread other([&]() { status[1] = scheduler.Predict(requests[1], replies[1]); });
+  status[0] = scheduler.Predict(requests[0], replies[0]);
+  other.join();
+  EXPECT_EQ(status[0], FAILED);
+  EXPECT_EQ(status[1], FAILED);
+}
+}  // namespace serving
+}  // namespace mindspore
@@ -19,6 +19,7 @@ import os
 import filecmp
 import glob
 import numpy as np
+import pytest
 
 import mindspore.dataset as ds
 import mindspore.dataset.transforms.py_transforms
@@ -357,6 +358,31 @@ def test_deterministic_python_seed_multi_thread():
     ds.config.set_seed(seed_original)
 
 
+
+def test_enable_autotune():
+    """
+    Test the arguments of set_enable_autotune
+    """
+    autotune_original = ds.config.get_enable_autotune()
+
+    ds.config.set_enable_autotune(True, 4)
+    assert ds.config.get_enable_autotune()
+    ds.config.set_enable_autotune(False)
+    assert not ds.config.get_enable_autotune()
+
+    with pytest.raises(TypeError) as info:
+        ds.config.set_enable_autotune(True, 4.0)
+    assert "cpu_budget must be of type int" in str(info.value)
+    with pytest.raises(TypeError) as info:
+        ds.config.set_enable_autotune(1)
+    assert "enable must be of type bool" in str(info.value)
+    with pytest.raises(ValueError) as info:
+        ds.config.set_enable_autotune(True, -1)
+    assert "not within the required range" in str(info.value)
+
+    # Restore original configuration values
+    ds.config.set_enable_autotune(autotune_original)
+
 if __name__ == '__main__':
     test_basic()
     test_get_seed()
@@ -367,3 +393,4 @@ if __name__ == '__main__':
     test_deterministic_run_distribution()
     test_deterministic_python_seed()
     test_deterministic_python_seed_multi_thread()
+    test_enable_autotune()
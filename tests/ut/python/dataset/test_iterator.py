@@ -88,6 +88,32 @@ def test_iterator_create_tuple_mstensor():
     assert i == 64
 
 
+def test_iterator_zero_copy_mstensor():
+    """
+    Test creating tuple iterator with output MSTensor which shares memory with the pipeline output
+    """
+    def generator():
+        for i in range(64):
+            yield (np.array([i, i + 1], dtype=np.float32),)
+
+    original_zero_copy = ds.config.get_zero_copy_output()
+    ds.config.set_zero_copy_output(True)
+    data1 = ds.GeneratorDataset(generator, ["data"])
+
+    i = 0
+    kept = []
+    for item in data1.create_tuple_iterator(num_epochs=1):
+        assert isinstance(item[0], Tensor)
+        assert item[0].dtype == mstype.float32
+        kept.append(item[0])
+        i += 1
+    assert i == 64
+    # Tensors stay valid after the pipeline moved on and was released.
+    for index, tensor in enumerate(kept):
+        np.testing.assert_array_equal(tensor.asnumpy(), np.array([index, index + 1], dtype=np.float32))
+    ds.config.set_zero_copy_output(original_zero_copy)
+
+
 def test_iterator_weak_ref():
     ITERATORS_LIST.clear()
     data = ds.TFRecordDataset(DATA_DIR, SCHEMA_DIR)
@@ -182,6 +208,7 @@ def test_tree_copy():
 
 if __name__ == '__main__':
     test_iterator_create_tuple_numpy()
+    test_iterator_zero_copy_mstensor()
     test_iterator_weak_ref()
     test_iterator_exception()
     test_tree_copy()
@@ -26,6 +26,7 @@ SCHEMA_FILE = "../data/dataset/testTFTestAllTypes/datasetSchema.json"
 
 PIPELINE_FILE = "./pipeline_profiling_1.json"
 DATASET_ITERATOR_FILE = "./dataset_iterator_profiling_1.txt"
+TENSOR_POOL_FILE = "./tensor_pool_profiling_1.json"
 
 
 def test_profiling_simple_pipeline():
@@ -48,6 +49,8 @@ def test_profiling_simple_pipeline():
     os.remove(PIPELINE_FILE)
     assert os.path.exists(DATASET_ITERATOR_FILE) is True
     os.remove(DATASET_ITERATOR_FILE)
+    assert os.path.exists(TENSOR_POOL_FILE) is True
+    os.remove(TENSOR_POOL_FILE)
     del os.environ['PROFILING_MODE']
     del os.environ['MINDDATA_PROFILING_DIR']
 
@@ -88,6 +91,8 @@ def test_profiling_complex_pipeline():
     os.remove(PIPELINE_FILE)
     assert os.path.exists(DATASET_ITERATOR_FILE) is True
     os.remove(DATASET_ITERATOR_FILE)
+    assert os.path.exists(TENSOR_POOL_FILE) is True
+    os.remove(TENSOR_POOL_FILE)
     del os.environ['PROFILING_MODE']
     del os.environ['MINDDATA_PROFILING_DIR']
 
@@ -117,6 +122,8 @@ def test_profiling_sampling_iterval():
     os.remove(PIPELINE_FILE)
     assert os.path.exists(DATASET_ITERATOR_FILE) is True
     os.remove(DATASET_ITERATOR_FILE)
+    assert os.path.exists(TENSOR_POOL_FILE) is True
+    os.remove(TENSOR_POOL_FILE)
 
     ds.config.set_monitor_sampling_interval(interval_origin)
     del os.environ['PROFILING_MODE']
@@ -0,0 +1,140 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""
+Testing saving and restoring the state of a pipeline
+"""
+import numpy as np
+import pytest
+
+import mindspore.dataset as ds
+import mindspore.dataset.transforms.c_transforms as C
+from mindspore import log as logger
+from util import config_get_set_seed
+
+MNIST_DATA_DIR = "../data/dataset/testMnistData"
+
+
+def build_pipeline(sampler, shuffle_size=None, batch_size=None):
+    data = ds.MnistDataset(MNIST_DATA_DIR, sampler=sampler)
+    if shuffle_size is not None:
+        data = data.shuffle(shuffle_size)
+    data = data.map(input_columns=["label"], operations=C.TypeCast(np.int64))
+    if batch_size is not None:
+        data = data.batch(batch_size, drop_remainder=True)
+    return data
+
+
+def fetch(iterator, num_rows, num_epochs=1):
+    """
+    Fetch num_rows rows, skipping the empty row which ends each epoch.
+    """
+    rows = []
+    empty_rows = 0
+    while len(rows) < num_rows:
+        row = iterator.get_next()
+        if not row:
+            empty_rows += 1
+            assert empty_rows <= num_epochs, "fetched {} rows of {}".format(len(rows), num_rows)
+            continue
+        rows.append([item.copy() for item in row])
+    return rows
+
+
+def run_resume(make_sampler, num_epochs, stop_at, shuffle_size=None, batch_size=None):
+    """
+    Compare an uninterrupted run with a run interrupted after stop_at rows and resumed from its saved state.
+    """
+    original_seed = config_get_set_seed(7)
+    full = build_pipeline(make_sampler(), shuffle_size, batch_size)
+    rows_per_epoch = full.get_dataset_size()
+    iterator = full.create_tuple_iterator(num_epochs=num_epochs, output_numpy=True)
+    expected = fetch(iterator, rows_per_epoch * num_epochs, num_epochs)
+
+    ds.config.set_seed(7)
+    first = build_pipeline(make_sampler(), shuffle_size, batch_size)
+    iterator = first.create_tuple_iterator(num_epochs=num_epochs, output_numpy=True)
+    before = fetch(iterator, stop_at, num_epochs)
+    state = iterator.save_state()
+    logger.info("Saved state: {}".format(state))
+
+    second = build_pipeline(make_sampler(), shuffle_size, batch_size)
+    iterator = second.create_tuple_iterator(num_epochs=num_epochs, output_numpy=True, state=state)
+    after = fetch(iterator, rows_per_epoch * num_epochs - stop_at, num_epochs)
+
+    assert len(before + after) == len(expected)
+    for got, want in zip(before + after, expected):
+        for got_item, want_item in zip(got, want):
+            np.testing.assert_array_equal(got_item, want_item)
+
+    # Restore configuration
+    ds.config.set_seed(original_seed)
+
+
+def test_save_state_sequential():
+    """
+    Resume a pipeline with a SequentialSampler, in the middle and at the end of an epoch
+    """
+    logger.info("test_save_state_sequential")
+    run_resume(lambda: ds.SequentialSampler(num_samples=20), num_epochs=2, stop_at=7)
+    run_resume(lambda: ds.SequentialSampler(num_samples=20), num_epochs=2, stop_at=20)
+
+
+def test_save_state_random_shuffle():
+    """
+    Resume a pipeline with a RandomSampler and a shuffle, in the second epoch
+    """
+    logger.info("test_save_state_random_shuffle")
+    run_resume(lambda: ds.RandomSampler(num_samples=30), num_epochs=3, stop_at=45, shuffle_size=8)
+
+
+def test_save_state_distributed_batch():
+    """
+    Resume a pipeline with a DistributedSampler, a shuffle and a batch
+    """
+    logger.info("test_save_state_distributed_batch")
+    run_resume(lambda: ds.DistributedSampler(2, 1, num_samples=24), num_epochs=2, stop_at=4, shuffle_size=5,
+               batch_size=3)
+
+
+def test_save_state_unsupported():
+    """
+    Saving the state of a pipeline with a repeat is not supported
+    """
+    logger.info("test_save_state_unsupported")
+    data = ds.MnistDataset(MNIST_DATA_DIR, num_samples=10, shuffle=False).repeat(2)
+    iterator = data.create_tuple_iterator(num_epochs=1, output_numpy=True)
+    fetch(iterator, 3)
+    with pytest.raises(RuntimeError) as info:
+        iterator.save_state()
+    assert "does not support saving its state" in str(info.value)
+
+
+def test_restore_state_invalid():
+    """
+    Restoring a state which is not a saved state fails
+    """
+    logger.info("test_restore_state_invalid")
+    data = ds.MnistDataset(MNIST_DATA_DIR, num_samples=10, shuffle=False)
+    with pytest.raises(RuntimeError) as info:
+        data.create_tuple_iterator(num_epochs=1, state="not a state")
+    assert "not a valid json string" in str(info.value)
+
+
+if __name__ == "__main__":
+    test_save_state_sequential()
+    test_save_state_random_shuffle()
+    test_save_state_distributed_batch()
+    test_save_state_unsupported()
+    test_restore_state_invalid()